@@ -922,8 +922,8 @@ void avltree_purge(struct avltree_t *tree, const void *key)
 	if(ref == NULL)
 		throw("Key not found.");
 
-	if(tree->delete != NULL)
-		tree->delete(ref);
+	if(tree->_delete != NULL)
+		tree->_delete(ref);
 }
 
 
@@ -954,7 +954,7 @@ void avltree_merge(struct avltree_t *dest, struct avltree_t *src)
 
 void avltree_clear(struct avltree_t *tree)
 {
-	avltree_node_clear(tree->root.node, inst_del, tree->delete);
+	avltree_node_clear(tree->root.node, inst_del, tree->_delete);
 
 	tree->root = avltree_root_empty();
 	tree->count = 0;
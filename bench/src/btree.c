@@ -0,0 +1,401 @@
+#include "btree.h"
+
+
+/*
+ * local function declarations
+ */
+
+static struct btree_blk_t *blk_new(const struct btree_t *tree);
+static void *blk_elem(const struct btree_t *tree, const struct btree_blk_t *blk, size_t idx);
+static int blk_compare(const struct btree_t *tree, const void *key, const struct btree_blk_t *blk, size_t idx);
+static void blk_split(struct btree_t *tree, unsigned int blk);
+
+static void *dir_sep(const struct btree_t *tree, unsigned int blk);
+static void dir_sync(struct btree_t *tree, unsigned int blk);
+
+static void tree_bound(const struct btree_t *tree, const void *key, unsigned int *blk, unsigned int *idx);
+
+
+/**
+ * Create an empty B-tree.
+ *   @size: The size of each element.
+ *   @off: The offset of the key within each element.
+ *   @compare: The key comparison function.
+ *   &returns: The empty tree.
+ */
+
+struct btree_t btree_empty(size_t size, size_t off, btree_compare_f compare)
+{
+	return (struct btree_t){ size, off, compare, 0, 0, 0, NULL, NULL };
+}
+
+/**
+ * Cleans up all data associated with the B-tree.
+ *   @tree: The B-tree.
+ */
+
+void btree_destroy(struct btree_t *tree)
+{
+	unsigned int i;
+
+	for(i = 0; i < tree->nblks; i++)
+		free(tree->blk[i]);
+
+	free(tree->blk);
+	free(tree->sep);
+}
+
+
+/**
+ * Obtain the first element in the tree.
+ *   @tree: The B-tree.
+ *   &returns: The first element or null.
+ */
+
+void *btree_first(const struct btree_t *tree)
+{
+	if(tree->nblks == 0)
+		return NULL;
+
+	return blk_elem(tree, tree->blk[0], 0);
+}
+
+/**
+ * Obtain the last element in the tree.
+ *   @tree: The B-tree.
+ *   &returns: The last element or null.
+ */
+
+void *btree_last(const struct btree_t *tree)
+{
+	struct btree_blk_t *blk;
+
+	if(tree->nblks == 0)
+		return NULL;
+
+	blk = tree->blk[tree->nblks - 1];
+	return blk_elem(tree, blk, blk->cnt - 1);
+}
+
+
+/**
+ * Lookup a B-tree element.
+ *   @tree: The B-tree.
+ *   @key: The sought key.
+ *   &returns: The element if found, null otherwise.
+ */
+
+void *btree_lookup(const struct btree_t *tree, const void *key)
+{
+	unsigned int blk, idx;
+
+	tree_bound(tree, key, &blk, &idx);
+	if(blk == tree->nblks)
+		return NULL;
+	else if(blk_compare(tree, key, tree->blk[blk], idx) != 0)
+		return NULL;
+
+	return blk_elem(tree, tree->blk[blk], idx);
+}
+
+/**
+ * Lookup the LUB element given the key.
+ *   @tree: The B-tree.
+ *   @key: The sought key.
+ *   &returns: The element if found, null otherwise.
+ */
+
+void *btree_atleast(const struct btree_t *tree, const void *key)
+{
+	unsigned int blk, idx;
+
+	tree_bound(tree, key, &blk, &idx);
+	if(blk == tree->nblks)
+		return NULL;
+
+	return blk_elem(tree, tree->blk[blk], idx);
+}
+
+/**
+ * Lookup the GLB element given the key.
+ *   @tree: The B-tree.
+ *   @key: The sought key.
+ *   &returns: The element if found, null otherwise.
+ */
+
+void *btree_atmost(const struct btree_t *tree, const void *key)
+{
+	unsigned int blk, idx;
+
+	tree_bound(tree, key, &blk, &idx);
+	if((blk < tree->nblks) && (blk_compare(tree, key, tree->blk[blk], idx) == 0))
+		return blk_elem(tree, tree->blk[blk], idx);
+	else if(idx > 0)
+		return blk_elem(tree, tree->blk[blk], idx - 1);
+	else if(blk > 0)
+		return blk_elem(tree, tree->blk[blk - 1], tree->blk[blk - 1]->cnt - 1);
+	else
+		return NULL;
+}
+
+
+/**
+ * Insert a copy of an element into the B-tree. Inserting invalidates all
+ * previously returned element pointers.
+ *   @tree: The B-tree.
+ *   @elem: The element.
+ *   &returns: The stored element.
+ */
+
+void *btree_insert(struct btree_t *tree, const void *elem)
+{
+	unsigned int blk, idx;
+	struct btree_blk_t *cur;
+
+	if(tree->nblks == 0) {
+		if(tree->cap == 0) {
+			tree->cap = 16;
+			tree->blk = malloc(tree->cap * sizeof(struct btree_blk_t *));
+			tree->sep = malloc(tree->cap * tree->size);
+		}
+
+		tree->blk[tree->nblks++] = blk_new(tree);
+		blk = 0, idx = 0;
+	}
+	else {
+		tree_bound(tree, (const char *)elem + tree->off, &blk, &idx);
+		if(blk == tree->nblks)
+			blk--, idx = tree->blk[blk]->cnt;
+	}
+
+	if(tree->blk[blk]->cnt == BTREE_BLK_LEN) {
+		blk_split(tree, blk);
+		if(idx > BTREE_BLK_LEN / 2)
+			blk++, idx -= BTREE_BLK_LEN / 2;
+	}
+
+	cur = tree->blk[blk];
+	memmove(blk_elem(tree, cur, idx + 1), blk_elem(tree, cur, idx), (cur->cnt - idx) * tree->size);
+	memcpy(blk_elem(tree, cur, idx), elem, tree->size);
+	cur->cnt++;
+	tree->count++;
+
+	if(idx == cur->cnt - 1)
+		dir_sync(tree, blk);
+
+	return blk_elem(tree, cur, idx);
+}
+
+/**
+ * Remove an element from the B-tree.
+ *   @tree: The B-tree.
+ *   @key: The key.
+ *   &returns: True if found and removed, false otherwise.
+ */
+
+bool btree_remove(struct btree_t *tree, const void *key)
+{
+	unsigned int blk, idx;
+	struct btree_blk_t *cur;
+
+	tree_bound(tree, key, &blk, &idx);
+	if(blk == tree->nblks)
+		return false;
+	else if(blk_compare(tree, key, tree->blk[blk], idx) != 0)
+		return false;
+
+	cur = tree->blk[blk];
+	cur->cnt--;
+	memmove(blk_elem(tree, cur, idx), blk_elem(tree, cur, idx + 1), (cur->cnt - idx) * tree->size);
+	tree->count--;
+
+	if(cur->cnt == 0) {
+		free(cur);
+		tree->nblks--;
+		memmove(tree->blk + blk, tree->blk + blk + 1, (tree->nblks - blk) * sizeof(struct btree_blk_t *));
+		memmove(dir_sep(tree, blk), dir_sep(tree, blk + 1), (tree->nblks - blk) * tree->size);
+	}
+	else if(idx == cur->cnt)
+		dir_sync(tree, blk);
+
+	return true;
+}
+
+
+/**
+ * Create an iterator at the beginning of the B-tree.
+ *   @tree: The B-tree.
+ *   &returns: The iterator.
+ */
+
+struct btree_iter_t btree_iter_begin(const struct btree_t *tree)
+{
+	return (struct btree_iter_t){ tree, 0, 0 };
+}
+
+/**
+ * Retrieve the next element from the B-tree iterator.
+ *   @iter: The iterator.
+ *   &returns: The next element or null if at the end.
+ */
+
+void *btree_iter_next(struct btree_iter_t *iter)
+{
+	void *elem;
+	const struct btree_t *tree = iter->tree;
+
+	if(iter->blk >= tree->nblks)
+		return NULL;
+
+	elem = blk_elem(tree, tree->blk[iter->blk], iter->idx++);
+	if(iter->idx == tree->blk[iter->blk]->cnt)
+		iter->blk++, iter->idx = 0;
+
+	return elem;
+}
+
+
+/**
+ * Allocate an empty leaf block.
+ *   @tree: The B-tree.
+ *   &returns: The block.
+ */
+
+static struct btree_blk_t *blk_new(const struct btree_t *tree)
+{
+	struct btree_blk_t *blk;
+
+	blk = malloc(sizeof(struct btree_blk_t) + BTREE_BLK_LEN * tree->size);
+	blk->cnt = 0;
+
+	return blk;
+}
+
+/**
+ * Retrieve an element from a block.
+ *   @tree: The B-tree.
+ *   @blk: The block.
+ *   @idx: The index.
+ *   &returns: The element.
+ */
+
+static void *blk_elem(const struct btree_t *tree, const struct btree_blk_t *blk, size_t idx)
+{
+	return (char *)blk->arr + idx * tree->size;
+}
+
+/**
+ * Compare a key against an element of a block.
+ *   @tree: The B-tree.
+ *   @key: The key.
+ *   @blk: The block.
+ *   @idx: The index.
+ *   &returns: Their order.
+ */
+
+static int blk_compare(const struct btree_t *tree, const void *key, const struct btree_blk_t *blk, size_t idx)
+{
+	return tree->compare(key, (char *)blk_elem(tree, blk, idx) + tree->off);
+}
+
+/**
+ * Split a full block into two halves.
+ *   @tree: The B-tree.
+ *   @blk: The block index.
+ */
+
+static void blk_split(struct btree_t *tree, unsigned int blk)
+{
+	struct btree_blk_t *cur = tree->blk[blk], *next;
+
+	if(tree->nblks == tree->cap) {
+		tree->cap *= 2;
+		tree->blk = realloc(tree->blk, tree->cap * sizeof(struct btree_blk_t *));
+		tree->sep = realloc(tree->sep, tree->cap * tree->size);
+	}
+
+	next = blk_new(tree);
+	next->cnt = cur->cnt - BTREE_BLK_LEN / 2;
+	cur->cnt = BTREE_BLK_LEN / 2;
+	memcpy(next->arr, blk_elem(tree, cur, cur->cnt), next->cnt * tree->size);
+
+	memmove(tree->blk + blk + 2, tree->blk + blk + 1, (tree->nblks - blk - 1) * sizeof(struct btree_blk_t *));
+	tree->blk[blk + 1] = next;
+	memmove(dir_sep(tree, blk + 1), dir_sep(tree, blk), (tree->nblks - blk) * tree->size);
+	tree->nblks++;
+
+	dir_sync(tree, blk);
+}
+
+
+/**
+ * Retrieve the separator of a block.
+ *   @tree: The B-tree.
+ *   @blk: The block index.
+ *   &returns: The copy of the block's last element.
+ */
+
+static void *dir_sep(const struct btree_t *tree, unsigned int blk)
+{
+	return (char *)tree->sep + blk * tree->size;
+}
+
+/**
+ * Refresh the separator of a block from its last element.
+ *   @tree: The B-tree.
+ *   @blk: The block index.
+ */
+
+static void dir_sync(struct btree_t *tree, unsigned int blk)
+{
+	const struct btree_blk_t *cur = tree->blk[blk];
+
+	memcpy(dir_sep(tree, blk), blk_elem(tree, cur, cur->cnt - 1), tree->size);
+}
+
+
+/**
+ * Find the position of the first element not less than the key.
+ *   @tree: The B-tree.
+ *   @key: The key.
+ *   @blk: Out. The block index, 'nblks' if every element is less.
+ *   @idx: Out. The index within the block.
+ */
+
+static void tree_bound(const struct btree_t *tree, const void *key, unsigned int *blk, unsigned int *idx)
+{
+	unsigned int lo, hi, mid;
+	struct btree_blk_t *cur;
+
+	/* find the first block whose separator is not less than the key */
+
+	lo = 0, hi = tree->nblks;
+	while(lo < hi) {
+		mid = (lo + hi) / 2;
+
+		if(tree->compare(key, (char *)dir_sep(tree, mid) + tree->off) > 0)
+			lo = mid + 1;
+		else
+			hi = mid;
+	}
+
+	*blk = lo;
+	*idx = 0;
+	if(lo == tree->nblks)
+		return;
+
+	/* find the first element within the block not less than the key */
+
+	cur = tree->blk[lo];
+	lo = 0, hi = cur->cnt - 1;
+	while(lo < hi) {
+		mid = (lo + hi) / 2;
+
+		if(blk_compare(tree, key, cur, mid) > 0)
+			lo = mid + 1;
+		else
+			hi = mid;
+	}
+
+	*idx = lo;
+}
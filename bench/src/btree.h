@@ -0,0 +1,113 @@
+#ifndef BTREE_H
+#define BTREE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+
+/**
+ * B-tree definitions.
+ *   @BTREE_BLK_LEN: The maximum number of elements per leaf block.
+ */
+
+#define BTREE_BLK_LEN	64
+
+
+/**
+ * Key comparison.
+ *   @key: The sought key.
+ *   @elem: The key stored within an element.
+ *   &returns: Their order.
+ */
+
+typedef int (*btree_compare_f)(const void *key, const void *elem);
+
+
+/*
+ * structure prototypes
+ */
+
+struct btree_t;
+struct btree_blk_t;
+struct btree_iter_t;
+
+
+/**
+ * B-tree storage. The tree has two levels: a sorted directory of leaf blocks
+ * and the leaf blocks themselves, which store the elements inline. The
+ * directory keeps a copy of each block's last element in one contiguous
+ * array, so descent searches that array and then touches a single block.
+ *   @size: The element size.
+ *   @off: The offset of the key within an element.
+ *   @compare: The key comparison function.
+ *   @count: The number of elements.
+ *   @nblks, cap: The number of blocks and the directory capacity.
+ *   @blk: The block directory.
+ *   @sep: The separator array, holding the last element of each block.
+ */
+
+struct btree_t {
+	size_t size, off;
+	btree_compare_f compare;
+
+	unsigned int count;
+
+	unsigned int nblks, cap;
+	struct btree_blk_t **blk;
+	void *sep;
+};
+
+/**
+ * B-tree leaf block.
+ *   @cnt: The number of elements.
+ *   @arr: The inline element array.
+ */
+
+struct btree_blk_t {
+	size_t cnt;
+	uint64_t arr[];
+};
+
+/**
+ * B-tree iterator storage.
+ *   @tree: The tree.
+ *   @blk, idx: The current block and index within the block.
+ */
+
+struct btree_iter_t {
+	const struct btree_t *tree;
+	unsigned int blk, idx;
+};
+
+
+/*
+ * b-tree function declarations
+ */
+
+struct btree_t btree_empty(size_t size, size_t off, btree_compare_f compare);
+void btree_destroy(struct btree_t *tree);
+
+void *btree_first(const struct btree_t *tree);
+void *btree_last(const struct btree_t *tree);
+
+void *btree_lookup(const struct btree_t *tree, const void *key);
+void *btree_atleast(const struct btree_t *tree, const void *key);
+void *btree_atmost(const struct btree_t *tree, const void *key);
+
+void *btree_insert(struct btree_t *tree, const void *elem);
+bool btree_remove(struct btree_t *tree, const void *key);
+
+struct btree_iter_t btree_iter_begin(const struct btree_t *tree);
+void *btree_iter_next(struct btree_iter_t *iter);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
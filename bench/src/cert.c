@@ -0,0 +1,146 @@
+#include "cert.h"
+
+
+/*
+ * local function declarations
+ */
+
+static void fix_write(FILE *file, const struct fixint_t *fix);
+static bool fix_read(FILE *file, struct fixint_t *fix);
+
+
+/**
+ * Write the certificate header.
+ *   @file: The file.
+ *   @hash: The lookup table hash.
+ */
+
+void cert_header(FILE *file, uint64_t hash)
+{
+	uint32_t head[2] = { CERT_MAGIC, CERT_VERSION };
+
+	fwrite(head, sizeof(head), 1, file);
+	fwrite(&hash, sizeof(hash), 1, file);
+}
+
+/**
+ * Read and validate the certificate header.
+ *   @file: The file.
+ *   @hash: Out. The lookup table hash.
+ *   &returns: True if the header is valid, false otherwise.
+ */
+
+bool cert_header_read(FILE *file, uint64_t *hash)
+{
+	uint32_t head[2];
+
+	if(fread(head, sizeof(head), 1, file) != 1)
+		return false;
+	else if((head[0] != CERT_MAGIC) || (head[1] != CERT_VERSION))
+		return false;
+
+	return fread(hash, sizeof(*hash), 1, file) == 1;
+}
+
+
+/**
+ * Write a certificate record.
+ *   @file: The file.
+ *   @rec: The record.
+ */
+
+void cert_write(FILE *file, const struct cert_rec_t *rec)
+{
+	fwrite(&rec->kind, sizeof(rec->kind), 1, file);
+	fwrite(&rec->exp, sizeof(rec->exp), 1, file);
+	fwrite(&rec->fact, sizeof(rec->fact), 1, file);
+	fix_write(file, &rec->mod);
+	fix_write(file, &rec->mid);
+	fwrite(&rec->idx, sizeof(rec->idx), 1, file);
+	fwrite(&rec->ncand, sizeof(rec->ncand), 1, file);
+	fwrite(rec->cand, sizeof(uint64_t), rec->ncand, file);
+}
+
+/**
+ * Read a certificate record. The candidate array is reallocated as needed
+ * and must be initialized to null before the first read.
+ *   @file: The file.
+ *   @rec: The record.
+ *   &returns: One if a record was read, zero at the end of the file, and
+ *     negative if the record is truncated or malformed.
+ */
+
+int cert_read(FILE *file, struct cert_rec_t *rec)
+{
+	uint64_t *cand;
+
+	if(fread(&rec->kind, sizeof(rec->kind), 1, file) != 1)
+		return feof(file) ? 0 : -1;
+	else if(fread(&rec->exp, sizeof(rec->exp), 1, file) != 1)
+		return -1;
+	else if(fread(&rec->fact, sizeof(rec->fact), 1, file) != 1)
+		return -1;
+	else if(!fix_read(file, &rec->mod) || !fix_read(file, &rec->mid))
+		return -1;
+	else if(fread(&rec->idx, sizeof(rec->idx), 1, file) != 1)
+		return -1;
+	else if(fread(&rec->ncand, sizeof(rec->ncand), 1, file) != 1)
+		return -1;
+
+	if(rec->ncand > CERT_MAXCAND) {
+		rec->ncand = 0;
+		return -1;
+	}
+
+	cand = realloc(rec->cand, ((size_t)rec->ncand + 1) * sizeof(uint64_t));
+	if(cand == NULL) {
+		rec->ncand = 0;
+		return -1;
+	}
+
+	rec->cand = cand;
+
+	return (fread(rec->cand, sizeof(uint64_t), rec->ncand, file) == rec->ncand) ? 1 : -1;
+}
+
+
+/**
+ * Write a fixed-width integer.
+ *   @file: The file.
+ *   @fix: The fixed-width integer.
+ */
+
+static void fix_write(FILE *file, const struct fixint_t *fix)
+{
+	uint8_t neg = fix->neg;
+	uint32_t len = fix->len;
+
+	fwrite(&neg, sizeof(neg), 1, file);
+	fwrite(&len, sizeof(len), 1, file);
+	fwrite(fix->arr, sizeof(uint64_t), len, file);
+}
+
+/**
+ * Read a fixed-width integer.
+ *   @file: The file.
+ *   @fix: The fixed-width integer.
+ *   &returns: True on success, false otherwise.
+ */
+
+static bool fix_read(FILE *file, struct fixint_t *fix)
+{
+	uint8_t neg;
+	uint32_t len;
+
+	if(fread(&neg, sizeof(neg), 1, file) != 1)
+		return false;
+	else if(fread(&len, sizeof(len), 1, file) != 1)
+		return false;
+	else if(len > FIXINT_LEN)
+		return false;
+
+	fix->neg = neg;
+	fix->len = len;
+
+	return fread(fix->arr, sizeof(uint64_t), len, file) == len;
+}
@@ -0,0 +1,64 @@
+#ifndef CERT_H
+#define CERT_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include "integer.h"
+
+/**
+ * Certificate definitions.
+ *   @CERT_MAGIC: The file magic, "ERLC" in little endian.
+ *   @CERT_VERSION: The format version.
+ *   @CERT_MAXCAND: The largest candidate count accepted from a file.
+ */
+
+#define CERT_MAGIC	0x434c5245
+#define CERT_VERSION	1
+#define CERT_MAXCAND	(1u << 24)
+
+
+/**
+ * Certificate record for a single searched exponent.
+ *   @kind: The search kind, 'u' for upper and 'l' for lower.
+ *   @exp: The searched exponent.
+ *   @fact: The number of modulus factors.
+ *   @mod: The modulus.
+ *   @mid: The minimal midpoint distance found.
+ *   @idx: The index of the minimal midpoint.
+ *   @ncand: The number of failure candidates.
+ *   @cand: The candidate indices.
+ */
+
+struct cert_rec_t {
+	char kind;
+	int32_t exp;
+	uint32_t fact;
+	struct fixint_t mod, mid;
+	uint64_t idx;
+
+	uint32_t ncand;
+	uint64_t *cand;
+};
+
+
+/*
+ * certificate function declarations
+ */
+
+void cert_header(FILE *file, uint64_t hash);
+bool cert_header_read(FILE *file, uint64_t *hash);
+
+void cert_write(FILE *file, const struct cert_rec_t *rec);
+int cert_read(FILE *file, struct cert_rec_t *rec);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,242 @@
+#define restrict __restrict
+#include <string.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <math.h>
+#include "integer.h"
+#include "cert.h"
+
+extern "C" {
+#include "../../gay/gay.h"
+#include "../../errol/src/errol.h"
+}
+
+
+/**
+ * Multiply a fixed-width integer by a 64-bit value.
+ *   @fix: The fixed-width integer.
+ *   @val: The value to multiply.
+ */
+
+static void fix_mul64(struct fixint_t *fix, uint64_t val)
+{
+	struct fixint_t low = *fix;
+
+	fixint_mul_uint(fix, val >> 32);
+	fixint_mul_uint(fix, 1 << 16);
+	fixint_mul_uint(fix, 1 << 16);
+	fixint_mul_uint(&low, val & 0xFFFFFFFF);
+	fixint_add(fix, &low);
+}
+
+/**
+ * Compute the non-negative midpoint residue for a record and index.
+ *   @rec: The record.
+ *   @red: The modulus reducer.
+ *   @idx: The shift index.
+ *   @out: The output residue.
+ */
+
+static void residue(const struct cert_rec_t *rec, const struct fixint_mod_t *red, uint64_t idx, struct fixint_t *out)
+{
+	struct fixint_t init, tmp;
+
+	if(rec->kind == 'u') {
+		int exp = rec->exp - rec->fact;
+
+		fixint_pow_mod(out, 2, exp + 53, red);
+		fixint_pow_mod(&tmp, 2, exp, red);
+		fixint_add(out, &tmp);
+		fixint_pow_mod(&init, 2, exp + 1, red);
+	}
+	else {
+		fixint_pow_mod(&tmp, 5, rec->exp - rec->fact, red);
+		*out = tmp;
+		fix_mul64(out, (uint64_t)1 << 54);
+		fixint_add(out, &tmp);
+		init = tmp;
+		fixint_mul_uint(&init, 2);
+	}
+
+	fix_mul64(&init, idx);
+	fixint_add(out, &init);
+	fixint_mod(out, red);
+}
+
+/**
+ * Compute the distance of a residue from zero, modulo the modulus.
+ *   @res: The non-negative residue, replaced by the distance.
+ *   @mod: The modulus.
+ */
+
+static void distance(struct fixint_t *res, const struct fixint_t *mod)
+{
+	struct fixint_t neg = *mod;
+
+	fixint_sub(&neg, res);
+	if(fixint_cmp(&neg, res) < 0)
+		*res = neg;
+}
+
+/**
+ * Check an Errol conversion for correctness and shortness.
+ *   @val: The value.
+ *   &returns: True if correct and shortest, false otherwise.
+ */
+
+static bool check(double val)
+{
+	bool suc;
+	int32_t exp;
+	char buf[108], str[256], *ref;
+	int decpt, sign;
+	double chk;
+
+	exp = errol_short(val, buf);
+	sprintf(str, "0.%se%d", buf, exp);
+	sscanf(str, "%lf", &chk);
+
+	ref = dtoa(val, 0, 12, &decpt, &sign, NULL);
+	suc = (chk == val) && (strlen(ref) == strlen(buf));
+	if(!suc)
+		fprintf(stderr, "Errol failure. Input '%.17e'. Expected '%s'. Actual '%s'.\n", val, ref, buf);
+
+	freedtoa(ref);
+
+	return suc;
+}
+
+/**
+ * Revalidate a single certificate record.
+ *   @rec: The record.
+ *   &returns: True if valid, false otherwise.
+ */
+
+static bool verify(const struct cert_rec_t *rec)
+{
+	int cmp;
+	uint32_t i;
+	unsigned int fact;
+	struct fixint_t mod, err, res;
+	struct fixint_mod_t red;
+	double pred, succ;
+	bool suc = true;
+
+	/* recompute the modulus and error bound */
+
+	if(rec->kind == 'u') {
+		fact = log10(pow(2, rec->exp + 53)) - 16;
+		fixint_pow(&mod, 5, fact);
+		fixint_pow(&err, 2, rec->exp - fact - 48);
+	}
+	else if(rec->kind == 'l') {
+		fact = 54*log10(2) + rec->exp*log10(5) - 16;
+		if(pow(2, -48) * pow(5, rec->exp - fact) < 1.0)
+			return (fact == rec->fact) && (rec->ncand == 0);
+
+		fixint_pow(&mod, 2, fact);
+		fixint_pow(&err, 5, rec->exp - fact);
+		for(i = 0; i < 48; i++)
+			fixint_div_uint(&err, 2);
+	}
+	else
+		return fprintf(stderr, "Invalid record kind.\n"), false;
+
+	if((fact != rec->fact) || (fixint_cmp(&mod, &rec->mod) != 0))
+		return fprintf(stderr, "Modulus mismatch. Exp %d.\n", rec->exp), false;
+
+	fixint_mod_init(&red, &mod);
+
+	/* the minimal midpoint must be congruent to the recorded distance */
+
+	residue(rec, &red, rec->idx, &res);
+	if(rec->mid.neg) {
+		struct fixint_t pos = mod;
+
+		fixint_sub(&pos, &res);
+		res = pos;
+	}
+
+	if(fixint_cmp(&res, &rec->mid) != 0)
+		return fprintf(stderr, "Midpoint mismatch. Exp %d.\n", rec->exp), false;
+
+	/* every candidate must be a near midpoint, and errol must handle it */
+
+	for(i = 0; i < rec->ncand; i++) {
+		if(rec->cand[i] >= (1ul << 52))
+			return fprintf(stderr, "Candidate out of range. Exp %d.\n", rec->exp), false;
+
+		// the search seeds the candidates with the minimal midpoint, which
+		// need not be within the error bound
+		if(rec->cand[i] != rec->idx) {
+			residue(rec, &red, rec->cand[i], &res);
+			distance(&res, &mod);
+
+			cmp = fixint_cmp(&res, &err);
+			if((cmp > 0) || ((cmp == 0) && (rec->kind == 'u')))
+				return fprintf(stderr, "Candidate not a near midpoint. Exp %d.\n", rec->exp), false;
+		}
+
+		if(rec->kind == 'u') {
+			pred = ldexp((double)(rec->cand[i] + 0) + (double)(1l << 52), rec->exp + 1);
+			succ = ldexp((double)(rec->cand[i] + 1) + (double)(1l << 52), rec->exp + 1);
+		}
+		else {
+			pred = ldexp((double)(rec->cand[i] + 0) + (double)(1l << 53), -rec->exp + 1);
+			succ = ldexp((double)(rec->cand[i] + 1) + (double)(1l << 53), -rec->exp + 1);
+		}
+
+		suc &= check(pred);
+		suc &= check(succ);
+	}
+
+	return suc;
+}
+
+
+/**
+ * Main entry point.
+ *   @argc: The number of argument.
+ *   @argv: The argument array.
+ *   &returns: The error code.
+ */
+
+int main(int argc, char *argv[])
+{
+	FILE *file;
+	int ret;
+	uint64_t hash;
+	unsigned int nrec = 0, ncand = 0, nfail = 0;
+	struct cert_rec_t rec;
+
+	if(argc != 2)
+		return fprintf(stderr, "usage: certchk <file>\n"), 2;
+
+	file = fopen(argv[1], "r");
+	if(file == NULL)
+		return fprintf(stderr, "Cannot open '%s'.\n", argv[1]), 2;
+
+	if(!cert_header_read(file, &hash))
+		return fprintf(stderr, "Invalid certificate header.\n"), 2;
+
+	if(hash != errol_table_hash())
+		printf("note: certificate table %016lx, library table %016lx\n", hash, errol_table_hash());
+
+	rec.cand = NULL;
+	while((ret = cert_read(file, &rec)) > 0) {
+		nrec++;
+		ncand += rec.ncand;
+		if(!verify(&rec))
+			nfail++, fprintf(stderr, "Record failed. Kind '%c'. Exp %d.\n", rec.kind, rec.exp);
+	}
+
+	free(rec.cand);
+	fclose(file);
+
+	if(ret < 0)
+		return fprintf(stderr, "Truncated or malformed record after %u records.\n", nrec), 2;
+
+	printf("records: %u, candidates: %u, failures: %u\n", nrec, ncand, nfail);
+
+	return (nfail > 0) ? 1 : 0;
+}
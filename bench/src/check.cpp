@@ -0,0 +1,755 @@
+#define restrict __restrict
+#include <string.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <math.h>
+#include <fenv.h>
+#include <float.h>
+#include <sys/time.h>
+#ifdef __SIZEOF_FLOAT128__
+#include <quadmath.h>
+#endif
+#include "util.h"
+#include "check.h"
+
+extern "C" {
+#include "../../gay/gay.h"
+#include "../../errol/src/errol.h"
+}
+
+
+/*
+ * check tallies, reset by each check mode
+ */
+
+static unsigned int nchk, nfail;
+
+
+/**
+ * Create a random subnormal double.
+ *   &returns: The random subnormal, positive and non-zero.
+ */
+
+static double randsub(void)
+{
+	union { double d; uint64_t i; } val;
+
+	do {
+		val.i = ((uint64_t)rand() << 31) ^ (uint64_t)rand() ^ ((uint64_t)rand() << 40);
+		val.i &= ((uint64_t)1 << 52) - 1;
+		val.i >>= rand() % 52;
+	} while(val.i == 0);
+
+	return val.d;
+}
+
+/**
+ * Count the significant digits of the exact decimal expansion of a value.
+ *   @val: The value, positive and finite.
+ *   &returns: The number of digits.
+ */
+
+static int exact_digits(double val)
+{
+	char buf[1200];
+	int len;
+
+	sprintf(buf, "%.*e", 1100, val);
+	len = strchr(buf, 'e') - buf;
+	while(buf[len - 1] == '0')
+		len--;
+
+	if(buf[len - 1] == '.')
+		len--;
+
+	return len - (len > 1);
+}
+
+/**
+ * Compare digits with gay's dtoa in a mode, ignoring trailing zeros.
+ *   @val: The value.
+ *   @mode: The dtoa mode, 2 for significant digits or 3 for fixed.
+ *   @ndigits: The number of digits.
+ *   @buf: The digits.
+ *   @exp: The exponent.
+ */
+
+static void chk_gay(double val, int mode, int ndigits, const char *buf, int32_t exp)
+{
+	char *ref;
+	int decpt, sign, len;
+
+	len = strlen(buf);
+	while((len > 0) && (buf[len - 1] == '0'))
+		len--;
+
+	ref = dtoa(val, mode, ndigits, &decpt, &sign, NULL);
+
+	nchk++;
+	if(((int)strlen(ref) != len) || (memcmp(ref, buf, len) != 0) || (decpt != exp))
+		nfail++, fprintf(stderr, "Errol: %s mismatch. Input '%.17e', digits %d. Expected '%se%d'. Actual '%se%d'.\n", (mode == 2) ? "Precision" : "Fixed", val, ndigits, ref, decpt, buf, exp);
+
+	freedtoa(ref);
+}
+
+/**
+ * Check 'errol_precision' and 'errol_fixed' on a value against gay's dtoa
+ * modes 2 and 3.
+ *   @val: The value, positive and finite.
+ *   @ndigits: The number of significant digits, skipped if below one.
+ *   @frac: The number of fractional digits, skipped if negative.
+ */
+
+static void chk_prec_one(double val, int ndigits, int frac)
+{
+	static char buf[2048];
+	int32_t exp;
+
+	if(ndigits > 0) {
+		exp = errol_precision(val, ndigits, buf);
+		chk_gay(val, 2, ndigits, buf, exp);
+	}
+
+	if(frac >= 0) {
+		exp = errol_fixed(val, frac, buf);
+		chk_gay(val, 3, frac, buf, exp);
+	}
+}
+
+/**
+ * Print and reset the tallies of a group of checks.
+ *   @name: The group name.
+ *   &returns: The number of failures.
+ */
+
+static unsigned int chk_tally(const char *name)
+{
+	unsigned int fail = nfail;
+
+	printf("%s: %u checks, failures: %u\n", name, nchk, nfail);
+	nchk = nfail = 0;
+
+	return fail;
+}
+
+
+/**
+ * Check 'errol_precision' and 'errol_fixed' against gay's dtoa modes 2 and
+ * 3: random values with up to 'CHK_DIGITS' digits, well past
+ * 'ERROL_PREC_MAX'; subnormals with up to 800 digits; exact ties, which
+ * always take the exact fallback; and the neighbours of each power of ten,
+ * which carry into a new leading digit or round to zero.
+ *   &returns: The error code.
+ */
+
+int chk_prec(void)
+{
+	int i, k, r, j, n;
+	uint64_t odd;
+	double val, pow;
+	char str[16];
+	unsigned int fail = 0;
+
+	srand(CHK_SEED);
+	nchk = nfail = 0;
+
+	for(i = 0; i < CHK_COUNT; i++)
+		chk_prec_one(randval(), 1 + rand() % CHK_DIGITS, rand() % CHK_DIGITS);
+
+	fail += chk_tally("random");
+
+	for(i = 0; i < CHK_COUNT / 10; i++)
+		chk_prec_one(randsub(), 1 + rand() % 800, 1 + rand() % 1100);
+
+	fail += chk_tally("subnormal");
+
+	/* an odd multiple of 2^-j has j fractional digits, the last a five */
+
+	for(i = 0; i < CHK_COUNT / 10; i++) {
+		odd = ((((uint64_t)rand() << 31) ^ (uint64_t)rand() ^ ((uint64_t)rand() << 22)) >> (11 + rand() % 53)) | 1;
+		j = 1 + rand() % 1074;
+		val = ldexp((double)odd, -j);
+		if((val == 0.0) || (ldexp(val, j) != (double)odd))
+			continue;
+
+		n = exact_digits(val);
+		chk_prec_one(val, n - 1, j - 1);
+	}
+
+	fail += chk_tally("ties");
+
+	for(k = -323; k <= 308; k++) {
+		sprintf(str, "1e%d", k);
+		pow = strtod(str, NULL);
+
+		for(r = 0; r < 4; r++) {
+			val = (r == 0) ? pow : (r == 1) ? nextafter(pow, 0.0) : (r == 2) ? nextafter(pow, INFINITY) : (0.95 * pow);
+			if((val == 0.0) || !isfinite(val))
+				continue;
+
+			for(n = 1; n <= 25; n++)
+				chk_prec_one(val, n, -1);
+
+			for(n = -3; n <= 20; n++)
+				chk_prec_one(val, 0, ((-k + n) > 0) ? (-k + n) : 0);
+		}
+	}
+
+	fail += chk_tally("powers of ten");
+
+	return (fail > 0) ? 1 : 0;
+}
+
+
+/**
+ * Split a '%e' formatted string into digits, without trailing zeros, and the
+ * exponent of the form '0.<digits>'.
+ *   @str: The string.
+ *   @buf: The output digits.
+ *   &returns: The exponent.
+ */
+
+static int32_t ext_split(const char *str, char *buf)
+{
+	int n = 0;
+
+	for(; *str != 'e'; str++) {
+		if(*str != '.')
+			buf[n++] = *str;
+	}
+
+	while((n > 1) && (buf[n - 1] == '0'))
+		n--;
+
+	buf[n] = '\0';
+
+	return atoi(str + 1) + 1;
+}
+
+/**
+ * Write the exact digits of an extended double, without trailing zeros.
+ *   @val: The value, finite.
+ *   @buf: The output digits, of at least 1102 bytes.
+ *   &returns: The exponent of the form '0.<digits>'.
+ */
+
+static int32_t ext_split_long(long double val, char *buf)
+{
+	static char str[1200];
+
+	sprintf(str, "%.*Le", 1100, val);
+
+	return ext_split(str, buf);
+}
+
+/*
+ * the rounding modes tried at each length, nearest first
+ */
+
+static const int ext_modes[3] = { FE_TONEAREST, FE_DOWNWARD, FE_UPWARD };
+
+/**
+ * Find the shortest digits that read back to an x87 extended double, and
+ * among them the nearest. Each length tries the digits rounded to nearest,
+ * then down and up; at most one of the last two also reads back.
+ *   @val: The value, positive and finite.
+ *   @buf: The output digits.
+ *   &returns: The exponent.
+ */
+
+static int32_t ext_ref_long(long double val, char *buf)
+{
+	int n, r;
+	char str[64];
+
+	for(n = 1; n <= 21; n++) {
+		for(r = 0; r < 3; r++) {
+			fesetround(ext_modes[r]);
+			sprintf(str, "%.*Le", n - 1, val);
+			fesetround(FE_TONEAREST);
+
+			if(strtold(str, NULL) == val)
+				return ext_split(str, buf);
+		}
+	}
+
+	return buf[0] = '\0', 0;
+}
+
+/**
+ * Strip the trailing zeros of digits and compare them with a reference.
+ *   @buf: The digits.
+ *   @exp: The exponent.
+ *   @ref: The reference digits, without trailing zeros.
+ *   @rexp: The reference exponent.
+ *   &returns: True if they match.
+ */
+
+static bool ext_match(char *buf, int32_t exp, const char *ref, int32_t rexp)
+{
+	int n = strlen(buf);
+
+	while((n > 1) && (buf[n - 1] == '0'))
+		buf[--n] = '\0';
+
+	return (strcmp(buf, ref) == 0) && (exp == rexp);
+}
+
+/**
+ * Check 'errol_long' and 'errol_long_exact' on a value against the brute
+ * force search.
+ *   @val: The value, positive and finite.
+ */
+
+static void chk_long_one(long double val)
+{
+	int32_t exp, rexp;
+	char buf[64], ref[64];
+
+	rexp = ext_ref_long(val, ref);
+
+	nchk += 2;
+	exp = errol_long(val, buf);
+	if(!ext_match(buf, exp, ref, rexp))
+		nfail++, fprintf(stderr, "Errol: Extended mismatch. Input '%.21Le'. Expected '%se%d'. Actual '%se%d'.\n", val, ref, rexp, buf, exp);
+
+	exp = errol_long_exact(val, buf);
+	if(!ext_match(buf, exp, ref, rexp))
+		nfail++, fprintf(stderr, "Errol: Extended exact mismatch. Input '%.21Le'. Expected '%se%d'. Actual '%se%d'.\n", val, ref, rexp, buf, exp);
+}
+
+/**
+ * Create an x87 extended double from its parts.
+ *   @m: The mantissa, with the explicit integer bit.
+ *   @e: The biased exponent.
+ *   &returns: The value.
+ */
+
+static long double ext_long(uint64_t m, uint16_t e)
+{
+	union { long double d; struct { uint64_t m; uint16_t e; } i; } bits;
+
+	memset(&bits, 0, sizeof(bits));
+	bits.i.m = m;
+	bits.i.e = e;
+
+	return bits.d;
+}
+
+/**
+ * Create a random 64-bit value.
+ *   &returns: The value.
+ */
+
+static uint64_t rand64(void)
+{
+	return ((uint64_t)rand() << 62) ^ ((uint64_t)rand() << 31) ^ (uint64_t)rand();
+}
+
+#ifdef __SIZEOF_FLOAT128__
+
+/**
+ * Find the shortest digits that read back to a binary128 value, and among
+ * them the nearest, as 'ext_ref_long'.
+ *   @val: The value, positive and finite.
+ *   @buf: The output digits.
+ *   &returns: The exponent.
+ */
+
+static int32_t ext_ref_quad(__float128 val, char *buf)
+{
+	int n, r;
+	char str[64];
+
+	for(n = 1; n <= 36; n++) {
+		for(r = 0; r < 3; r++) {
+			fesetround(ext_modes[r]);
+			quadmath_snprintf(str, sizeof(str), "%.*Qe", n - 1, val);
+			fesetround(FE_TONEAREST);
+
+			if(strtoflt128(str, NULL) == val)
+				return ext_split(str, buf);
+		}
+	}
+
+	return buf[0] = '\0', 0;
+}
+
+/**
+ * Check 'errol_quad' and 'errol_quad_exact' on a value against the brute
+ * force search.
+ *   @val: The value, positive and finite.
+ */
+
+static void chk_quad_one(__float128 val)
+{
+	int32_t exp, rexp;
+	char buf[64], ref[64], str[64];
+
+	rexp = ext_ref_quad(val, ref);
+
+	nchk += 2;
+	exp = errol_quad(val, buf);
+	if(!ext_match(buf, exp, ref, rexp)) {
+		quadmath_snprintf(str, sizeof(str), "%.36Qe", val);
+		nfail++, fprintf(stderr, "Errol: Quad mismatch. Input '%s'. Expected '%se%d'. Actual '%se%d'.\n", str, ref, rexp, buf, exp);
+	}
+
+	exp = errol_quad_exact(val, buf);
+	if(!ext_match(buf, exp, ref, rexp)) {
+		quadmath_snprintf(str, sizeof(str), "%.36Qe", val);
+		nfail++, fprintf(stderr, "Errol: Quad exact mismatch. Input '%s'. Expected '%se%d'. Actual '%se%d'.\n", str, ref, rexp, buf, exp);
+	}
+}
+
+/**
+ * Create a binary128 value from its parts.
+ *   @m: The fraction bits, below 2^112.
+ *   @e: The biased exponent.
+ *   &returns: The value.
+ */
+
+static __float128 ext_quad(__uint128_t m, uint16_t e)
+{
+	union { __float128 d; __uint128_t i; } bits;
+
+	bits.i = ((__uint128_t)e << 112) | m;
+
+	return bits.d;
+}
+
+#endif
+
+
+/**
+ * Check 'errol_long' and 'errol_quad' against a brute force search over
+ * the lengths of '%.*Le' and '%.*Qe', reading back with 'strtold' and
+ * 'strtoflt128': random normals, subnormals and powers of two, whose lower
+ * gap is half the upper one, and the neighbours of short decimals, which
+ * the fast path defers to 'ext_exact'. The exact forms check 'ext_exact'
+ * on every input.
+ *   &returns: The error code.
+ */
+
+int chk_ext(void)
+{
+	int i;
+	unsigned int fail = 0;
+
+	srand(CHK_SEED);
+	nchk = nfail = 0;
+
+	for(i = 0; i < CHK_COUNT / 10; i++)
+		chk_long_one(ext_long(rand64() | ((uint64_t)1 << 63), 1 + rand() % 0x7FFE));
+
+	fail += chk_tally("extended random");
+
+	for(i = 0; i < CHK_COUNT / 10; i++)
+		chk_long_one(ext_long((rand64() >> (1 + rand() % 63)) | 1, 0));
+
+	fail += chk_tally("extended subnormal");
+
+	for(i = 1; i < 0x7FFF; i += 1 + rand() % 8)
+		chk_long_one(ext_long((uint64_t)1 << 63, i));
+
+	fail += chk_tally("extended powers of two");
+
+	/* short decimals and their neighbours defer to 'ext_exact' in the fast path */
+
+	for(i = 0; i < CHK_COUNT / 10; i++) {
+		char str[64];
+		long double val;
+
+		sprintf(str, "%de%d", rand() % 100000, rand() % 9800 - 4900);
+		val = strtold(str, NULL);
+		if((val == 0.0) || !isfinite(val))
+			continue;
+
+		chk_long_one(val);
+		chk_long_one(nextafterl(val, 0.0));
+		chk_long_one(nextafterl(val, INFINITY));
+	}
+
+	fail += chk_tally("extended near decimals");
+
+#ifdef __SIZEOF_FLOAT128__
+	__uint128_t mask = ((__uint128_t)1 << 112) - 1;
+
+	for(i = 0; i < CHK_COUNT / 10; i++)
+		chk_quad_one(ext_quad((((__uint128_t)rand64() << 64) | rand64()) & mask, 1 + rand() % 0x7FFE));
+
+	fail += chk_tally("quad random");
+
+	for(i = 0; i < CHK_COUNT / 10; i++)
+		chk_quad_one(ext_quad(((((__uint128_t)rand64() << 64) | rand64()) & mask) >> (rand() % 112) | 1, 0));
+
+	fail += chk_tally("quad subnormal");
+
+	for(i = 1; i < 0x7FFF; i += 1 + rand() % 8)
+		chk_quad_one(ext_quad(0, i));
+
+	fail += chk_tally("quad powers of two");
+
+	for(i = 0; i < CHK_COUNT / 10; i++) {
+		char str[64];
+		__float128 val;
+
+		sprintf(str, "%de%d", rand() % 100000, rand() % 9800 - 4900);
+		val = strtoflt128(str, NULL);
+		if((val == 0.0) || isinfq(val))
+			continue;
+
+		chk_quad_one(val);
+		chk_quad_one(nextafterq(val, 0.0));
+		chk_quad_one(nextafterq(val, FLT128_MAX));
+	}
+
+	fail += chk_tally("quad near decimals");
+#endif
+
+	return (fail > 0) ? 1 : 0;
+}
+
+
+/**
+ * Check 'errol_strtod' on a decimal against libc's 'strtod'.
+ *   @digits: The digits.
+ *   @exp: The decimal exponent of the last digit.
+ */
+
+static void chk_strtod_one(const char *digits, int32_t exp)
+{
+	static char str[4096];
+	int len = strlen(digits);
+	double ref, val;
+
+	snprintf(str, sizeof(str), "%se%d", digits, exp);
+	ref = strtod(str, NULL);
+	val = errol_strtod(digits, len, exp);
+
+	nchk++;
+	if(memcmp(&ref, &val, sizeof(double)) != 0)
+		nfail++, fprintf(stderr, "Errol: Strtod mismatch. Input '%.40s', %d digits, exponent %d. Expected '%.17e'. Actual '%.17e'.\n", digits, len, exp, ref, val);
+}
+
+/**
+ * Check 'errol_strtod' on the midpoint between two neighbouring doubles, and
+ * just below and above it: cut by one digit, with a trailing one, and past
+ * 'ERROL_STRTOD_DIGITS' with a long run of zeros or nines.
+ *   @low: The lower double.
+ *   @high: The higher double, or infinity above 'DBL_MAX'.
+ */
+
+static void chk_strtod_mid(double low, double high)
+{
+	static char buf[4096];
+	int32_t exp;
+	int len;
+	long double mid;
+
+	/* a midpoint has at most 767 digits, and fits an extended double exactly */
+
+	mid = isinf(high) ? ((long double)low + ldexpl(1.0L, 970)) : (((long double)low + high) / 2);
+	exp = ext_split_long(mid, buf);
+	len = strlen(buf);
+	exp -= len;
+
+	chk_strtod_one(buf, exp);
+
+	buf[len] = '1', buf[len + 1] = '\0';
+	chk_strtod_one(buf, exp - 1);
+
+	memset(buf + len, '0', 1000);
+	buf[len + 1000] = '1', buf[len + 1001] = '\0';
+	chk_strtod_one(buf, exp - 1001);
+
+	buf[len - 1]--;
+	memset(buf + len, '9', 1000);
+	buf[len + 1000] = '\0';
+	chk_strtod_one(buf, exp - 1000);
+
+	buf[len - 1] = '\0';
+	chk_strtod_one(buf, exp + 1);
+}
+
+/**
+ * Create a random digit string.
+ *   @buf: The output buffer.
+ *   @len: The number of digits.
+ */
+
+static void rand_digits(char *buf, int len)
+{
+	int i;
+
+	for(i = 0; i < len; i++)
+		buf[i] = '0' + rand() % 10;
+
+	buf[0] = '1' + rand() % 9;
+	buf[len] = '\0';
+}
+
+
+/**
+ * Check 'errol_strtod' against libc's 'strtod': the 17 digits of random
+ * doubles; random digit strings past 19 digits and past
+ * 'ERROL_STRTOD_DIGITS'; the midpoints between random doubles and just
+ * below every power of two, where the ties depend on 'ERROL_STRTOD_TOL' and
+ * 'errol_strtod_exact'; and the overflow edge at 'DBL_MAX' and the
+ * underflow edge below the least subnormal.
+ *   &returns: The error code.
+ */
+
+int chk_strtod(void)
+{
+	int i, k, len;
+	double val;
+	char buf[2048], str[64];
+	unsigned int fail = 0;
+
+	srand(CHK_SEED);
+	nchk = nfail = 0;
+
+	for(i = 0; i < CHK_COUNT; i++) {
+		sprintf(str, "%.16e", randval());
+		k = ext_split(str, buf);
+		chk_strtod_one(buf, k - strlen(buf));
+	}
+
+	fail += chk_tally("random");
+
+	for(i = 0; i < CHK_COUNT; i++) {
+		len = 20 + rand() % 40;
+		rand_digits(buf, len);
+		chk_strtod_one(buf, rand() % 660 - 345 - len);
+	}
+
+	for(i = 0; i < CHK_COUNT / 10; i++) {
+		len = 700 + rand() % 1000;
+		rand_digits(buf, len);
+		chk_strtod_one(buf, rand() % 660 - 345 - len);
+	}
+
+	fail += chk_tally("long");
+
+	for(i = 0; i < CHK_COUNT / 10; i++) {
+		val = (i % 4) ? randval() : randsub();
+		if(val != DBL_MAX)
+			chk_strtod_mid(val, nextafter(val, INFINITY));
+	}
+
+	for(k = -1073; k <= 1023; k++)
+		chk_strtod_mid(nextafter(ldexp(1.0, k), 0.0), ldexp(1.0, k));
+
+	fail += chk_tally("midpoints");
+
+	chk_strtod_mid(nextafter(DBL_MAX, 0.0), DBL_MAX);
+	chk_strtod_mid(DBL_MAX, INFINITY);
+	chk_strtod_one("17976931348623157", 292);
+	chk_strtod_one("17976931348623158", 292);
+	chk_strtod_one("17976931348623159", 292);
+	chk_strtod_one("1", 309);
+	chk_strtod_one("1", 308);
+
+	chk_strtod_mid(0.0, nextafter(0.0, 1.0));
+	chk_strtod_mid(nextafter(0.0, 1.0), nextafter(nextafter(0.0, 1.0), 1.0));
+	chk_strtod_mid(nextafter(DBL_MIN, 0.0), DBL_MIN);
+	chk_strtod_mid(DBL_MIN, nextafter(DBL_MIN, 1.0));
+	chk_strtod_one("2", -324);
+	chk_strtod_one("3", -324);
+	chk_strtod_one("1", -324);
+	chk_strtod_one("1", -325);
+	chk_strtod_one("24703282292062328", -340);
+
+	fail += chk_tally("edges");
+
+	return (fail > 0) ? 1 : 0;
+}
+
+
+/**
+ * Check 'errol_roundtrip' on a value against 'errol_precision' with 17
+ * digits.
+ *   @val: The value, non-negative and finite.
+ */
+
+static void chk_roundtrip_one(double val)
+{
+	int32_t exp, rexp;
+	char buf[32], ref[32];
+
+	exp = errol_roundtrip(val, buf);
+	rexp = errol_precision(val, 17, ref);
+
+	nchk++;
+	if((strcmp(buf, ref) != 0) || (exp != rexp))
+		nfail++, fprintf(stderr, "Errol: Roundtrip mismatch. Input '%.17e'. Expected '%se%d'. Actual '%se%d'.\n", val, ref, rexp, buf, exp);
+}
+
+/**
+ * Check 'errol_roundtrip' against 'errol_precision' with 17 digits: random
+ * values, subnormals and integers; each power of ten and its neighbours,
+ * whose scaled product may fall below 10^16; and the values with exactly
+ * 18 significant digits, the last a five, with their neighbours, which lie
+ * on or near a tie and take the fallback.
+ *   &returns: The error code.
+ */
+
+int chk_roundtrip(void)
+{
+	int i, j, k;
+	uint64_t lo, hi, odd;
+	double val, pow;
+	char str[16];
+	unsigned int fail = 0;
+
+	srand(CHK_SEED);
+	nchk = nfail = 0;
+
+	for(i = 0; i < CHK_COUNT; i++)
+		chk_roundtrip_one(randval());
+
+	for(i = 0; i < CHK_COUNT / 10; i++)
+		chk_roundtrip_one(randsub());
+
+	for(i = 0; i < CHK_COUNT / 10; i++)
+		chk_roundtrip_one((double)(rand64() >> (rand() % 64)));
+
+	chk_roundtrip_one(0.0);
+
+	fail += chk_tally("random");
+
+	for(k = -323; k <= 308; k++) {
+		sprintf(str, "1e%d", k);
+		pow = strtod(str, NULL);
+
+		chk_roundtrip_one(pow);
+		chk_roundtrip_one(nextafter(pow, 0.0));
+		if(k < 308)
+			chk_roundtrip_one(nextafter(pow, INFINITY));
+	}
+
+	fail += chk_tally("powers of ten");
+
+	/* an odd multiple of 2^-j has 18 digits when the odd factor times 5^j does */
+
+	for(i = 0; i < CHK_COUNT / 10; i++) {
+		j = 2 + rand() % 24;
+		for(lo = 100000000000000000ull, hi = 1000000000000000000ull, k = 0; k < j; k++)
+			lo = (lo + 4) / 5, hi /= 5;
+
+		if(hi > (uint64_t)1 << 53)
+			hi = (uint64_t)1 << 53;
+
+		odd = (lo + rand64() % (hi - lo)) | 1;
+		val = ldexp((double)odd, -j);
+
+		chk_roundtrip_one(val);
+		chk_roundtrip_one(nextafter(val, 0.0));
+		chk_roundtrip_one(nextafter(val, INFINITY));
+	}
+
+	fail += chk_tally("ties");
+
+	return (fail > 0) ? 1 : 0;
+}
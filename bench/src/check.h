@@ -0,0 +1,25 @@
+#ifndef CHECK_H
+#define CHECK_H
+
+/**
+ * Conversion check definitions.
+ *   @CHK_SEED: The seed used to generate the inputs.
+ *   @CHK_COUNT: The number of random inputs per kind of check.
+ *   @CHK_DIGITS: The most digits requested from the random inputs.
+ */
+
+#define CHK_SEED	20151
+#define CHK_COUNT	(100 * 1000)
+#define CHK_DIGITS	40
+
+
+/*
+ * conversion check function declarations
+ */
+
+int chk_prec(void);
+int chk_ext(void);
+int chk_strtod(void);
+int chk_roundtrip(void);
+
+#endif
@@ -24,6 +24,25 @@ static void op_add(unsigned int *val, unsigned int add, bool *c);
 static void op_sub(unsigned int *val, unsigned int sub, bool *c);
 static void op_rev(unsigned int *val, unsigned int sub, bool *c);
 
+static unsigned int limb_len(const uint64_t *arr, unsigned int len);
+static int limb_cmp(const uint64_t *left, unsigned int llen, const uint64_t *right, unsigned int rlen);
+static bool limb_add(uint64_t *out, const uint64_t *left, unsigned int llen, const uint64_t *right, unsigned int rlen);
+static void limb_sub(uint64_t *out, const uint64_t *left, unsigned int llen, const uint64_t *right, unsigned int rlen);
+static unsigned int limb_mul(uint64_t *out, const uint64_t *left, unsigned int llen, const uint64_t *right, unsigned int rlen);
+static unsigned int limb_mul_uint(uint64_t *arr, unsigned int len, unsigned int val);
+static unsigned int limb_barrett(uint64_t *out, const uint64_t *in, unsigned int len, const struct fixint_mod_t *red);
+
+static void fix_add(struct fixint_t *fix, const struct fixint_t *val, bool neg);
+static void fix_overflow();
+
+
+/*
+ * fixed-width integer definitions
+ *   @FIXINT_WIDE: The number of limbs needed to hold a double-width product.
+ */
+
+#define FIXINT_WIDE	(2 * FIXINT_LEN + 4)
+
 
 /**
  * Create a zero integer.
@@ -270,6 +289,52 @@ unsigned short integer_div_ushort(struct integer_t **integer, unsigned short val
 }
 
 
+/**
+ * Shift the integer left by a number of bits.
+ *   @integer: The integer.
+ *   @shift: The shift amount.
+ */
+
+void integer_shl(struct integer_t **integer, unsigned int shift)
+{
+	unsigned int i, len, top, words = shift / 32, bits = shift % 32;
+	unsigned int *arr;
+
+	if(integer_iszero(*integer))
+		return;
+
+	len = (*integer)->len;
+	*integer = realloc(*integer, sizeof(struct integer_t) + (len + words + 1) * sizeof(unsigned int));
+	arr = (*integer)->arr;
+
+	top = (bits > 0) ? (arr[len - 1] >> (32 - bits)) : 0;
+	for(i = len - 1; i > 0; i--)
+		arr[i + words] = (arr[i] << bits) | ((bits > 0) ? (arr[i - 1] >> (32 - bits)) : 0);
+
+	arr[words] = arr[0] << bits;
+	for(i = 0; i < words; i++)
+		arr[i] = 0;
+
+	arr[len + words] = top;
+	(*integer)->len = len + words + 1;
+	op_shrink(integer);
+}
+
+/**
+ * Retrieve the number of significant bits of the integer.
+ *   @integer: The integer.
+ *   &returns: The bit length, zero for zero.
+ */
+
+unsigned int integer_bits(const struct integer_t *integer)
+{
+	if(integer_iszero(integer))
+		return 0;
+
+	return 32 * integer->len - __builtin_clz(integer->arr[integer->len - 1]);
+}
+
+
 /**
  * Compare two integer.
  *   @left: The left integer.
@@ -322,6 +387,28 @@ void integer_print(const struct integer_t *integer, FILE *file)
 	fwrite(str+1, sizeof(buf) - (str - buf + 1), 1, file);
 }
 
+/**
+ * Print a fixed-width integer to the output.
+ *   @fix: The fixed-width integer.
+ *   @file: The file.
+ */
+
+void fixint_print(const struct fixint_t *fix, FILE *file)
+{
+	struct fixint_t copy;
+	char *str, buf[20 * FIXINT_LEN + 2];
+
+	str = buf + sizeof(buf) - 1;
+
+	copy = *fix;
+
+	while(!fixint_iszero(&copy))
+		*str-- = '0' + fixint_div_uint(&copy, 10);
+
+	*str-- = (fix->neg ? '-' : '+');
+	fwrite(str+1, sizeof(buf) - (str - buf + 1), 1, file);
+}
+
 /**
  * Print formatted text, including arbitrary size integer.
  *   @format: The format string.
@@ -340,6 +427,8 @@ void integer_printf(const char *restrict format, ...)
 
 			if(*format == 'I')
 				integer_print(va_arg(args, struct integer_t *), stdout);
+			else if(*format == 'F')
+				fixint_print(va_arg(args, struct fixint_t *), stdout);
 			else if(*format == 'u')
 				vfprintf(stdout, "%u", args);
 			else if(*format == 'l')
@@ -486,3 +575,451 @@ struct integer_t *integer_pow_mod(unsigned short base, unsigned short pow, struc
 
 	return v;
 }
+
+
+/**
+ * Set a fixed-width integer from a native value.
+ *   @fix: The fixed-width integer.
+ *   @val: The native value.
+ */
+
+void fixint_set(struct fixint_t *fix, int val)
+{
+	fix->neg = (val < 0);
+	fix->arr[0] = (val < 0) ? -(uint64_t)(int64_t)val : (uint64_t)val;
+	fix->len = (val != 0) ? 1 : 0;
+}
+
+/**
+ * Add a fixed-width integer to a base fixed-width integer, in place.
+ *   @fix: The base fixed-width integer.
+ *   @val: The value to add.
+ */
+
+void fixint_add(struct fixint_t *fix, const struct fixint_t *val)
+{
+	fix_add(fix, val, val->neg);
+}
+
+/**
+ * Subtract a fixed-width integer from a base fixed-width integer, in place.
+ *   @fix: The base fixed-width integer.
+ *   @val: The value to subtract.
+ */
+
+void fixint_sub(struct fixint_t *fix, const struct fixint_t *val)
+{
+	fix_add(fix, val, !val->neg);
+}
+
+/**
+ * Multiply the fixed-width integer by an unsigned integer.
+ *   @fix: The fixed-width integer.
+ *   @val: The value to multiply.
+ */
+
+void fixint_mul_uint(struct fixint_t *fix, unsigned int val)
+{
+	uint64_t tmp[FIXINT_LEN + 1];
+
+	memcpy(tmp, fix->arr, fix->len * sizeof(uint64_t));
+	fix->len = limb_mul_uint(tmp, fix->len, val);
+	if(fix->len > FIXINT_LEN)
+		fix_overflow();
+
+	memcpy(fix->arr, tmp, fix->len * sizeof(uint64_t));
+	if(fix->len == 0)
+		fix->neg = false;
+}
+
+/**
+ * Divide the fixed-width integer by an unsigned integer.
+ *   @fix: The fixed-width integer.
+ *   @val: The value to divide.
+ *   &returns: The remainder.
+ */
+
+unsigned int fixint_div_uint(struct fixint_t *fix, unsigned int val)
+{
+	unsigned int i;
+	unsigned __int128 rem = 0;
+
+	for(i = fix->len - 1; i != UINT_MAX; i--) {
+		rem = (rem << 64) | fix->arr[i];
+		fix->arr[i] = rem / val;
+		rem %= val;
+	}
+
+	fix->len = limb_len(fix->arr, fix->len);
+	if(fix->len == 0)
+		fix->neg = false;
+
+	return rem;
+}
+
+/**
+ * Compare the magnitudes of two fixed-width integers.
+ *   @left: The left fixed-width integer.
+ *   @right: The right fixed-width integer.
+ *   &returns: Their order.
+ */
+
+int fixint_cmp(const struct fixint_t *left, const struct fixint_t *right)
+{
+	return limb_cmp(left->arr, left->len, right->arr, right->len);
+}
+
+/**
+ * Compute a power into a fixed-width integer.
+ *   @fix: The output fixed-width integer.
+ *   @base: The base.
+ *   @pow: The power.
+ */
+
+void fixint_pow(struct fixint_t *fix, unsigned short base, unsigned short pow)
+{
+	fixint_set(fix, 1);
+
+	while(pow-- > 0)
+		fixint_mul_uint(fix, base);
+}
+
+
+/**
+ * Initialize a Barrett reducer for a positive modulus.
+ *   @red: The uninitialized reducer.
+ *   @mod: The modulus.
+ */
+
+void fixint_mod_init(struct fixint_mod_t *red, const struct fixint_t *mod)
+{
+	int i;
+	unsigned int k, rlen;
+	uint64_t rem[FIXINT_LEN + 1];
+
+	red->mod = *mod;
+	red->mod.neg = false;
+
+	k = mod->len;
+	memset(red->mu, 0, sizeof(red->mu));
+
+	/* long division of 2^(128k) by the modulus, one bit at a time */
+
+	for(i = 128 * k, rlen = 0; i >= 0; i--) {
+		rlen = limb_mul_uint(rem, rlen, 2);
+		if(i == 128 * k)
+			rem[0] |= 1, rlen = (rlen > 0) ? rlen : 1;
+
+		if(limb_cmp(rem, rlen, mod->arr, k) >= 0) {
+			limb_sub(rem, rem, rlen, mod->arr, k);
+			rlen = limb_len(rem, rlen);
+			red->mu[i / 64] |= (uint64_t)1 << (i % 64);
+		}
+	}
+
+	red->mulen = limb_len(red->mu, FIXINT_LEN + 2);
+}
+
+/**
+ * Reduce the magnitude of a fixed-width integer by the reducer modulus. The
+ * sign is preserved, matching the C remainder operator.
+ *   @fix: The fixed-width integer.
+ *   @red: The reducer.
+ */
+
+void fixint_mod(struct fixint_t *fix, const struct fixint_mod_t *red)
+{
+	unsigned int i, len;
+	uint64_t tmp[FIXINT_WIDE];
+
+	if(fix->len <= 2 * red->mod.len)
+		len = limb_barrett(tmp, fix->arr, fix->len, red);
+	else {
+		for(i = fix->len - 1, len = 0; i != UINT_MAX; i--) {
+			memmove(tmp + 1, tmp, len * sizeof(uint64_t));
+			tmp[0] = fix->arr[i];
+			len = limb_barrett(tmp, tmp, limb_len(tmp, len + 1), red);
+		}
+	}
+
+	memcpy(fix->arr, tmp, len * sizeof(uint64_t));
+	fix->len = len;
+	if(fix->len == 0)
+		fix->neg = false;
+}
+
+/**
+ * Compute a modular power into a fixed-width integer using square and
+ * multiply with Barrett reduction.
+ *   @fix: The output fixed-width integer.
+ *   @base: The base.
+ *   @pow: The power.
+ *   @red: The reducer.
+ */
+
+void fixint_pow_mod(struct fixint_t *fix, unsigned short base, unsigned short pow, const struct fixint_mod_t *red)
+{
+	int i;
+	unsigned int len;
+	uint64_t acc[FIXINT_WIDE], sq[FIXINT_WIDE];
+
+	acc[0] = 1;
+	len = limb_barrett(acc, acc, 1, red);
+
+	for(i = 8 * sizeof(unsigned short) - 1; i >= 0; i--) {
+		len = limb_mul(sq, acc, len, acc, len);
+		len = limb_barrett(acc, sq, len, red);
+
+		if(pow & (1 << i)) {
+			len = limb_mul_uint(acc, len, base);
+			len = limb_barrett(acc, acc, len, red);
+		}
+	}
+
+	fix->neg = false;
+	fix->len = len;
+	memcpy(fix->arr, acc, len * sizeof(uint64_t));
+}
+
+
+/**
+ * Add or subtract a magnitude to the fixed-width integer.
+ *   @fix: The base fixed-width integer.
+ *   @val: The value.
+ *   @neg: The sign to apply to the value.
+ */
+
+static void fix_add(struct fixint_t *fix, const struct fixint_t *val, bool neg)
+{
+	if(fix->neg == neg) {
+		if(val->len > fix->len)
+			memset(fix->arr + fix->len, 0, (val->len - fix->len) * sizeof(uint64_t));
+
+		fix->len = (val->len > fix->len) ? val->len : fix->len;
+		if(limb_add(fix->arr, fix->arr, fix->len, val->arr, val->len)) {
+			if(fix->len == FIXINT_LEN)
+				fix_overflow();
+
+			fix->arr[fix->len++] = 1;
+		}
+	}
+	else if(limb_cmp(fix->arr, fix->len, val->arr, val->len) >= 0) {
+		limb_sub(fix->arr, fix->arr, fix->len, val->arr, val->len);
+		fix->len = limb_len(fix->arr, fix->len);
+	}
+	else {
+		limb_sub(fix->arr, val->arr, val->len, fix->arr, fix->len);
+		fix->len = limb_len(fix->arr, val->len);
+		fix->neg = neg;
+	}
+
+	if(fix->len == 0)
+		fix->neg = false;
+}
+
+/**
+ * Abort on a fixed-width integer overflow.
+ */
+
+static void fix_overflow()
+{
+	fprintf(stderr, "Fixed-width integer overflow.\n");
+	abort();
+}
+
+
+/**
+ * Compute the normalized length of a limb array.
+ *   @arr: The limb array.
+ *   @len: The unnormalized length.
+ *   &returns: The length without leading zero limbs.
+ */
+
+static unsigned int limb_len(const uint64_t *arr, unsigned int len)
+{
+	while((len > 0) && (arr[len-1] == 0))
+		len--;
+
+	return len;
+}
+
+/**
+ * Compare two normalized limb arrays.
+ *   @left: The left array.
+ *   @llen: The left length.
+ *   @right: The right array.
+ *   @rlen: The right length.
+ *   &returns: Their order.
+ */
+
+static int limb_cmp(const uint64_t *left, unsigned int llen, const uint64_t *right, unsigned int rlen)
+{
+	unsigned int i;
+
+	if(llen > rlen)
+		return 2;
+	else if(llen < rlen)
+		return -2;
+
+	for(i = llen - 1; i != UINT_MAX; i--) {
+		if(left[i] > right[i])
+			return 1;
+		else if(left[i] < right[i])
+			return -1;
+	}
+
+	return 0;
+}
+
+/**
+ * Add two limb arrays, where the left array is at least as long as the
+ * right. The output may alias either input.
+ *   @out: The output array, 'llen' limbs long.
+ *   @left: The left array.
+ *   @llen: The left length.
+ *   @right: The right array.
+ *   @rlen: The right length.
+ *   &returns: The carry out of the top limb.
+ */
+
+static bool limb_add(uint64_t *out, const uint64_t *left, unsigned int llen, const uint64_t *right, unsigned int rlen)
+{
+	unsigned int i;
+	unsigned __int128 sum = 0;
+
+	for(i = 0; i < llen; i++) {
+		sum += left[i];
+		sum += (i < rlen) ? right[i] : 0;
+		out[i] = (uint64_t)sum;
+		sum >>= 64;
+	}
+
+	return sum != 0;
+}
+
+/**
+ * Subtract two limb arrays, where the left array is at least the right. The
+ * output may alias either input.
+ *   @out: The output array, 'llen' limbs long.
+ *   @left: The left array.
+ *   @llen: The left length.
+ *   @right: The right array.
+ *   @rlen: The right length.
+ */
+
+static void limb_sub(uint64_t *out, const uint64_t *left, unsigned int llen, const uint64_t *right, unsigned int rlen)
+{
+	unsigned int i;
+	uint64_t l, r, c = 0;
+
+	for(i = 0; i < llen; i++) {
+		l = left[i];
+		r = (i < rlen) ? right[i] : 0;
+		out[i] = l - r - c;
+		c = (l < r) || ((l == r) && c);
+	}
+}
+
+/**
+ * Multiply two limb arrays. The output must not alias either input.
+ *   @out: The output array, 'llen + rlen' limbs long.
+ *   @left: The left array.
+ *   @llen: The left length.
+ *   @right: The right array.
+ *   @rlen: The right length.
+ *   &returns: The normalized output length.
+ */
+
+static unsigned int limb_mul(uint64_t *out, const uint64_t *left, unsigned int llen, const uint64_t *right, unsigned int rlen)
+{
+	unsigned int i, j;
+	unsigned __int128 prod;
+
+	memset(out, 0, (llen + rlen) * sizeof(uint64_t));
+
+	for(i = 0; i < llen; i++) {
+		prod = 0;
+
+		for(j = 0; j < rlen; j++) {
+			prod += (unsigned __int128)left[i] * right[j] + out[i+j];
+			out[i+j] = (uint64_t)prod;
+			prod >>= 64;
+		}
+
+		out[i+rlen] = (uint64_t)prod;
+	}
+
+	return limb_len(out, llen + rlen);
+}
+
+/**
+ * Multiply a limb array by an unsigned integer, in place.
+ *   @arr: The array, with room for 'len + 1' limbs.
+ *   @len: The length.
+ *   @val: The value to multiply.
+ *   &returns: The normalized output length.
+ */
+
+static unsigned int limb_mul_uint(uint64_t *arr, unsigned int len, unsigned int val)
+{
+	unsigned int i;
+	unsigned __int128 prod = 0;
+
+	for(i = 0; i < len; i++) {
+		prod += (unsigned __int128)arr[i] * val;
+		arr[i] = (uint64_t)prod;
+		prod >>= 64;
+	}
+
+	arr[len] = (uint64_t)prod;
+
+	return limb_len(arr, len + 1);
+}
+
+/**
+ * Perform a Barrett reduction of a limb array. The input must be less than
+ * 2^(128k) for a 'k' limb modulus. The output may alias the input.
+ *   @out: The output array, at least 'k + 1' limbs long.
+ *   @in: The input array.
+ *   @len: The input length.
+ *   @red: The reducer.
+ *   &returns: The normalized output length.
+ */
+
+static unsigned int limb_barrett(uint64_t *out, const uint64_t *in, unsigned int len, const struct fixint_mod_t *red)
+{
+	unsigned int i, k = red->mod.len, qlen, plen;
+	uint64_t quot[FIXINT_WIDE], prod[FIXINT_WIDE], rem[FIXINT_LEN + 1];
+
+	if(limb_cmp(in, len, red->mod.arr, k) < 0) {
+		memmove(out, in, len * sizeof(uint64_t));
+
+		return len;
+	}
+
+	/* estimate the quotient, 'floor(floor(in / b^(k-1)) * mu / b^(k+1))' */
+
+	qlen = limb_mul(quot, in + (k - 1), len - (k - 1), red->mu, red->mulen);
+	qlen = (qlen > k + 1) ? qlen - (k + 1) : 0;
+	plen = limb_mul(prod, quot + (k + 1), qlen, red->mod.arr, k);
+
+	/* the remainder modulo b^(k+1) is off by at most two moduli */
+
+	for(i = 0; i <= k; i++)
+		rem[i] = (i < len) ? in[i] : 0;
+
+	for(i = plen; i <= k; i++)
+		prod[i] = 0;
+
+	limb_sub(rem, rem, k + 1, prod, k + 1);
+	plen = limb_len(rem, k + 1);
+
+	while(limb_cmp(rem, plen, red->mod.arr, k) >= 0) {
+		limb_sub(rem, rem, plen, red->mod.arr, k);
+		plen = limb_len(rem, plen);
+	}
+
+	memcpy(out, rem, plen * sizeof(uint64_t));
+
+	return plen;
+}
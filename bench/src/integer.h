@@ -28,6 +28,42 @@ struct integer_t {
 	unsigned int arr[];
 };
 
+/**
+ * Fixed-width integer definitions.
+ *   @FIXINT_LEN: The maximum number of 64-bit limbs, enough for 2^1280.
+ */
+
+#define FIXINT_LEN	20
+
+/**
+ * Fixed-width integer structure. Unlike 'integer_t', the limbs are stored
+ * inline so that the integer may live on the stack and be modified in place.
+ *   @neg: Negative flag.
+ *   @len: The length.
+ *   @arr: The array.
+ */
+
+struct fixint_t {
+	bool neg;
+	unsigned int len;
+
+	uint64_t arr[FIXINT_LEN];
+};
+
+/**
+ * Barrett reducer structure.
+ *   @mod: The modulus.
+ *   @mu: The reciprocal, 'floor(2^(128*len) / mod)'.
+ *   @mulen: The reciprocal length.
+ */
+
+struct fixint_mod_t {
+	struct fixint_t mod;
+
+	unsigned int mulen;
+	uint64_t mu[FIXINT_LEN + 2];
+};
+
 
 /*
  * integer function declarations
@@ -48,6 +84,9 @@ void integer_mul_ushort(struct integer_t **integer, unsigned short val);
 
 unsigned short integer_div_ushort(struct integer_t **integer, unsigned short val);
 
+void integer_shl(struct integer_t **integer, unsigned int shift);
+unsigned int integer_bits(const struct integer_t *integer);
+
 int integer_cmp(const struct integer_t *left, const struct integer_t *right);
 
 void integer_print(const struct integer_t *integer, FILE *file);
@@ -58,6 +97,19 @@ struct integer_t *integer_pow_ushort(unsigned short base, unsigned short pow);
 void integer_mod(struct integer_t **integer, struct integer_t *mod);
 struct integer_t *integer_pow_mod(unsigned short base, unsigned short pow, struct integer_t *mod);
 
+void fixint_set(struct fixint_t *fix, int val);
+void fixint_add(struct fixint_t *fix, const struct fixint_t *val);
+void fixint_sub(struct fixint_t *fix, const struct fixint_t *val);
+void fixint_mul_uint(struct fixint_t *fix, unsigned int val);
+unsigned int fixint_div_uint(struct fixint_t *fix, unsigned int val);
+int fixint_cmp(const struct fixint_t *left, const struct fixint_t *right);
+void fixint_print(const struct fixint_t *fix, FILE *file);
+void fixint_pow(struct fixint_t *fix, unsigned short base, unsigned short pow);
+
+void fixint_mod_init(struct fixint_mod_t *red, const struct fixint_t *mod);
+void fixint_mod(struct fixint_t *fix, const struct fixint_mod_t *red);
+void fixint_pow_mod(struct fixint_t *fix, unsigned short base, unsigned short pow, const struct fixint_mod_t *red);
+
 #define iprintf integer_printf
 
 /**
@@ -71,6 +123,17 @@ static inline bool integer_iszero(const struct integer_t *integer)
 	return integer->len == 0;
 }
 
+/**
+ * Test if a fixed-width integer is zero.
+ *   @fix: The fixed-width integer.
+ *   &returns: True if zero, false otherwise.
+ */
+
+static inline bool fixint_iszero(const struct fixint_t *fix)
+{
+	return fix->len == 0;
+}
+
 #ifdef __cplusplus
 }
 #endif
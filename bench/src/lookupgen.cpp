@@ -0,0 +1,797 @@
+#define restrict __restrict
+#include <string.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <math.h>
+#include "integer.h"
+
+/*
+ * The committed tables, compiled in for checking.
+ */
+
+struct hp_t { double val, err; };
+
+#include "../../errol/src/lookup.h"
+#include "../../errol/src/errol.hpp"
+
+
+/**
+ * Exact rational structure, holding 'num / den * 2^exp'.
+ *   @neg: Negative flag.
+ *   @num: The numerator.
+ *   @den: The denominator.
+ *   @exp: The binary exponent.
+ */
+
+struct rat_t {
+	bool neg;
+	struct integer_t *num, *den;
+	int32_t exp;
+};
+
+/**
+ * Rounded mantissa structure, holding '(-1)^neg * word * 2^exp' with the
+ * least significant word first.
+ *   @neg: Negative flag.
+ *   @word: The mantissa words.
+ *   @exp: The binary exponent.
+ */
+
+#define MANT_WORDS	4
+
+struct mant_t {
+	bool neg;
+	uint64_t word[MANT_WORDS];
+	int32_t exp;
+};
+
+/**
+ * Rounding modes.
+ *   @ROUND_NEAR: Round to nearest, ties to even.
+ *   @ROUND_UP: Round towards positive infinity.
+ */
+
+enum round_e { ROUND_NEAR, ROUND_UP };
+
+/**
+ * Output format structure.
+ *   @name: The format name.
+ *   @prec: The mantissa precision in bits.
+ *   @emin: The exponent of the smallest subnormal.
+ *   @digits: The significant digits printed for the residual.
+ *   @suffix: The literal suffix.
+ */
+
+struct fmt_t {
+	const char *name;
+	int32_t prec, emin;
+	int digits;
+	const char *suffix;
+};
+
+static const struct fmt_t fmt_list[] = {
+	{ "float",	24,	-149,	9,	"f" },
+	{ "double",	53,	-1074,	19,	"" },
+	{ "ldouble",	64,	-16445,	21,	"l" },
+	{ NULL,		0,	0,	0,	NULL }
+};
+
+/**
+ * Table ranges of the committed header.
+ *   @GEN_TABLE_MAX: The largest power in 'lookup_table'.
+ *   @GEN_TABLE_LEN: The number of entries in 'lookup_table'.
+ *   @GEN_EXP_MIN: The smallest binary exponent in 'lookup_exp'.
+ *   @GEN_EXP_LEN: The number of entries in 'lookup_exp'.
+ *   @GEN_THR_MIN: The smallest lookup index in 'lookup_thr'.
+ *   @GEN_THR_LEN: The number of entries in 'lookup_thr'.
+ *   @GEN_EXT_BITS: The extended mantissa width.
+ *   @GEN_EXT_STEP: The extended table granularity.
+ *   @GEN_EXT_MIN: The smallest extended table index.
+ *   @GEN_EXT_LEN: The number of entries in 'lookup_ext'.
+ *   @GEN_COMPACT_STEP: The compact table granularity.
+ *   @GEN_COMPACT_OFF: The negated smallest compact table power.
+ *   @GEN_COMPACT_LEN: The number of entries in 'lookup_compact'.
+ */
+
+#define GEN_TABLE_MAX	308
+#define GEN_TABLE_LEN	600
+#define GEN_EXP_MIN	-1073
+#define GEN_EXP_LEN	2098
+#define GEN_THR_MIN	-15
+#define GEN_THR_LEN	632
+#define GEN_EXT_BITS	192
+#define GEN_EXT_STEP	64
+#define GEN_EXT_MIN	-78
+#define GEN_EXT_LEN	156
+#define GEN_COMPACT_STEP	8
+#define GEN_COMPACT_OFF	291
+#define GEN_COMPACT_LEN	75
+
+
+/**
+ * Create the rational '10^pow'.
+ *   @rat: Out. The rational.
+ *   @pow: The power.
+ */
+
+static void rat_pow10(struct rat_t *rat, int32_t pow)
+{
+	rat->neg = false;
+	rat->exp = 0;
+
+	if(pow >= 0) {
+		rat->num = integer_pow_ushort(10, pow);
+		rat->den = integer_new(1);
+	}
+	else {
+		rat->num = integer_new(1);
+		rat->den = integer_pow_ushort(10, -pow);
+	}
+}
+
+/**
+ * Delete a rational.
+ *   @rat: The rational.
+ */
+
+static void rat_delete(struct rat_t *rat)
+{
+	integer_delete(rat->num);
+	integer_delete(rat->den);
+}
+
+/**
+ * Round a rational to a binary mantissa.
+ *   @val: The value.
+ *   @prec: The precision in bits, at most '64 * MANT_WORDS - 1'.
+ *   @emin: The smallest permitted exponent.
+ *   @mode: The rounding mode.
+ *   @out: Out. The rounded mantissa.
+ *   @res: Optional. Out. The exact residual, 'val - out'.
+ */
+
+static void rat_round(const struct rat_t *val, int32_t prec, int32_t emin, enum round_e mode, struct mant_t *out, struct rat_t *res)
+{
+	bool up;
+	int cmp;
+	int32_t i, exp;
+	struct integer_t *num, *den, *tmp;
+
+	exp = (int32_t)integer_bits(val->num) - (int32_t)integer_bits(val->den) + val->exp - prec;
+	if(exp < emin)
+		exp = emin;
+
+	/* long division, retrying once if the quotient overflows */
+
+	while(true) {
+		num = integer_copy(val->num);
+		den = integer_copy(val->den);
+		if(val->exp >= exp)
+			integer_shl(&num, val->exp - exp);
+		else
+			integer_shl(&den, exp - val->exp);
+
+		memset(out->word, 0, sizeof(out->word));
+		for(i = prec; i >= 0; i--) {
+			tmp = integer_copy(den);
+			integer_shl(&tmp, i);
+			if(integer_cmp(num, tmp) >= 0) {
+				integer_sub(&num, tmp);
+				out->word[i / 64] |= (uint64_t)1 << (i % 64);
+			}
+
+			integer_delete(tmp);
+		}
+
+		if(!(out->word[prec / 64] & ((uint64_t)1 << (prec % 64))))
+			break;
+
+		integer_delete(num);
+		integer_delete(den);
+		exp++;
+	}
+
+	/* round the quotient, turning the remainder into the residual */
+
+	tmp = integer_copy(num);
+	integer_shl(&tmp, 1);
+	cmp = integer_cmp(tmp, den);
+	integer_delete(tmp);
+
+	if(mode == ROUND_NEAR)
+		up = (cmp > 0) || ((cmp == 0) && (out->word[0] & 1));
+	else
+		up = !integer_iszero(num);
+
+	if(up) {
+		for(i = 0; (i < MANT_WORDS) && (++out->word[i] == 0); i++);
+
+		tmp = integer_copy(den);
+		integer_sub(&tmp, num);
+		integer_delete(num);
+		num = tmp;
+
+		if(out->word[prec / 64] & ((uint64_t)1 << (prec % 64))) {
+			for(i = 0; i < MANT_WORDS - 1; i++)
+				out->word[i] = (out->word[i] >> 1) | (out->word[i + 1] << 63);
+
+			out->word[i] >>= 1;
+			exp++;
+		}
+	}
+
+	out->neg = val->neg;
+	out->exp = exp;
+
+	if(res != NULL) {
+		res->neg = val->neg ^ up;
+		res->num = num;
+		res->den = den;
+		res->exp = exp;
+	}
+	else {
+		integer_delete(num);
+		integer_delete(den);
+	}
+}
+
+/**
+ * Convert a rounded mantissa of at most 64 bits to a native value.
+ *   @mant: The mantissa.
+ *   &returns: The value.
+ */
+
+static long double mant_native(const struct mant_t *mant)
+{
+	long double val;
+
+	val = ldexpl((long double)mant->word[0], mant->exp);
+
+	return mant->neg ? -val : val;
+}
+
+/**
+ * Compute the double-double pair for a power of ten: the correctly rounded
+ * power and the correctly rounded residual.
+ *   @fmt: The format.
+ *   @pow: The power.
+ *   @hi: Out. The rounded power.
+ *   @err: Out. The rounded residual.
+ */
+
+static void gen_pair(const struct fmt_t *fmt, int32_t pow, long double *hi, long double *err)
+{
+	struct rat_t val, res;
+	struct mant_t mant;
+
+	rat_pow10(&val, pow);
+	rat_round(&val, fmt->prec, fmt->emin, ROUND_NEAR, &mant, &res);
+	*hi = mant_native(&mant);
+	rat_delete(&val);
+
+	if(integer_iszero(res.num))
+		*err = 0.0;
+	else {
+		rat_round(&res, fmt->prec, fmt->emin, ROUND_NEAR, &mant, NULL);
+		*err = mant_native(&mant);
+	}
+
+	rat_delete(&res);
+}
+
+/**
+ * Compute the decade thresholds, the smallest doubles not less than each
+ * power of ten.
+ *   @thr: Out. The thresholds, 'GEN_THR_LEN' entries.
+ */
+
+static void gen_thr(double *thr)
+{
+	int32_t i;
+	struct rat_t val;
+	struct mant_t mant;
+
+	for(i = 0; i < GEN_THR_LEN; i++) {
+		rat_pow10(&val, i + GEN_THR_MIN - GEN_TABLE_MAX);
+		rat_round(&val, 53, -1074, ROUND_UP, &mant, NULL);
+		thr[i] = mant_native(&mant);
+		rat_delete(&val);
+	}
+}
+
+/**
+ * Compute the binade table from the thresholds. A double is not less than a
+ * power of ten exactly when it is not less than the threshold, so the lower
+ * decade of each binade is found by counting thresholds.
+ *   @thr: The thresholds.
+ *   @exp: Out. The binade table, 'GEN_EXP_LEN' entries.
+ */
+
+static void gen_exp(const double *thr, int16_t *exp)
+{
+	int32_t i, n = 0;
+	double low;
+
+	for(i = 0; i < GEN_EXP_LEN; i++) {
+		low = ldexp(1.0, i + GEN_EXP_MIN - 1);
+		while((n < GEN_THR_LEN) && (thr[n] <= low))
+			n++;
+
+		exp[i] = n + GEN_THR_MIN;
+	}
+}
+
+/**
+ * Compute an extended power of ten.
+ *   @bits: The mantissa width.
+ *   @pow: The power.
+ *   @mant: Out. The mantissa.
+ *   &returns: True if exact, false otherwise.
+ */
+
+static bool gen_ext(int32_t bits, int32_t pow, struct mant_t *mant)
+{
+	bool exact;
+	struct rat_t val, res;
+
+	rat_pow10(&val, pow);
+	rat_round(&val, bits, INT32_MIN / 2, ROUND_NEAR, mant, &res);
+	exact = integer_iszero(res.num);
+	rat_delete(&val);
+	rat_delete(&res);
+
+	return exact;
+}
+
+
+/**
+ * Print a double as its shortest round-trip representation, using fixed
+ * notation for moderate exponents.
+ *   @val: The value.
+ *   @file: The file.
+ */
+
+static void print_short(double val, FILE *file)
+{
+	int i, exp, len;
+	char sci[32], digs[20];
+
+	for(i = 0; i < 17; i++) {
+		sprintf(sci, "%.*e", i, val);
+		if(strtod(sci, NULL) == val)
+			break;
+	}
+
+	exp = atoi(strchr(sci, 'e') + 1);
+	if((exp < -4) || (exp >= 16)) {
+		fputs(sci, file);
+		return;
+	}
+
+	for(i = 0, len = 0; sci[i] != 'e'; i++) {
+		if(sci[i] != '.')
+			digs[len++] = sci[i];
+	}
+
+	if(exp < 0) {
+		fputs("0.", file);
+		for(i = exp + 1; i < 0; i++)
+			fputc('0', file);
+
+		fprintf(file, "%.*s", len, digs);
+	}
+	else if(len > exp + 1)
+		fprintf(file, "%.*s.%.*s", exp + 1, digs, len - exp - 1, digs + exp + 1);
+	else {
+		fprintf(file, "%.*s", len, digs);
+		for(i = len; i <= exp; i++)
+			fputc('0', file);
+
+		fputs(".0", file);
+	}
+}
+
+/**
+ * Print an extended table row.
+ *   @mant: The mantissa.
+ *   @bits: The mantissa width.
+ *   @file: The file.
+ */
+
+static void print_ext(const struct mant_t *mant, int32_t bits, FILE *file)
+{
+	int32_t i;
+
+	fprintf(file, "\t{ {");
+	for(i = bits / 64 - 1; i >= 0; i--)
+		fprintf(file, " 0x%016lxul%s", mant->word[i], (i > 0) ? "," : "");
+
+	fprintf(file, " }, %d },\n", mant->exp);
+}
+
+/**
+ * Print double-double rows for a range of powers of ten.
+ *   @fmt: The format.
+ *   @first: The first power.
+ *   @last: The last power.
+ *   @step: The signed power step.
+ *   @file: The file.
+ */
+
+static void print_pairs(const struct fmt_t *fmt, int32_t first, int32_t last, int32_t step, const char *indent, FILE *file)
+{
+	int32_t pow;
+	long double hi, err;
+
+	for(pow = first; (step > 0) ? (pow <= last) : (pow >= last); pow += step) {
+		gen_pair(fmt, pow, &hi, &err);
+		fprintf(file, "%s{ %Le%s,\t%.*Le%s },\n", indent, hi, fmt->suffix, fmt->digits - 1, err, fmt->suffix);
+	}
+}
+
+/**
+ * Print the complete Errol lookup header.
+ *   @file: The file.
+ */
+
+static void print_header(FILE *file)
+{
+	int32_t i;
+	double thr[GEN_THR_LEN];
+	int16_t exp[GEN_EXP_LEN];
+	struct mant_t mant;
+
+	fprintf(file, "/*\n"
+		" * Generated by 'bench/lookupgen'. Regenerate with 'lookupgen header' and\n"
+		" * verify with 'lookupgen check'; do not edit by hand.\n"
+		" */\n\n");
+
+	fprintf(file, "/**\n"
+		" * Power table, holding 10^(%d-i) as the nearest double and the nearest\n"
+		" * double to the residual.\n"
+		" */\n\n", GEN_TABLE_MAX);
+
+	fprintf(file, "#define LOOKUP_TABLE_LEN (sizeof(lookup_table) / (2 * sizeof(double)))\n");
+	fprintf(file, "struct hp_t lookup_table[] = {\n");
+	print_pairs(&fmt_list[1], GEN_TABLE_MAX, GEN_TABLE_MAX - GEN_TABLE_LEN + 1, -1, "\t", file);
+	fprintf(file, "};\n");
+
+	gen_thr(thr);
+	gen_exp(thr, exp);
+
+	fprintf(file, "\n\n/**\n"
+		" * Binary exponent table, holding the lookup index of the lower decade for\n"
+		" * each binade. Index by the binary exponent, as from 'frexp', plus\n"
+		" * 'LOOKUP_EXP_OFF'.\n"
+		" */\n\n");
+
+	fprintf(file, "#define LOOKUP_EXP_OFF %d\n", -GEN_EXP_MIN);
+	fprintf(file, "int16_t lookup_exp[] = {\n");
+	for(i = 0; i < GEN_EXP_LEN; i++)
+		fprintf(file, "%s%d,%s", (i % 16 == 0) ? "\t" : "", exp[i], ((i % 16 == 15) || (i == GEN_EXP_LEN - 1)) ? "\n" : " ");
+
+	fprintf(file, "};\n");
+
+	fprintf(file, "\n/**\n"
+		" * Decade threshold table, holding the smallest double not less than the\n"
+		" * power of ten ending each decade. Index by the lookup index plus\n"
+		" * 'LOOKUP_THR_OFF'.\n"
+		" */\n\n");
+
+	fprintf(file, "#define LOOKUP_THR_OFF %d\n", -GEN_THR_MIN);
+	fprintf(file, "double lookup_thr[] = {\n");
+	for(i = 0; i < GEN_THR_LEN; i++) {
+		fputc('\t', file);
+		print_short(thr[i], file);
+		fprintf(file, ",\n");
+	}
+
+	fprintf(file, "};\n");
+
+	fprintf(file, "\n/**\n"
+		" * Extended power table, holding 10^(%di) as a %d-bit mantissa, most\n"
+		" * significant word first, rounded to nearest. Index by 'i' plus\n"
+		" * 'LOOKUP_EXT_OFF'.\n"
+		" */\n\n", GEN_EXT_STEP, GEN_EXT_BITS);
+
+	fprintf(file, "#define LOOKUP_EXT_OFF %d\n", -GEN_EXT_MIN);
+	fprintf(file, "struct lookup_ext_t { uint64_t mant[%d]; int32_t exp; };\n\n", GEN_EXT_BITS / 64);
+	fprintf(file, "struct lookup_ext_t lookup_ext[] = {\n");
+	for(i = 0; i < GEN_EXT_LEN; i++) {
+		gen_ext(GEN_EXT_BITS, GEN_EXT_STEP * (i + GEN_EXT_MIN), &mant);
+		print_ext(&mant, GEN_EXT_BITS, file);
+	}
+
+	fprintf(file, "};\n");
+
+	fprintf(file, "\n/**\n"
+		" * Extended small power table, holding 10^i exactly as a %d-bit mantissa\n"
+		" * for 'i' below %d.\n"
+		" */\n\n", GEN_EXT_BITS, GEN_EXT_STEP);
+
+	fprintf(file, "struct lookup_ext_t lookup_ext_small[] = {\n");
+	for(i = 0; i < GEN_EXT_STEP; i++) {
+		gen_ext(GEN_EXT_BITS, i, &mant);
+		print_ext(&mant, GEN_EXT_BITS, file);
+	}
+
+	fprintf(file, "};\n");
+
+	fprintf(file, "\n/**\n"
+		" * Compact power table, holding 10^(%di-LOOKUP_COMPACT_OFF) as in\n"
+		" * 'lookup_table'. Rows in between are rebuilt by one multiply with\n"
+		" * 'lookup_compact_small', holding 10^i exactly for 'i' below %d.\n"
+		" */\n\n", GEN_COMPACT_STEP, GEN_COMPACT_STEP);
+
+	fprintf(file, "#define LOOKUP_COMPACT_STEP %d\n", GEN_COMPACT_STEP);
+	fprintf(file, "#define LOOKUP_COMPACT_OFF %d\n", GEN_COMPACT_OFF);
+	fprintf(file, "struct hp_t lookup_compact[] = {\n");
+	print_pairs(&fmt_list[1], -GEN_COMPACT_OFF, GEN_COMPACT_STEP * (GEN_COMPACT_LEN - 1) - GEN_COMPACT_OFF, GEN_COMPACT_STEP, "\t", file);
+	fprintf(file, "};\n\n");
+
+	fprintf(file, "double lookup_compact_small[] = {\n");
+	for(i = 0; i < GEN_COMPACT_STEP; i++)
+		fprintf(file, "\t%e,\n", pow(10.0, i));
+
+	fprintf(file, "};\n");
+}
+
+/**
+ * Print the tables of the header-only C++ form, holding the power, binary
+ * exponent and decade threshold tables of 'print_header' as constexpr
+ * members of a class template.
+ *   @file: The file.
+ */
+
+static void print_hpp(FILE *file)
+{
+	int32_t i;
+	double thr[GEN_THR_LEN];
+	int16_t exp[GEN_EXP_LEN];
+
+	fprintf(file, "/*\n"
+		" * Generated by 'bench/lookupgen'. Regenerate with 'lookupgen hpp' and\n"
+		" * verify with 'lookupgen check'; do not edit by hand.\n"
+		" */\n\n");
+
+	fprintf(file, "namespace errol {\n\nnamespace detail {\n\n");
+
+	fprintf(file, "/**\n"
+		" * Lookup tables, as 'lookup_table', 'lookup_exp' and 'lookup_thr' in\n"
+		" * 'lookup.h'. Static members of a class template are defined once across\n"
+		" * every translation unit including the header.\n"
+		" */\n\n");
+
+	gen_thr(thr);
+	gen_exp(thr, exp);
+
+	fprintf(file, "template<class T = void> struct lookup {\n");
+	fprintf(file, "\tstatic constexpr int32_t table_len = %d;\n", GEN_TABLE_LEN);
+	fprintf(file, "\tstatic constexpr int32_t exp_off = %d;\n", -GEN_EXP_MIN);
+	fprintf(file, "\tstatic constexpr int32_t thr_off = %d;\n\n", -GEN_THR_MIN);
+
+	fprintf(file, "\tstatic constexpr hp_t table[%d] = {\n", GEN_TABLE_LEN);
+	print_pairs(&fmt_list[1], GEN_TABLE_MAX, GEN_TABLE_MAX - GEN_TABLE_LEN + 1, -1, "\t\t", file);
+	fprintf(file, "\t};\n\n");
+
+	fprintf(file, "\tstatic constexpr int16_t exp[%d] = {\n", GEN_EXP_LEN);
+	for(i = 0; i < GEN_EXP_LEN; i++)
+		fprintf(file, "%s%d,%s", (i % 16 == 0) ? "\t\t" : "", exp[i], ((i % 16 == 15) || (i == GEN_EXP_LEN - 1)) ? "\n" : " ");
+
+	fprintf(file, "\t};\n\n");
+
+	fprintf(file, "\tstatic constexpr double thr[%d] = {\n", GEN_THR_LEN);
+	for(i = 0; i < GEN_THR_LEN; i++) {
+		fprintf(file, "\t\t");
+		print_short(thr[i], file);
+		fprintf(file, ",\n");
+	}
+
+	fprintf(file, "\t};\n};\n\n");
+
+	fprintf(file, "template<class T> constexpr int32_t lookup<T>::table_len;\n");
+	fprintf(file, "template<class T> constexpr int32_t lookup<T>::exp_off;\n");
+	fprintf(file, "template<class T> constexpr int32_t lookup<T>::thr_off;\n");
+	fprintf(file, "template<class T> constexpr hp_t lookup<T>::table[%d];\n", GEN_TABLE_LEN);
+	fprintf(file, "template<class T> constexpr int16_t lookup<T>::exp[%d];\n", GEN_EXP_LEN);
+	fprintf(file, "template<class T> constexpr double lookup<T>::thr[%d];\n\n", GEN_THR_LEN);
+
+	fprintf(file, "}\n\n}\n");
+}
+
+
+/**
+ * Compare an extended table entry against its exact value.
+ *   @entry: The table entry.
+ *   @pow: The power.
+ *   @exact: Require the entry to be exact.
+ *   &returns: True if matching, false otherwise.
+ */
+
+static bool check_ext(const struct lookup_ext_t *entry, int32_t pow, bool exact)
+{
+	int32_t i;
+	struct mant_t mant;
+
+	if(!gen_ext(GEN_EXT_BITS, pow, &mant) && exact)
+		return false;
+
+	for(i = 0; i < GEN_EXT_BITS / 64; i++) {
+		if(entry->mant[i] != mant.word[GEN_EXT_BITS / 64 - 1 - i])
+			return false;
+	}
+
+	return entry->exp == mant.exp;
+}
+
+/**
+ * Check every entry of the compiled-in tables against its exact value.
+ *   &returns: The number of mismatching entries.
+ */
+
+static unsigned int check_header(void)
+{
+	int32_t i;
+	long double hi, err;
+	double thr[GEN_THR_LEN];
+	int16_t exp[GEN_EXP_LEN];
+	unsigned int nfail = 0;
+
+	if((LOOKUP_TABLE_LEN != GEN_TABLE_LEN) || (LOOKUP_EXP_OFF != -GEN_EXP_MIN) || (sizeof(lookup_exp) != sizeof(exp)) ||
+	   (LOOKUP_THR_OFF != -GEN_THR_MIN) || (sizeof(lookup_thr) != sizeof(thr)) ||
+	   (LOOKUP_EXT_OFF != -GEN_EXT_MIN) || (sizeof(lookup_ext) != GEN_EXT_LEN * sizeof(struct lookup_ext_t)) ||
+	   (sizeof(lookup_ext_small) != GEN_EXT_STEP * sizeof(struct lookup_ext_t)) ||
+	   (LOOKUP_COMPACT_STEP != GEN_COMPACT_STEP) || (LOOKUP_COMPACT_OFF != GEN_COMPACT_OFF) ||
+	   (sizeof(lookup_compact) != GEN_COMPACT_LEN * sizeof(struct hp_t)) || (sizeof(lookup_compact_small) != GEN_COMPACT_STEP * sizeof(double)))
+		return fprintf(stderr, "Table layout mismatch.\n"), 1;
+
+	for(i = 0; i < GEN_TABLE_LEN; i++) {
+		gen_pair(&fmt_list[1], GEN_TABLE_MAX - i, &hi, &err);
+		if(lookup_table[i].val != (double)hi)
+			nfail++, fprintf(stderr, "Power mismatch. Index %d, expected %.17e.\n", i, (double)hi);
+		else if(lookup_table[i].err != (double)err)
+			nfail++, fprintf(stderr, "Residual mismatch. Index %d, expected %.17e.\n", i, (double)err);
+	}
+
+	gen_thr(thr);
+	gen_exp(thr, exp);
+
+	/* the C++ tables must match the C tables entry for entry */
+
+	typedef errol::detail::lookup<> hpp;
+
+	if((hpp::table_len != GEN_TABLE_LEN) || (ERROL_ROWS != GEN_TABLE_LEN) || (hpp::exp_off != LOOKUP_EXP_OFF) || (hpp::thr_off != LOOKUP_THR_OFF) ||
+	   (sizeof(hpp::exp) != sizeof(lookup_exp)) || (sizeof(hpp::thr) != sizeof(lookup_thr)))
+		return fprintf(stderr, "C++ table layout mismatch.\n"), 1;
+
+	if(memcmp(hpp::table, lookup_table, sizeof(lookup_table)) != 0)
+		nfail++, fprintf(stderr, "C++ power table mismatch.\n");
+
+	if(memcmp(hpp::exp, lookup_exp, sizeof(lookup_exp)) != 0)
+		nfail++, fprintf(stderr, "C++ exponent table mismatch.\n");
+
+	if(memcmp(hpp::thr, lookup_thr, sizeof(lookup_thr)) != 0)
+		nfail++, fprintf(stderr, "C++ threshold table mismatch.\n");
+
+	for(i = 0; i < GEN_THR_LEN; i++) {
+		if(lookup_thr[i] != thr[i])
+			nfail++, fprintf(stderr, "Threshold mismatch. Index %d, expected %.17e.\n", i, thr[i]);
+	}
+
+	for(i = 0; i < GEN_EXP_LEN; i++) {
+		if(lookup_exp[i] != exp[i])
+			nfail++, fprintf(stderr, "Exponent mismatch. Index %d, expected %d.\n", i, exp[i]);
+	}
+
+	for(i = 0; i < GEN_EXT_LEN; i++) {
+		if(!check_ext(&lookup_ext[i], GEN_EXT_STEP * (i + GEN_EXT_MIN), false))
+			nfail++, fprintf(stderr, "Extended mismatch. Index %d.\n", i);
+	}
+
+	for(i = 0; i < GEN_EXT_STEP; i++) {
+		if(!check_ext(&lookup_ext_small[i], i, true))
+			nfail++, fprintf(stderr, "Extended small mismatch. Index %d.\n", i);
+	}
+
+	for(i = 0; i < GEN_COMPACT_LEN; i++) {
+		gen_pair(&fmt_list[1], GEN_COMPACT_STEP * i - GEN_COMPACT_OFF, &hi, &err);
+		if((lookup_compact[i].val != (double)hi) || (lookup_compact[i].err != (double)err))
+			nfail++, fprintf(stderr, "Compact mismatch. Index %d.\n", i);
+	}
+
+	for(i = 0; i < GEN_COMPACT_STEP; i++) {
+		gen_pair(&fmt_list[1], i, &hi, &err);
+		if((lookup_compact_small[i] != (double)hi) || (err != 0.0))
+			nfail++, fprintf(stderr, "Compact small mismatch. Index %d.\n", i);
+	}
+
+	return nfail;
+}
+
+
+/**
+ * Find a format by name.
+ *   @name: The name.
+ *   &returns: The format or null.
+ */
+
+static const struct fmt_t *fmt_find(const char *name)
+{
+	const struct fmt_t *fmt;
+
+	for(fmt = fmt_list; fmt->name != NULL; fmt++) {
+		if(strcmp(fmt->name, name) == 0)
+			return fmt;
+	}
+
+	return NULL;
+}
+
+/**
+ * Print the usage and fail.
+ *   &returns: The error code.
+ */
+
+static int usage(void)
+{
+	fprintf(stderr,
+		"usage: lookupgen header\n"
+		"       lookupgen hpp\n"
+		"       lookupgen check\n"
+		"       lookupgen pairs <float|double|ldouble> <max> <min> [step]\n"
+		"       lookupgen ext <bits> <min> <max> [step]\n");
+
+	return 2;
+}
+
+/**
+ * Main entry point.
+ *   @argc: The number of argument.
+ *   @argv: The argument array.
+ *   &returns: The error code.
+ */
+
+int main(int argc, char *argv[])
+{
+	if(argc < 2)
+		return usage();
+
+	if((strcmp(argv[1], "header") == 0) && (argc == 2))
+		print_header(stdout);
+	else if((strcmp(argv[1], "hpp") == 0) && (argc == 2))
+		print_hpp(stdout);
+	else if((strcmp(argv[1], "check") == 0) && (argc == 2)) {
+		unsigned int nfail;
+
+		nfail = check_header();
+		printf("failures: %u\n", nfail);
+
+		return (nfail > 0) ? 1 : 0;
+	}
+	else if((strcmp(argv[1], "pairs") == 0) && ((argc == 5) || (argc == 6))) {
+		const struct fmt_t *fmt;
+		int32_t step = (argc == 6) ? atoi(argv[5]) : 1;
+
+		fmt = fmt_find(argv[2]);
+		if((fmt == NULL) || (step <= 0))
+			return usage();
+
+		print_pairs(fmt, atoi(argv[3]), atoi(argv[4]), -step, "\t", stdout);
+	}
+	else if((strcmp(argv[1], "ext") == 0) && ((argc == 5) || (argc == 6))) {
+		int32_t pow, bits = atoi(argv[2]), step = (argc == 6) ? atoi(argv[5]) : 1;
+		struct mant_t mant;
+
+		if((bits <= 0) || (bits % 64 != 0) || (bits >= 64 * MANT_WORDS) || (step <= 0))
+			return usage();
+
+		for(pow = atoi(argv[3]); pow <= atoi(argv[4]); pow += step) {
+			gen_ext(bits, pow, &mant);
+			print_ext(&mant, bits, stdout);
+		}
+	}
+	else
+		return usage();
+
+	return 0;
+}
@@ -10,6 +10,9 @@
 #include "util.h"
 #include "integer.h"
 #include "search.h"
+#include "cert.h"
+#include "perf.h"
+#include "check.h"
 
 #include "../../grisu/src/fast-dtoa.h"
 using namespace double_conversion;
@@ -19,6 +22,8 @@ extern "C" {
 #include "../../errol/src/errol.h"
 }
 
+#include "../../errol/src/errol.hpp"
+
 /**
  * Retrieve the value for a decimal string and exponnet.
  *   @str: The decimal string.
@@ -150,6 +155,39 @@ void chk_errol(double val)
 }
 
 
+/**
+ * Check errol_short on every power of two in the integer and 128-bit
+ * branches, where the rounding interval is narrower below the value. The
+ * header-only form must produce the same digits.
+ *   &returns: The error code.
+ */
+
+static int chk_pow2(void)
+{
+	int k, exp;
+	int32_t hexp;
+	double val;
+	char buf[108], hbuf[108];
+	unsigned int nfail = 0;
+
+	for(k = 54; k < 128; k++) {
+		val = ldexp(1.0, k);
+
+		exp = errol_short(val, buf);
+		if(!chk_correct(val, buf, exp) || !chk_short(val, buf))
+			nfail++, fprintf(stderr, "Errol: Power of two failure. Input 2^%d. Expected '%s'. Actual '%se%d'.\n", k, conv_gay(val, NULL), buf, exp);
+
+		*errol::shortest(val, hbuf, hexp) = '\0';
+		if((strcmp(buf, hbuf) != 0) || (exp != hexp))
+			nfail++, fprintf(stderr, "Errol: Header mismatch. Input 2^%d. Library '%se%d'. Header '%se%d'.\n", k, buf, exp, hbuf, hexp);
+	}
+
+	printf("powers of two: %d, failures: %u\n", 128 - 54, nfail);
+
+	return (nfail > 0) ? 1 : 0;
+}
+
+
 static int sort(const void *left, const void *right)
 {
 	if(*(const int *)left > *(const int *)right)
@@ -182,6 +220,30 @@ int main(int argc, char *argv[])
 
 	setbuf(stdout, NULL);
 
+	/* performance regression suite */
+	if((argc > 1) && (strcmp(argv[1], "perf-save") == 0))
+		return perf_save();
+	else if((argc > 1) && (strcmp(argv[1], "perf-check") == 0))
+		return perf_check();
+	else if((argc > 1) && (strcmp(argv[1], "perf-report") == 0))
+		return perf_report("report.csv", (argc > 2) ? argv[2] : NULL);
+	else if((argc > 1) && (strcmp(argv[1], "perf-thrash") == 0))
+		return perf_thrash();
+
+	/* power of two regression check */
+	if((argc > 1) && (strcmp(argv[1], "pow2-check") == 0))
+		return chk_pow2();
+
+	/* conversion checks against reference implementations */
+	if((argc > 1) && (strcmp(argv[1], "prec-check") == 0))
+		return chk_prec();
+	else if((argc > 1) && (strcmp(argv[1], "ext-check") == 0))
+		return chk_ext();
+	else if((argc > 1) && (strcmp(argv[1], "strtod-check") == 0))
+		return chk_strtod();
+	else if((argc > 1) && (strcmp(argv[1], "roundtrip-check") == 0))
+		return chk_roundtrip();
+
 	/* error analysis */
 	if(0) {
 		unsigned int data[2046][3];
@@ -379,17 +441,31 @@ int main(int argc, char *argv[])
 
 	/* upper midpoint neighborhood checking */
 	if(0) {
+		file = fopen("upper.cert", "w");
+		cert_header(file, errol_table_hash());
+		search_certify(file);
+
 		//for(int i = 137-53; i <= 1023-53; i++)
 		for(int i = 137-53; i <= 1023-53; i++)
 			search_upper(i);
+
+		search_certify(NULL);
+		fclose(file);
 	}
 
 	/* lower midpoint neighborhood checking */
 	if(0) {
+		file = fopen("lower.cert", "w");
+		cert_header(file, errol_table_hash());
+		search_certify(file);
+
 		//for(int i = -38; i >= -1022; i--)
 		for(int i = -1021; i >= -1021; i--)
 			search_lower(-i);
 		//search_upper(137);
+
+		search_certify(NULL);
+		fclose(file);
 	}
 
 	return 0;
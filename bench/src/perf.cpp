@@ -0,0 +1,847 @@
+#define restrict __restrict
+#include <string.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <sys/time.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <linux/perf_event.h>
+#include <unistd.h>
+#include "util.h"
+#include "perf.h"
+
+#include "../../grisu/src/fast-dtoa.h"
+#include "../../grisu/src/bignum-dtoa.h"
+#include "../../grisu/src/strtod.h"
+using namespace double_conversion;
+
+extern "C" {
+#include "../../gay/gay.h"
+#include "../../errol/src/errol.h"
+}
+
+#include "../../errol/src/errol.hpp"
+
+
+/**
+ * Input structure.
+ *   @val: The value.
+ *   @digits: The shortest digits of the value.
+ *   @len, exp: The digit count and decimal exponent.
+ */
+
+struct input_t {
+	double val;
+	char digits[32];
+	int len, exp;
+};
+
+/**
+ * Engine structure.
+ *   @name: The name.
+ *   @gate: Whether regressions fail the check.
+ *   @func: The conversion function.
+ */
+
+struct engine_t {
+	const char *name;
+	bool gate;
+	void (*func)(const struct input_t *in);
+};
+
+/**
+ * Input distribution structure.
+ *   @name: The name.
+ *   @gen: The value generator.
+ */
+
+struct dist_t {
+	const char *name;
+	double (*gen)(void);
+};
+
+
+/*
+ * sink preventing the conversions from being optimized away
+ */
+
+static volatile int sink;
+
+
+/**
+ * Convert using Errol.
+ *   @in: The input.
+ */
+
+static void run_errol(const struct input_t *in)
+{
+	char buf[108];
+
+	sink = errol_short(in->val, buf);
+}
+
+/**
+ * Convert to 17 digits using Errol.
+ *   @in: The input.
+ */
+
+static void run_roundtrip(const struct input_t *in)
+{
+	char buf[18];
+
+	sink = errol_roundtrip(in->val, buf);
+}
+
+/**
+ * Convert using the header-only Errol, promising a positive finite input.
+ *   @in: The input.
+ */
+
+static void run_errol_hpp(const struct input_t *in)
+{
+	char buf[108];
+	int32_t exp;
+
+	errol::shortest<errol::finite | errol::positive>(in->val, buf, exp);
+	sink = exp;
+}
+
+/**
+ * Convert using Grisu.
+ *   @in: The input.
+ */
+
+static void run_grisu(const struct input_t *in)
+{
+	char buf[108];
+	int length, point;
+	Vector<char> buffer(buf, sizeof(buf));
+
+	sink = FastDtoa(in->val, FAST_DTOA_SHORTEST, 0, buffer, &length, &point);
+}
+
+/**
+ * Convert using the Grisu bignum fallback.
+ *   @in: The input.
+ */
+
+static void run_bignum(const struct input_t *in)
+{
+	char buf[108];
+	int length, point;
+	Vector<char> buffer(buf, sizeof(buf));
+
+	BignumDtoa(in->val, BIGNUM_DTOA_SHORTEST, 0, buffer, &length, &point);
+	sink = length;
+}
+
+/**
+ * Parse using Grisu.
+ *   @in: The input.
+ */
+
+static void run_strtod(const struct input_t *in)
+{
+	Vector<const char> buffer(in->digits, in->len);
+
+	sink = Strtod(buffer, in->exp) == in->val;
+}
+
+/**
+ * Convert using Gay's dtoa.
+ *   @in: The input.
+ */
+
+static void run_gay(const struct input_t *in)
+{
+	char *buf;
+	int decpt, sign;
+
+	buf = dtoa(in->val, 0, 12, &decpt, &sign, NULL);
+	sink = decpt;
+	freedtoa(buf);
+}
+
+
+/**
+ * Generate a uniform value in (0, 1).
+ *   &returns: The value.
+ */
+
+static double gen_unit(void)
+{
+	double val;
+
+	do
+		val = ldexp((double)((((uint64_t)rand() << 31) ^ rand()) & (((uint64_t)1 << 53) - 1)), -53);
+	while(val == 0.0);
+
+	return val;
+}
+
+/**
+ * Generate an integral value below 2^53.
+ *   &returns: The value.
+ */
+
+static double gen_int(void)
+{
+	return (double)((((uint64_t)rand() << 31) ^ rand()) % (((uint64_t)1 << 53) - 1) + 1);
+}
+
+/**
+ * Generate a value with few decimal digits, such as prices.
+ *   &returns: The value.
+ */
+
+static double gen_short(void)
+{
+	return (rand() % 10000000 + 1) / 1000.0;
+}
+
+
+/*
+ * engine and distribution tables
+ */
+
+static const struct engine_t engines[] = {
+	{ "errol_short", true, run_errol },
+	{ "errol.hpp", false, run_errol_hpp },
+	{ "errol_roundtrip", true, run_roundtrip },
+	{ "FastDtoa", true, run_grisu },
+	{ "BignumDtoa", true, run_bignum },
+	{ "Strtod", true, run_strtod },
+	{ "gay", false, run_gay },
+};
+
+static const struct dist_t dists[] = {
+	{ "bits", randval },
+	{ "unit", gen_unit },
+	{ "int", gen_int },
+	{ "short", gen_short },
+};
+
+#define NENGINES (sizeof(engines) / sizeof(engines[0]))
+#define NDISTS (sizeof(dists) / sizeof(dists[0]))
+
+
+/**
+ * Compare two unsigned integers for sorting.
+ *   @left: The left integer.
+ *   @right: The right integer.
+ *   &returns: Their order.
+ */
+
+static int compare(const void *left, const void *right)
+{
+	if(*(const uint32_t *)left < *(const uint32_t *)right)
+		return -1;
+	else if(*(const uint32_t *)left > *(const uint32_t *)right)
+		return 1;
+	else
+		return 0;
+}
+
+/**
+ * Compute the machine fingerprint from the processor model and count.
+ *   @buf: The output buffer, at least 17 bytes.
+ */
+
+static void fingerprint(char *buf)
+{
+	FILE *file;
+	char line[256], model[256] = "unknown";
+	uint64_t hash = 0xcbf29ce484222325;
+	unsigned int i;
+
+	file = fopen("/proc/cpuinfo", "r");
+	if(file != NULL) {
+		while(fgets(line, sizeof(line), file) != NULL) {
+			if(strncmp(line, "model name", 10) == 0) {
+				strcpy(model, line);
+				break;
+			}
+		}
+
+		fclose(file);
+	}
+
+	sprintf(model + strlen(model), "%ld", sysconf(_SC_NPROCESSORS_ONLN));
+	for(i = 0; model[i] != '\0'; i++)
+		hash = (hash ^ (uint8_t)model[i]) * 0x100000001b3;
+
+	sprintf(buf, "%016lx", hash);
+}
+
+/**
+ * Compute the shortest digits of an input value.
+ *   @in: The input.
+ */
+
+static void prepare(struct input_t *in)
+{
+	int length, point;
+	Vector<char> buffer(in->digits, sizeof(in->digits));
+
+	BignumDtoa(in->val, BIGNUM_DTOA_SHORTEST, 0, buffer, &length, &point);
+	in->len = length;
+	in->exp = point - length;
+}
+
+/**
+ * Generate the deterministic input set for a distribution.
+ *   @dist: The distribution.
+ *   @in: The output inputs, 'PERF_COUNT' long.
+ */
+
+static void generate(const struct dist_t *dist, struct input_t *in)
+{
+	unsigned int i;
+
+	srand(PERF_SEED);
+
+	for(i = 0; i < PERF_COUNT; i++) {
+		in[i].val = dist->gen();
+		prepare(&in[i]);
+	}
+}
+
+/**
+ * Measure every engine over an input set. Inputs are timed in blocks to
+ * amortize the cost of the serializing time stamp, and each block keeps the
+ * fastest of several repeats. The repeats cycle through the engines so that
+ * a transient slowdown of the machine does not land on a single engine.
+ *   @in: The inputs.
+ *   @n: The number of inputs, a multiple of 'PERF_BLOCK'.
+ *   @repeat: The number of repeats.
+ *   @out: The output cycles per conversion, 'n / PERF_BLOCK' long per engine.
+ */
+
+static void measure(const struct input_t *in, unsigned int n, unsigned int repeat, uint32_t out[][PERF_SAMPLES])
+{
+	unsigned int e, i, j, r, nsamples = n / PERF_BLOCK;
+	uint64_t tm;
+
+	for(e = 0; e < NENGINES; e++) {
+		for(i = 0; i < n; i++)
+			engines[e].func(&in[i]);
+
+		for(i = 0; i < nsamples; i++)
+			out[e][i] = UINT32_MAX;
+	}
+
+	for(r = 0; r < repeat; r++) {
+		for(e = 0; e < NENGINES; e++) {
+			for(i = 0; i < nsamples; i++) {
+				tm = rdtsc();
+				for(j = 0; j < PERF_BLOCK; j++)
+					engines[e].func(&in[i * PERF_BLOCK + j]);
+				tm = (rdtsc() - tm) / PERF_BLOCK;
+
+				if(tm < out[e][i])
+					out[e][i] = tm;
+			}
+		}
+	}
+
+	for(e = 0; e < NENGINES; e++)
+		qsort(out[e], nsamples, sizeof(uint32_t), compare);
+}
+
+/**
+ * Compute the one-sided Mann-Whitney p-value that the new sample is
+ * stochastically larger than the base sample.
+ *   @base: The sorted base sample.
+ *   @cur: The sorted new sample.
+ *   @n: The size of each sample.
+ *   &returns: The p-value.
+ */
+
+static double mannwhitney(const uint32_t *base, const uint32_t *cur, unsigned int n)
+{
+	unsigned int i = 0, j = 0, bi, ci;
+	double rank = 1.0, sum = 0.0, ties = 0.0, u, mean, var, t;
+
+	/* merge the sorted samples, assigning average ranks to ties */
+
+	while((i < n) || (j < n)) {
+		uint32_t v = (j == n || (i < n && base[i] < cur[j])) ? base[i] : cur[j];
+
+		for(bi = i; (i < n) && (base[i] == v); i++);
+		for(ci = j; (j < n) && (cur[j] == v); j++);
+
+		t = (i - bi) + (j - ci);
+		sum += (j - ci) * (rank + (t - 1.0) / 2.0);
+		ties += t * t * t - t;
+		rank += t;
+	}
+
+	u = sum - n * (n + 1.0) / 2.0;
+	mean = n * (double)n / 2.0;
+	var = n * (double)n / 12.0 * ((2.0 * n + 1.0) - ties / (2.0 * n * (2.0 * n - 1.0)));
+	if(var <= 0.0)
+		return 1.0;
+
+	return 0.5 * erfc((u - mean - 0.5) / sqrt(var) / sqrt(2.0));
+}
+
+
+/**
+ * Measure every engine and distribution and save the results as the
+ * baseline for this machine.
+ *   &returns: The error code.
+ */
+
+int perf_save(void)
+{
+	FILE *file;
+	char fp[17], path[64];
+	unsigned int d, e, i;
+	static struct input_t in[PERF_COUNT];
+	static uint32_t out[NENGINES][PERF_SAMPLES];
+
+	fingerprint(fp);
+	sprintf(path, "perf-%s.base", fp);
+
+	file = fopen(path, "w");
+	if(file == NULL)
+		return fprintf(stderr, "Cannot open '%s'.\n", path), 2;
+
+	for(d = 0; d < NDISTS; d++) {
+		generate(&dists[d], in);
+		measure(in, PERF_COUNT, PERF_REPEAT, out);
+
+		for(e = 0; e < NENGINES; e++) {
+			fprintf(file, "%s %s %u", engines[e].name, dists[d].name, PERF_SAMPLES);
+			for(i = 0; i < PERF_SAMPLES; i++)
+				fprintf(file, " %u", out[e][i]);
+
+			fprintf(file, "\n");
+			printf("%-15s %-6s median %u\n", engines[e].name, dists[d].name, out[e][PERF_SAMPLES / 2]);
+		}
+	}
+
+	fclose(file);
+	printf("saved baseline '%s'\n", path);
+
+	return 0;
+}
+
+/**
+ * Measure every engine and distribution and compare against the saved
+ * baseline for this machine.
+ *   &returns: Zero if no gated engine regressed, one otherwise.
+ */
+
+int perf_check(void)
+{
+	FILE *file;
+	char fp[17], path[64], ename[64], dname[64];
+	unsigned int d, e, i, n;
+	bool found, fail = false;
+	double p, ratio;
+	static struct input_t in[PERF_COUNT];
+	static uint32_t out[NENGINES][PERF_SAMPLES], base[PERF_SAMPLES];
+
+	fingerprint(fp);
+	sprintf(path, "perf-%s.base", fp);
+
+	file = fopen(path, "r");
+	if(file == NULL)
+		return fprintf(stderr, "No baseline '%s' for this machine.\n", path), 2;
+
+	printf("%-15s %-6s %8s %8s %8s %10s\n", "engine", "dist", "base", "new", "ratio", "p");
+
+	for(d = 0; d < NDISTS; d++) {
+		generate(&dists[d], in);
+		measure(in, PERF_COUNT, PERF_REPEAT, out);
+
+		for(e = 0; e < NENGINES; e++) {
+			/* locate the baseline sample */
+
+			rewind(file);
+			found = false;
+			while(fscanf(file, "%63s %63s %u", ename, dname, &n) == 3) {
+				found = (strcmp(ename, engines[e].name) == 0) && (strcmp(dname, dists[d].name) == 0) && (n == PERF_SAMPLES);
+
+				for(i = 0; i < n; i++) {
+					if(fscanf(file, "%u", found ? &base[i] : &base[0]) != 1)
+						break;
+				}
+
+				if(found)
+					break;
+			}
+
+			if(!found) {
+				printf("%-15s %-6s missing from baseline\n", engines[e].name, dists[d].name);
+				continue;
+			}
+
+			p = mannwhitney(base, out[e], PERF_SAMPLES);
+			ratio = out[e][PERF_SAMPLES / 2] / (double)base[PERF_SAMPLES / 2];
+
+			printf("%-15s %-6s %8u %8u %8.3f %10.2e", engines[e].name, dists[d].name, base[PERF_SAMPLES / 2], out[e][PERF_SAMPLES / 2], ratio, p);
+			if((p < PERF_ALPHA) && (ratio > 1.0 + PERF_THRESHOLD)) {
+				printf(engines[e].gate ? "  REGRESSION\n" : "  slower\n");
+				fail |= engines[e].gate;
+			}
+			else
+				printf("\n");
+		}
+	}
+
+	fclose(file);
+	printf("%s\n", fail ? "FAIL" : "PASS");
+
+	return fail ? 1 : 0;
+}
+
+/**
+ * Errol branches.
+ *   @ERROL_INT: The exact path for integers below 2^64.
+ *   @ERROL_WIDE: The 128-bit integer branch.
+ *   @ERROL_HP: The 'hp_t' branch, which also covers the one hard-coded value.
+ */
+
+enum errol_branch_e {
+	ERROL_INT,
+	ERROL_WIDE,
+	ERROL_HP
+};
+
+/**
+ * Classify the branch Errol takes for a value. This follows the dispatch
+ * order of 'errol_short', which tests for an integer below 2^64 before the
+ * range test of the 128-bit branch.
+ *   @val: The value.
+ *   &returns: The branch.
+ */
+
+static enum errol_branch_e errol_branch(double val)
+{
+	if(errol::detail::errol_isint(val))
+		return ERROL_INT;
+	else if((val != 4.503599627370496e+38) && (val >= 1.80143985094820e+16) && (val < 3.40282366920938e+38))
+		return ERROL_WIDE;
+	else
+		return ERROL_HP;
+}
+
+/**
+ * Map a normalized heat value onto a color.
+ *   @t: The value between zero and one.
+ *   @buf: The output buffer, at least 8 bytes.
+ */
+
+static void heat(double t, char *buf)
+{
+	static const double ramp[3][3] = { { 49, 54, 149 }, { 255, 255, 191 }, { 165, 0, 38 } };
+	unsigned int k = (t < 0.5) ? 0 : 1;
+	double f = (t < 0.5) ? 2.0 * t : 2.0 * t - 1.0;
+
+	sprintf(buf, "#%02x%02x%02x",
+		(int)(ramp[k][0] + f * (ramp[k + 1][0] - ramp[k][0])),
+		(int)(ramp[k][1] + f * (ramp[k + 1][1] - ramp[k][1])),
+		(int)(ramp[k][2] + f * (ramp[k + 1][2] - ramp[k][2])));
+}
+
+/**
+ * Write the report as an SVG heatmap with one column per binary exponent
+ * and one row per metric. Each row is normalized to its own range, with
+ * cycle counts on a logarithmic scale.
+ *   @path: The output path.
+ *   @name: The row names.
+ *   @data: The row values, 'PERF_EXPS' long per row.
+ *   @nrows: The number of rows.
+ *   @ncycles: The number of leading rows holding cycle counts.
+ *   &returns: True on success, false if the file cannot be opened.
+ */
+
+static bool report_svg(const char *path, const char **name, double data[][PERF_EXPS], unsigned int nrows, unsigned int ncycles)
+{
+	FILE *file;
+	unsigned int r, i;
+	double lo, hi, v;
+	char color[8];
+
+	file = fopen(path, "w");
+	if(file == NULL)
+		return false;
+
+	fprintf(file, "<svg xmlns=\"http://www.w3.org/2000/svg\" width=\"%u\" height=\"%u\" shape-rendering=\"crispEdges\" font-family=\"monospace\" font-size=\"11\">\n", 100 + PERF_EXPS, 20 * nrows + 20);
+
+	for(r = 0; r < nrows; r++) {
+		lo = INFINITY, hi = -INFINITY;
+		for(i = 0; i < PERF_EXPS; i++) {
+			v = (r < ncycles) ? log(data[r][i]) : data[r][i];
+			lo = fmin(lo, v), hi = fmax(hi, v);
+		}
+
+		fprintf(file, "<text x=\"0\" y=\"%u\">%s</text>\n", 20 * r + 14, name[r]);
+
+		for(i = 0; i < PERF_EXPS; i++) {
+			v = (r < ncycles) ? log(data[r][i]) : data[r][i];
+			heat((hi > lo) ? (v - lo) / (hi - lo) : 0.0, color);
+			fprintf(file, "<rect x=\"%u\" y=\"%u\" width=\"1\" height=\"18\" fill=\"%s\"/>\n", 100 + i, 20 * r, color);
+		}
+	}
+
+	for(i = 0; i < PERF_EXPS; i += 256)
+		fprintf(file, "<text x=\"%u\" y=\"%u\">%d</text>\n", 100 + i, 20 * nrows + 14, (int)i - 1023);
+
+	fprintf(file, "</svg>\n");
+	fclose(file);
+
+	return true;
+}
+
+/**
+ * Measure every engine across every binary exponent and write the report.
+ * The report has one line per exponent with the median cycles of each
+ * engine, the rate of FastDtoa failures, the rate of Errol taking the
+ * integer, 128-bit and 'hp_t' branches, and the mean digits produced. Subnormals
+ * are reported as exponent -1023.
+ *   @csv: The CSV output path.
+ *   @svg: Optional. The SVG heatmap output path.
+ *   &returns: The error code.
+ */
+
+int perf_report(const char *csv, const char *svg)
+{
+	FILE *file;
+	int length, point;
+	unsigned int b, e, i, fail, branch[3], digits;
+	char buf[108];
+	const char *name[NENGINES + 5];
+	static struct input_t in[PERF_EXP_COUNT];
+	static uint32_t out[NENGINES][PERF_SAMPLES];
+	static double data[NENGINES + 5][PERF_EXPS];
+	union { double d; uint64_t i; } bits;
+
+	file = fopen(csv, "w");
+	if(file == NULL)
+		return fprintf(stderr, "Cannot open '%s'.\n", csv), 2;
+
+	fprintf(file, "exp");
+	for(e = 0; e < NENGINES; e++)
+		fprintf(file, ",%s", engines[e].name);
+
+	fprintf(file, ",grisu_fail,errol_int,errol_wide,errol_hp,digits\n");
+
+	srand(PERF_SEED);
+
+	for(b = 0; b < PERF_EXPS; b++) {
+		fail = digits = 0;
+		branch[ERROL_INT] = branch[ERROL_WIDE] = branch[ERROL_HP] = 0;
+
+		for(i = 0; i < PERF_EXP_COUNT; i++) {
+			Vector<char> buffer(buf, sizeof(buf));
+
+			do
+				bits.i = ((uint64_t)b << 52) | ((((uint64_t)rand() << 31) ^ rand()) & (((uint64_t)1 << 52) - 1));
+			while(bits.i == 0);
+
+			in[i].val = bits.d;
+			prepare(&in[i]);
+
+			fail += !FastDtoa(in[i].val, FAST_DTOA_SHORTEST, 0, buffer, &length, &point);
+			branch[errol_branch(in[i].val)]++;
+			errol_short(in[i].val, buf);
+			digits += strlen(buf);
+		}
+
+		measure(in, PERF_EXP_COUNT, PERF_EXP_REPEAT, out);
+
+		fprintf(file, "%d", (int)b - 1023);
+		for(e = 0; e < NENGINES; e++) {
+			data[e][b] = out[e][PERF_EXP_COUNT / PERF_BLOCK / 2];
+			fprintf(file, ",%u", out[e][PERF_EXP_COUNT / PERF_BLOCK / 2]);
+		}
+
+		data[NENGINES + 0][b] = fail / (double)PERF_EXP_COUNT;
+		data[NENGINES + 1][b] = branch[ERROL_INT] / (double)PERF_EXP_COUNT;
+		data[NENGINES + 2][b] = branch[ERROL_WIDE] / (double)PERF_EXP_COUNT;
+		data[NENGINES + 3][b] = branch[ERROL_HP] / (double)PERF_EXP_COUNT;
+		data[NENGINES + 4][b] = digits / (double)PERF_EXP_COUNT;
+		fprintf(file, ",%.4f,%.4f,%.4f,%.4f,%.2f\n", data[NENGINES + 0][b], data[NENGINES + 1][b], data[NENGINES + 2][b], data[NENGINES + 3][b], data[NENGINES + 4][b]);
+	}
+
+	fclose(file);
+	printf("wrote report '%s'\n", csv);
+
+	if(svg != NULL) {
+		for(e = 0; e < NENGINES; e++)
+			name[e] = engines[e].name;
+
+		name[NENGINES + 0] = "grisu_fail";
+		name[NENGINES + 1] = "errol_int";
+		name[NENGINES + 2] = "errol_wide";
+		name[NENGINES + 3] = "errol_hp";
+		name[NENGINES + 4] = "digits";
+
+		if(!report_svg(svg, name, data, NENGINES + 5, NENGINES))
+			return fprintf(stderr, "Cannot open '%s'.\n", svg), 2;
+
+		printf("wrote heatmap '%s'\n", svg);
+	}
+
+	return 0;
+}
+
+
+/*
+ * co-runner working set of the thrash test
+ */
+
+static uint8_t thrash_buf[PERF_THRASH_MAX];
+
+/**
+ * Sweep the co-runner working set, touching one byte per line.
+ *   @size: The working set size in bytes.
+ */
+
+static void thrash_sweep(unsigned int size)
+{
+	unsigned int i;
+	volatile uint8_t *buf = thrash_buf;
+
+	for(i = 0; i < size; i += PERF_THRASH_LINE)
+		buf[i]++;
+}
+
+/**
+ * Open a counter of level one data cache read misses in user space.
+ *   &returns: The counter descriptor, negative if unavailable.
+ */
+
+static int thrash_counter(void)
+{
+	struct perf_event_attr attr;
+
+	memset(&attr, 0, sizeof(attr));
+	attr.size = sizeof(attr);
+	attr.type = PERF_TYPE_HW_CACHE;
+	attr.config = PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+	attr.disabled = 1;
+	attr.exclude_kernel = 1;
+	attr.exclude_hv = 1;
+
+	return syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+}
+
+/**
+ * Run one block of the thrash test, sweeping before each input.
+ *   @in: The block inputs, 'PERF_BLOCK' long.
+ *   @size: The co-runner working set size.
+ *   @conv: Whether to convert each input.
+ */
+
+static void thrash_block(const struct input_t *in, unsigned int size, bool conv)
+{
+	unsigned int i;
+
+	for(i = 0; i < PERF_BLOCK; i++) {
+		thrash_sweep(size);
+		if(conv)
+			run_errol(&in[i]);
+	}
+}
+
+/**
+ * Count the misses of a pass over the inputs, with or without converting.
+ *   @fd: The counter descriptor.
+ *   @in: The inputs.
+ *   @size: The co-runner working set size.
+ *   @conv: Whether to convert each input.
+ *   &returns: The number of misses.
+ */
+
+static uint64_t thrash_count(int fd, const struct input_t *in, unsigned int size, bool conv)
+{
+	unsigned int i;
+	uint64_t count;
+
+	ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+	ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+
+	for(i = 0; i < PERF_SAMPLES; i++)
+		thrash_block(&in[i * PERF_BLOCK], size, conv);
+
+	ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);
+	if(read(fd, &count, sizeof(count)) != sizeof(count))
+		return 0;
+
+	return count;
+}
+
+/**
+ * Measure Errol while a co-runner sweeps working sets of growing size
+ * between conversions, standing in for a serializer interleaving
+ * conversions with its own data. Each block is timed with and without the
+ * conversions, keeping the fastest of several repeats, and the conversions
+ * are charged the difference of the medians; misses are charged the same
+ * way where the kernel exposes the counter. Build Errol with and without
+ * 'ERROL_COMPACT' to compare the table layouts.
+ *   &returns: The error code.
+ */
+
+int perf_thrash(void)
+{
+	int fd;
+	unsigned int i, r, k, size;
+	uint64_t tm, with, without;
+	char miss[32];
+	static struct input_t in[PERF_COUNT];
+	static uint32_t out[2][PERF_SAMPLES];
+	static const unsigned int sizes[] = { 0, 4, 8, 16, 32, 64 };
+
+	generate(&dists[0], in);
+	fd = thrash_counter();
+
+	printf("errol tables: %zu bytes, hash %016lx\n", errol_table_size(), errol_table_hash());
+	printf("%-10s %10s %12s\n", "co-runner", "cycles", "l1d-misses");
+
+	for(k = 0; k < sizeof(sizes) / sizeof(sizes[0]); k++) {
+		size = sizes[k] * 1024;
+
+		for(i = 0; i < PERF_SAMPLES; i++)
+			out[0][i] = out[1][i] = UINT32_MAX;
+
+		for(r = 0; r < PERF_REPEAT; r++) {
+			for(i = 0; i < PERF_SAMPLES; i++) {
+				tm = rdtsc();
+				thrash_block(&in[i * PERF_BLOCK], size, true);
+				tm = rdtsc() - tm;
+				if(tm < out[0][i])
+					out[0][i] = tm;
+
+				tm = rdtsc();
+				thrash_block(&in[i * PERF_BLOCK], size, false);
+				tm = rdtsc() - tm;
+				if(tm < out[1][i])
+					out[1][i] = tm;
+			}
+		}
+
+		qsort(out[0], PERF_SAMPLES, sizeof(uint32_t), compare);
+		qsort(out[1], PERF_SAMPLES, sizeof(uint32_t), compare);
+		with = out[0][PERF_SAMPLES / 2];
+		without = out[1][PERF_SAMPLES / 2];
+
+		if(fd >= 0) {
+			uint64_t cw = thrash_count(fd, in, size, true), cs = thrash_count(fd, in, size, false);
+
+			sprintf(miss, "%.2f", ((cw > cs) ? (cw - cs) : 0) / (double)PERF_COUNT);
+		}
+		else
+			strcpy(miss, "n/a");
+
+		printf("%7u KB %10.0f %12s\n", sizes[k], ((with > without) ? (with - without) : 0) / (double)PERF_BLOCK, miss);
+	}
+
+	if(fd >= 0)
+		close(fd);
+
+	return 0;
+}
@@ -0,0 +1,43 @@
+#ifndef PERF_H
+#define PERF_H
+
+/**
+ * Performance suite definitions.
+ *   @PERF_COUNT: The number of inputs per distribution.
+ *   @PERF_BLOCK: The number of inputs timed together as one sample.
+ *   @PERF_SAMPLES: The number of samples per distribution.
+ *   @PERF_REPEAT: The number of timed repeats per sample, keeping the minimum.
+ *   @PERF_SEED: The seed used to generate the inputs.
+ *   @PERF_ALPHA: The significance level of the regression test.
+ *   @PERF_THRESHOLD: The minimum median slowdown flagged as a regression.
+ *   @PERF_EXPS: The number of binary exponents in the report.
+ *   @PERF_EXP_COUNT: The number of inputs per exponent in the report.
+ *   @PERF_EXP_REPEAT: The number of timed repeats per sample in the report.
+ *   @PERF_THRASH_MAX: The largest co-runner working set in the thrash test.
+ *   @PERF_THRASH_LINE: The stride of the co-runner sweep.
+ */
+
+#define PERF_COUNT	8192
+#define PERF_BLOCK	16
+#define PERF_SAMPLES	(PERF_COUNT / PERF_BLOCK)
+#define PERF_REPEAT	8
+#define PERF_SEED	20151
+#define PERF_ALPHA	0.001
+#define PERF_THRESHOLD	0.05
+#define PERF_EXPS	2047
+#define PERF_EXP_COUNT	256
+#define PERF_EXP_REPEAT	4
+#define PERF_THRASH_MAX	(256 * 1024)
+#define PERF_THRASH_LINE	64
+
+
+/*
+ * performance suite function declarations
+ */
+
+int perf_save(void);
+int perf_check(void);
+int perf_report(const char *csv, const char *svg);
+int perf_thrash(void);
+
+#endif
@@ -8,7 +8,8 @@
 #include <float.h>
 #include "util.h"
 #include "integer.h"
-#include "avltree.h"
+#include "btree.h"
+#include "cert.h"
 
 
 /*
@@ -21,52 +22,90 @@ void chk_errol(double val);
 /**
  * Jump structure.
  *   @idx: The shift index.
- *   @integer: The shift value.
+ *   @val: The shift value.
  */
 
 struct shift_t {
 	uint64_t idx;
-	struct integer_t *val;
+	struct fixint_t val;
 };
 
 
-/**
- * Create a new shift.
- *   @idx: The index.
- *   @val: The value.
- *   &returns: The shift.
+/*
+ * certificate output, null if disabled
  */
 
-struct shift_t *shift_new(uint64_t idx, struct integer_t *val)
-{
-	struct shift_t *shift;
+static FILE *cert = NULL;
 
-	shift = (struct shift_t *)malloc(sizeof(struct shift_t));
-	shift->idx = idx;
-	shift->val = val;
-
-	return shift;
-}
 
 /**
- * Delete a shift.
- *   @shift: The shift.
+ * Set the certificate output for subsequent searches.
+ *   @file: The certificate file, null to disable.
  */
 
-void shift_delete(struct shift_t *shift)
+void search_certify(FILE *file)
 {
-	integer_delete(shift->val);
-	free(shift);
+	cert = file;
 }
 
+/**
+ * Emit a certificate record for a searched exponent.
+ *   @kind: The search kind.
+ *   @exp: The searched exponent.
+ *   @fact: The number of modulus factors.
+ *   @mod: Optional. The modulus.
+ *   @mid: Optional. The minimal midpoint distance.
+ *   @idx: The index of the minimal midpoint.
+ *   @errlist: Optional. The list of failure candidates.
+ */
 
-struct integer_t *integer_inv(struct integer_t *in, struct integer_t *mod)
+static void certify(char kind, int exp, unsigned int fact, const struct fixint_t *mod, const struct fixint_t *mid, uint64_t idx, const struct btree_t *errlist)
 {
-	struct integer_t *out = integer_copy(in);
+	unsigned int i = 0;
+	struct shift_t *shift;
+	struct btree_iter_t iter;
+	struct cert_rec_t rec;
 
-	integer_sub(&out, mod);
+	if(cert == NULL)
+		return;
+
+	rec.kind = kind;
+	rec.exp = exp;
+	rec.fact = fact;
+	fixint_set(&rec.mod, 0);
+	fixint_set(&rec.mid, 0);
+	rec.idx = idx;
+	rec.ncand = errlist ? errlist->count : 0;
+	rec.cand = (uint64_t *)malloc((rec.ncand + 1) * sizeof(uint64_t));
+
+	if(mod != NULL)
+		rec.mod = *mod;
+
+	if(mid != NULL)
+		rec.mid = *mid;
+
+	if(errlist != NULL) {
+		iter = btree_iter_begin(errlist);
+		while((shift = (struct shift_t *)btree_iter_next(&iter)) != NULL)
+			rec.cand[i++] = shift->idx;
+	}
+
+	cert_write(cert, &rec);
+	free(rec.cand);
+}
+
+
+/**
+ * Compute the negative counterpart of a residue.
+ *   @out: The output.
+ *   @in: The residue.
+ *   @mod: The modulus.
+ */
 
-	return out;
+void fixint_inv(struct fixint_t *out, const struct fixint_t *in, const struct fixint_t *mod)
+{
+	*out = *in;
+	fixint_sub(out, mod);
 }
 
 /**
@@ -75,8 +114,9 @@ struct integer_t *integer_inv(struct integer_t *in, struct integer_t *mod)
 
 void search_upper(int exp)
 {
-	struct integer_t *zero = integer_zero();
-	struct integer_t *one = integer_new(1);
+	struct fixint_t one;
+
+	fixint_set(&one, 1);
 
 	printf("exp: %u\n", exp);
 
@@ -84,217 +124,216 @@ void search_upper(int exp)
 
 	unsigned int fact = log10(pow(2, exp + 53)) - 16;
 	exp -= fact;
-	struct integer_t *mod = integer_pow_ushort(5, fact);
+	struct fixint_t mod;
+	struct fixint_mod_t red;
+	fixint_pow(&mod, 5, fact);
+	fixint_mod_init(&red, &mod);
 
 	/* generate the first offset */
 
-	struct integer_t *init = integer_pow_mod(2, exp + 1, mod);
+	struct fixint_t init;
+	fixint_pow_mod(&init, 2, exp + 1, &red);
 
-	iprintf("init: %I\n", init);
+	iprintf("init: %F\n", &init);
 	/* create the initial shift lists */
 
-	struct avltree_t uplist = avltree_empty((compare_f)integer_cmp, (delete_f)shift_delete);
-	struct avltree_t downlist = avltree_empty((compare_f)integer_cmp, (delete_f)shift_delete);
+	struct btree_t uplist = btree_empty(sizeof(struct shift_t), offsetof(struct shift_t, val), (btree_compare_f)fixint_cmp);
+	struct btree_t downlist = btree_empty(sizeof(struct shift_t), offsetof(struct shift_t, val), (btree_compare_f)fixint_cmp);
+
+	struct fixint_t inv;
+	fixint_inv(&inv, &init, &mod);
 
-	struct shift_t *up = shift_new(1, integer_copy(init));
-	avltree_insert(&uplist, up->val, up);
+	struct shift_t up = { 1, init };
+	btree_insert(&uplist, &up);
 
-	struct shift_t *down = shift_new(1, integer_inv(init, mod));
-	avltree_insert(&downlist, down->val, down);
+	struct shift_t down = { 1, inv };
+	btree_insert(&downlist, &down);
 
 	// generate optimal shift lists
 	while(true) {
 		//get the last elements of each list */
-		up = (struct shift_t *)avltree_first(&uplist);
-		down = (struct shift_t *)avltree_first(&downlist);
+		up = *(struct shift_t *)btree_first(&uplist);
+		down = *(struct shift_t *)btree_first(&downlist);
 
-		//printf("idx: %u , %u\n", up->idx, down->idx);
-		if(up->idx >= (1ul << 52) && down->idx >= (1ul << 52))
+		//printf("idx: %u , %u\n", up.idx, down.idx);
+		if(up.idx >= (1ul << 52) && down.idx >= (1ul << 52))
 			break;
 
 		// calculate the dist-1 between the first values of each list
 		// note that the desired jump has at most magnitude dist-1
-		struct integer_t *dist = integer_copy(up->val);
-		integer_sub(&dist, down->val);
-		integer_sub(&dist, one);
+		struct fixint_t dist = up.val;
+		fixint_sub(&dist, &down.val);
+		fixint_sub(&dist, &one);
 
 		// check if the up shift list is shorter
-		if(up->idx <= down->idx) {
+		if(up.idx <= down.idx) {
 			// select the best down shift
-			struct shift_t *best = (struct shift_t *)avltree_atmost(&downlist, dist);
+			struct shift_t *best = (struct shift_t *)btree_atmost(&downlist, &dist);
 
 			// calculate the next shift
-			struct integer_t *next = integer_copy(up->val);
-			integer_add(&next, best->val);
+			struct fixint_t next = up.val;
+			fixint_add(&next, &best->val);
 
 			// zeros are bad errors
-			if(integer_iszero(next))
-				fprintf(stderr, "Computed zero. idx: %lu :(\n", up->idx + best->idx), abort();
+			if(fixint_iszero(&next))
+				fprintf(stderr, "Computed zero. idx: %lu :(\n", up.idx + best->idx), abort();
 
 			// determine which list to add to
-			struct avltree_t *sel = next->neg ? &downlist : &uplist;
-			if(avltree_lookup(sel, next) != NULL)
+			struct btree_t *sel = next.neg ? &downlist : &uplist;
+			if(btree_lookup(sel, &next) != NULL)
 				continue;//fprintf(stderr, "Computed duplicate shift."), abort();
 
 			// create and add shift
-			struct shift_t *shift = shift_new(up->idx + best->idx, next);
-			avltree_insert(sel, shift->val, shift);
+			struct shift_t shift = { up.idx + best->idx, next };
+			btree_insert(sel, &shift);
 		}
 
 		// check if the down shift list is shorter
 
-		if(down->idx < up->idx) {
+		if(down.idx < up.idx) {
 			// select the best down shift
-			struct shift_t *best = (struct shift_t *)avltree_atmost(&uplist, dist);
+			struct shift_t *best = (struct shift_t *)btree_atmost(&uplist, &dist);
 
 			// calculate the next shift
-			struct integer_t *next = integer_copy(down->val);
-			integer_add(&next, best->val);
+			struct fixint_t next = down.val;
+			fixint_add(&next, &best->val);
 
 			// zeros are bad errors
-			if(integer_iszero(next))
+			if(fixint_iszero(&next))
 				fprintf(stderr, "Computed zero. :(\n"), abort();
 
 			// determine which list to add to
-			struct avltree_t *sel = next->neg ? &downlist : &uplist;
-			if(avltree_lookup(sel, next) != NULL)
+			struct btree_t *sel = next.neg ? &downlist : &uplist;
+			if(btree_lookup(sel, &next) != NULL)
 				continue;//fprintf(stderr, "Computed duplicate shift."), abort();
 
 			// create and add shift
-			struct shift_t *shift = shift_new(down->idx + best->idx, next);
-			avltree_insert(sel, shift->val, shift);
-			iprintf("add2 %u %I\n", shift->idx, shift->val);
+			struct shift_t shift = { down.idx + best->idx, next };
+			btree_insert(sel, &shift);
+			iprintf("add2 %u %F\n", shift.idx, &shift.val);
 		}
-
-		/* cleanup */
-
-		integer_delete(dist);
 	}
 
 	// the running index
 	uint64_t idx = 0;
 
 	// create the first midpoint
-	struct integer_t *first = integer_pow_mod(2, exp + 53, mod);
-	struct integer_t *mid = integer_pow_mod(2, exp, mod);
-	integer_add(&mid, first);
-	integer_mod(&mid, mod);
+	struct fixint_t first, mid;
+	fixint_pow_mod(&first, 2, exp + 53, &red);
+	fixint_pow_mod(&mid, 2, exp, &red);
+	fixint_add(&mid, &first);
+	fixint_mod(&mid, &red);
 
 	// the first shift might not be large enough
 	// ensure we take a many idx=1 shifts to get there
-	struct shift_t *shift = (struct shift_t *)avltree_last(mid->neg ? &uplist : &downlist);
-	while(integer_cmp(shift->val, mid) <= 0) {
+	struct shift_t *shift = (struct shift_t *)btree_last(mid.neg ? &uplist : &downlist);
+	while(fixint_cmp(&shift->val, &mid) <= 0) {
 		idx += shift->idx;
-		integer_add(&mid, shift->val);
+		fixint_add(&mid, &shift->val);
 	}
 
 	// calculate allowable error
-	struct integer_t *err = integer_pow_ushort(2, exp-48);
+	struct fixint_t err;
+	fixint_pow(&err, 2, exp-48);
 
 	// iterate to find a minimal midpoint
 	while(true) {
-		shift = (struct shift_t *)avltree_atleast(mid->neg ? &uplist : &downlist, mid);
+		shift = (struct shift_t *)btree_atleast(mid.neg ? &uplist : &downlist, &mid);
 		if(shift == NULL)
 			break;
 		else if((idx + shift->idx) >= (1l << 52))
 			break;
 
 		idx += shift->idx;
-		integer_add(&mid, shift->val);
+		fixint_add(&mid, &shift->val);
 
-		if(integer_cmp(mid, err) < 0)
+		if(fixint_cmp(&mid, &err) < 0)
 			break;
 	}
 
 	// we detected that a failure may occur
 	if(idx < (1l << 52)) {
 		// list of possible failures and values to check
-		struct avltree_t errlist = avltree_empty((compare_f)integer_cmp, (delete_f)shift_delete);
-		struct avltree_t chklist = avltree_empty((compare_f)integer_cmp, NULL);
+		struct btree_t errlist = btree_empty(sizeof(struct shift_t), offsetof(struct shift_t, val), (btree_compare_f)fixint_cmp);
+		struct btree_t chklist = btree_empty(sizeof(struct shift_t), offsetof(struct shift_t, val), (btree_compare_f)fixint_cmp);
 
-		shift = shift_new(idx, integer_copy(mid));
-		avltree_insert(&errlist, shift->val, shift);
-		avltree_insert(&chklist, shift->val, shift);
+		struct shift_t found = { idx, mid };
+		btree_insert(&errlist, &found);
+		btree_insert(&chklist, &found);
 
 		while(chklist.count > 0) {
-			struct avltree_iter_t iter;
-			struct shift_t *base = (struct shift_t *)avltree_last(&chklist);
-			avltree_remove(&chklist, base->val);
+			struct btree_iter_t iter;
+			struct shift_t base = *(struct shift_t *)btree_last(&chklist);
+			btree_remove(&chklist, &base.val);
 
-			iter = avltree_iter_begin(&uplist);
-			while((shift = (struct shift_t *)avltree_iter_next(&iter)) != NULL) {
-				if(base->idx + shift->idx >= (1l << 52))
+			iter = btree_iter_begin(&uplist);
+			while((shift = (struct shift_t *)btree_iter_next(&iter)) != NULL) {
+				if(base.idx + shift->idx >= (1l << 52))
 					continue;
 
-				struct integer_t *sum = integer_copy(base->val);
-				integer_add(&sum, shift->val);
-				if(integer_cmp(sum, err) < 0) {
-					if(avltree_lookup(&errlist, sum) != NULL)
+				struct fixint_t sum = base.val;
+				fixint_add(&sum, &shift->val);
+				if(fixint_cmp(&sum, &err) < 0) {
+					if(btree_lookup(&errlist, &sum) != NULL)
 						continue;
 
-					shift = shift_new(base->idx + shift->idx, integer_copy(sum));
-					avltree_insert(&errlist, shift->val, shift);
-					avltree_insert(&chklist, shift->val, shift);
+					struct shift_t add = { base.idx + shift->idx, sum };
+					btree_insert(&errlist, &add);
+					btree_insert(&chklist, &add);
 				}
-				else {
-					integer_delete(sum);
+				else
 					break;
-				}
 			}
 
-			iter = avltree_iter_begin(&downlist);
-			while((shift = (struct shift_t *)avltree_iter_next(&iter)) != NULL) {
-				if(base->idx + shift->idx >= (1l << 52))
+			iter = btree_iter_begin(&downlist);
+			while((shift = (struct shift_t *)btree_iter_next(&iter)) != NULL) {
+				if(base.idx + shift->idx >= (1l << 52))
 					continue;
 
-				struct integer_t *sum = integer_copy(base->val);
-				integer_add(&sum, shift->val);
-				if(integer_cmp(sum, err) < 0) {
-					if(avltree_lookup(&errlist, sum) != NULL)
+				struct fixint_t sum = base.val;
+				fixint_add(&sum, &shift->val);
+				if(fixint_cmp(&sum, &err) < 0) {
+					if(btree_lookup(&errlist, &sum) != NULL)
 						continue;
 
-					shift = shift_new(base->idx + shift->idx, integer_copy(sum));
-					avltree_insert(&errlist, shift->val, shift);
-					avltree_insert(&chklist, shift->val, shift);
+					struct shift_t add = { base.idx + shift->idx, sum };
+					btree_insert(&errlist, &add);
+					btree_insert(&chklist, &add);
 				}
-				else {
-					integer_delete(sum);
+				else
 					break;
-				}
 			}
 		}
 
-		struct avltree_iter_t iter = avltree_iter_begin(&errlist);
-		while((shift = (struct shift_t *)avltree_iter_next(&iter)) != NULL) {
+		struct btree_iter_t iter = btree_iter_begin(&errlist);
+		while((shift = (struct shift_t *)btree_iter_next(&iter)) != NULL) {
 			double pred = ldexp((double)(shift->idx + 0) + (double)(1l << 52), exp + fact + 1);
 			double succ = ldexp((double)(shift->idx + 1) + (double)(1l << 52), exp + fact + 1);
 			chk_errol(pred);
 			chk_errol(succ);
 		}
 
-		avltree_destroy(&errlist);
-		avltree_destroy(&chklist);
+		certify('u', exp + fact, fact, &mod, &mid, idx, &errlist);
+
+		btree_destroy(&errlist);
+		btree_destroy(&chklist);
 	}
+	else
+		certify('u', exp + fact, fact, &mod, &mid, idx, NULL);
 
 
 	exp += fact;
-	iprintf("mid: %I\n", mid);
+	iprintf("mid: %F\n", &mid);
 	iprintf("val: 2^%u + 2^%u + %l*2^%u\n", exp+53, exp, idx, exp+1);
-	//iprintf("%l %I\n", idx, mid);
+	//iprintf("%l %F\n", idx, &mid);
 
 	//
 
 
 	/* cleanup */
 
-	integer_delete(zero);
-	integer_delete(one);
-	integer_delete(init);
-	integer_delete(first);
-	integer_delete(mid);
-	integer_delete(err);
-	avltree_destroy(&uplist);
-	avltree_destroy(&downlist);
+	btree_destroy(&uplist);
+	btree_destroy(&downlist);
 }
 
 /**
@@ -303,8 +342,10 @@ void search_upper(int exp)
 
 void search_lower(int exp)
 {
-	struct integer_t *zero = integer_zero();
-	struct integer_t *one = integer_new(1);
+	struct fixint_t zero, one;
+
+	fixint_set(&zero, 0);
+	fixint_set(&one, 1);
 
 	printf("exp %d\n", exp);
 	// minimum number of factors 2 and 5
@@ -314,223 +355,220 @@ void search_lower(int exp)
 	double delta = pow(2, -48) * pow(5, exp - fact);
 
 	// cannot have non-integer deltas
-	if(delta < 1.0)
+	if(delta < 1.0) {
+		certify('l', exp, fact, NULL, NULL, 1ul << 52, NULL);
 		return;
+	}
 
 	/* calculate the modulus */
 
-	struct integer_t *mod = integer_pow_ushort(2, fact);
+	struct fixint_t mod;
+	struct fixint_mod_t red;
+	fixint_pow(&mod, 2, fact);
+	fixint_mod_init(&red, &mod);
 
 	/* generate the first offset */
 
-	struct integer_t *init = integer_pow_mod(5, exp - fact, mod);
-	integer_mul_ushort(&init, 2);
-	integer_mod(&init, mod);
+	struct fixint_t init;
+	fixint_pow_mod(&init, 5, exp - fact, &red);
+	fixint_mul_uint(&init, 2);
+	fixint_mod(&init, &red);
 	/* create the initial shift lists */
 
-	struct avltree_t uplist = avltree_empty((compare_f)integer_cmp, (delete_f)shift_delete);
-	struct avltree_t downlist = avltree_empty((compare_f)integer_cmp, (delete_f)shift_delete);
+	struct btree_t uplist = btree_empty(sizeof(struct shift_t), offsetof(struct shift_t, val), (btree_compare_f)fixint_cmp);
+	struct btree_t downlist = btree_empty(sizeof(struct shift_t), offsetof(struct shift_t, val), (btree_compare_f)fixint_cmp);
+
+	struct fixint_t inv;
+	fixint_inv(&inv, &init, &mod);
 
-	struct shift_t *up = shift_new(1, integer_copy(init));
-	avltree_insert(&uplist, up->val, up);
+	struct shift_t up = { 1, init };
+	btree_insert(&uplist, &up);
 
-	struct shift_t *down = shift_new(1, integer_inv(init, mod));
-	avltree_insert(&downlist, down->val, down);
+	struct shift_t down = { 1, inv };
+	btree_insert(&downlist, &down);
 
 	// generate optimal shift lists
 	while(true) {
 		//get the last elements of each list */
-		up = (struct shift_t *)avltree_first(&uplist);
-		down = (struct shift_t *)avltree_first(&downlist);
+		up = *(struct shift_t *)btree_first(&uplist);
+		down = *(struct shift_t *)btree_first(&downlist);
 
-		//printf("idx: %u , %u\n", up->idx, down->idx);
-		if(up->idx >= (1ul << 52) && down->idx >= (1ul << 52))
+		//printf("idx: %u , %u\n", up.idx, down.idx);
+		if(up.idx >= (1ul << 52) && down.idx >= (1ul << 52))
 			break;
 
 		// calculate the dist-1 between the first values of each list
 		// note that the desired jump has at most magnitude dist-1
-		struct integer_t *dist = integer_copy(up->val);
-		integer_sub(&dist, down->val);
-		integer_sub(&dist, one);
+		struct fixint_t dist = up.val;
+		fixint_sub(&dist, &down.val);
+		fixint_sub(&dist, &one);
 
 		// check if the up shift list is shorter
-		if(up->idx <= down->idx) {
+		if(up.idx <= down.idx) {
 			// select the best down shift
-			struct shift_t *best = (struct shift_t *)avltree_atmost(&downlist, dist);
+			struct shift_t *best = (struct shift_t *)btree_atmost(&downlist, &dist);
 			if(best == NULL)
 				break;
 
 			// calculate the next shift
-			struct integer_t *next = integer_copy(up->val);
-			integer_add(&next, best->val);
+			struct fixint_t next = up.val;
+			fixint_add(&next, &best->val);
 
 			// zero is the smallest jump possible
-			if(integer_iszero(next)) {
-				struct shift_t *shift;
-				
-				shift = shift_new(up->idx + best->idx, integer_copy(zero));
-				avltree_insert(&downlist, shift->val, shift);
-				
-				shift = shift_new(up->idx + best->idx, integer_copy(zero));
-				avltree_insert(&uplist, shift->val, shift);
+			if(fixint_iszero(&next)) {
+				struct shift_t shift = { up.idx + best->idx, zero };
+
+				btree_insert(&downlist, &shift);
+				btree_insert(&uplist, &shift);
 
 				break;
 			}
 
 			// determine which list to add to
-			struct avltree_t *sel = next->neg ? &downlist : &uplist;
-			if(avltree_lookup(sel, next) != NULL)
+			struct btree_t *sel = next.neg ? &downlist : &uplist;
+			if(btree_lookup(sel, &next) != NULL)
 				continue;//fprintf(stderr, "Computed duplicate shift."), abort();
 
 			// create and add shift
-			struct shift_t *shift = shift_new(up->idx + best->idx, next);
-			avltree_insert(sel, shift->val, shift);
+			struct shift_t shift = { up.idx + best->idx, next };
+			btree_insert(sel, &shift);
 		}
 
 		// check if the down shift list is shorter
 
-		if(down->idx < up->idx) {
+		if(down.idx < up.idx) {
 			// select the best down shift
-			struct shift_t *best = (struct shift_t *)avltree_atmost(&uplist, dist);
+			struct shift_t *best = (struct shift_t *)btree_atmost(&uplist, &dist);
 			if(best == NULL)
 				break;
 
 			// calculate the next shift
-			struct integer_t *next = integer_copy(down->val);
-			integer_add(&next, best->val);
+			struct fixint_t next = down.val;
+			fixint_add(&next, &best->val);
 
 			// zero is the smallest jump possible
-			if(integer_iszero(next)) {
-				struct shift_t *shift;
-				
-				shift = shift_new(down->idx + best->idx, integer_copy(zero));
-				avltree_insert(&downlist, shift->val, shift);
-				
-				shift = shift_new(down->idx + best->idx, integer_copy(zero));
-				avltree_insert(&uplist, shift->val, shift);
+			if(fixint_iszero(&next)) {
+				struct shift_t shift = { down.idx + best->idx, zero };
+
+				btree_insert(&downlist, &shift);
+				btree_insert(&uplist, &shift);
 
 				break;
 			}
 
 			// determine which list to add to
-			struct avltree_t *sel = next->neg ? &downlist : &uplist;
-			if(avltree_lookup(sel, next) != NULL)
+			struct btree_t *sel = next.neg ? &downlist : &uplist;
+			if(btree_lookup(sel, &next) != NULL)
 				continue;//fprintf(stderr, "Computed duplicate shift."), abort();
 
 			// create and add shift
-			struct shift_t *shift = shift_new(down->idx + best->idx, next);
-			avltree_insert(sel, shift->val, shift);
+			struct shift_t shift = { down.idx + best->idx, next };
+			btree_insert(sel, &shift);
 		}
-
-		/* cleanup */
-
-		integer_delete(dist);
 	}
 
 	// the running index
 	uint64_t idx = 0;
 
 	// create the first midpoint
-	struct integer_t *mid = integer_pow_mod(2, 54, mod);
-	struct integer_t *a = integer_pow_mod(5, exp - fact, mod);
+	struct fixint_t mid, a;
+	fixint_pow_mod(&mid, 2, 54, &red);
+	fixint_pow_mod(&a, 5, exp - fact, &red);
 	for(uint64_t i = 0; i < exp - fact; i++) {
-		integer_mul_ushort(&mid, 5);
-		integer_mod(&mid, mod);
+		fixint_mul_uint(&mid, 5);
+		fixint_mod(&mid, &red);
 	}
-	integer_add(&mid, a);
-	integer_mod(&mid, mod);
+	fixint_add(&mid, &a);
+	fixint_mod(&mid, &red);
 
 	//iprintf("first:
 
 	// the first shift might not be large enough
 	// ensure we take a many idx=1 shifts to get there
-	struct shift_t *shift = (struct shift_t *)avltree_last(mid->neg ? &uplist : &downlist);
-	while(integer_cmp(shift->val, mid) <= 0) {
+	struct shift_t *shift = (struct shift_t *)btree_last(mid.neg ? &uplist : &downlist);
+	while(fixint_cmp(&shift->val, &mid) <= 0) {
 		idx += shift->idx;
-		integer_add(&mid, shift->val);
+		fixint_add(&mid, &shift->val);
 	}
 
 	// calculate allowable error
-	struct integer_t *err = integer_pow_ushort(5, exp - fact);
+	struct fixint_t err;
+	fixint_pow(&err, 5, exp - fact);
 	for(int i = 0; i < 48; i++)
-		integer_div_ushort(&err, 2);
+		fixint_div_uint(&err, 2);
 
 	// iterate to find a minimal midpoint
 	while(true) {
-		shift = (struct shift_t *)avltree_atleast(mid->neg ? &uplist : &downlist, mid);
+		shift = (struct shift_t *)btree_atleast(mid.neg ? &uplist : &downlist, &mid);
 		if(shift == NULL)
 			break;
 		else if((idx + shift->idx) >= (1l << 52))
 			break;
 
 		idx += shift->idx;
-		integer_add(&mid, shift->val);
+		fixint_add(&mid, &shift->val);
 
-		if(integer_cmp(mid, err) < 0)
+		if(fixint_cmp(&mid, &err) < 0)
 			break;
 	}
 
 	// we detected that a failure may occur
 	if(idx < (1l << 52)) {
 		// list of possible failures and values to check
-		struct avltree_t errlist = avltree_empty((compare_f)integer_cmp, (delete_f)shift_delete);
-		struct avltree_t chklist = avltree_empty((compare_f)integer_cmp, NULL);
+		struct btree_t errlist = btree_empty(sizeof(struct shift_t), offsetof(struct shift_t, val), (btree_compare_f)fixint_cmp);
+		struct btree_t chklist = btree_empty(sizeof(struct shift_t), offsetof(struct shift_t, val), (btree_compare_f)fixint_cmp);
 
-		shift = shift_new(idx, integer_copy(mid));
-		avltree_insert(&errlist, shift->val, shift);
-		avltree_insert(&chklist, shift->val, shift);
+		struct shift_t found = { idx, mid };
+		btree_insert(&errlist, &found);
+		btree_insert(&chklist, &found);
 
 		while(chklist.count > 0) {
-			struct avltree_iter_t iter;
-			struct shift_t *base = (struct shift_t *)avltree_last(&chklist);
-			avltree_remove(&chklist, base->val);
+			struct btree_iter_t iter;
+			struct shift_t base = *(struct shift_t *)btree_last(&chklist);
+			btree_remove(&chklist, &base.val);
 
-			iter = avltree_iter_begin(&uplist);
-			while((shift = (struct shift_t *)avltree_iter_next(&iter)) != NULL) {
-				if(base->idx + shift->idx >= (1l << 52))
+			iter = btree_iter_begin(&uplist);
+			while((shift = (struct shift_t *)btree_iter_next(&iter)) != NULL) {
+				if(base.idx + shift->idx >= (1l << 52))
 					continue;
 
-				struct integer_t *sum = integer_copy(base->val);
-				integer_add(&sum, shift->val);
-				if(integer_cmp(sum, err) <= 0) {
-					if(avltree_lookup(&errlist, sum) != NULL)
+				struct fixint_t sum = base.val;
+				fixint_add(&sum, &shift->val);
+				if(fixint_cmp(&sum, &err) <= 0) {
+					if(btree_lookup(&errlist, &sum) != NULL)
 						continue;
 
-					shift = shift_new(base->idx + shift->idx, integer_copy(sum));
-					avltree_insert(&errlist, shift->val, shift);
-					avltree_insert(&chklist, shift->val, shift);
+					struct shift_t add = { base.idx + shift->idx, sum };
+					btree_insert(&errlist, &add);
+					btree_insert(&chklist, &add);
 				}
-				else {
-					integer_delete(sum);
+				else
 					break;
-				}
 			}
 
-			iter = avltree_iter_begin(&downlist);
-			while((shift = (struct shift_t *)avltree_iter_next(&iter)) != NULL) {
-				if(base->idx + shift->idx >= (1l << 52))
+			iter = btree_iter_begin(&downlist);
+			while((shift = (struct shift_t *)btree_iter_next(&iter)) != NULL) {
+				if(base.idx + shift->idx >= (1l << 52))
 					continue;
 
-				struct integer_t *sum = integer_copy(base->val);
-				integer_add(&sum, shift->val);
-				if(integer_cmp(sum, err) <= 0) {
-					if(avltree_lookup(&errlist, sum) != NULL)
+				struct fixint_t sum = base.val;
+				fixint_add(&sum, &shift->val);
+				if(fixint_cmp(&sum, &err) <= 0) {
+					if(btree_lookup(&errlist, &sum) != NULL)
 						continue;
 
-					shift = shift_new(base->idx + shift->idx, integer_copy(sum));
-					avltree_insert(&errlist, shift->val, shift);
-					avltree_insert(&chklist, shift->val, shift);
+					struct shift_t add = { base.idx + shift->idx, sum };
+					btree_insert(&errlist, &add);
+					btree_insert(&chklist, &add);
 				}
-				else {
-					integer_delete(sum);
+				else
 					break;
-				}
 			}
 		}
 
-		struct avltree_iter_t iter = avltree_iter_begin(&errlist);
-		while((shift = (struct shift_t *)avltree_iter_next(&iter)) != NULL) {
-			iprintf("val: %I\n", shift->val);
+		struct btree_iter_t iter = btree_iter_begin(&errlist);
+		while((shift = (struct shift_t *)btree_iter_next(&iter)) != NULL) {
+			iprintf("val: %F\n", &shift->val);
 			printf("here! 2^%d + 2^%d + %lu*2^%d\n", -exp + 54, -exp, shift->idx, -exp + 1);
 			double pred = ldexp((double)(shift->idx + 0) + (double)(1l << 53), -exp + 1);
 			double succ = ldexp((double)(shift->idx + 1) + (double)(1l << 53), -exp + 1);
@@ -538,26 +576,25 @@ void search_lower(int exp)
 			chk_errol(succ);
 		}
 
-		avltree_destroy(&errlist);
-		avltree_destroy(&chklist);
+		certify('l', exp, fact, &mod, &mid, idx, &errlist);
+
+		btree_destroy(&errlist);
+		btree_destroy(&chklist);
 	}
+	else
+		certify('l', exp, fact, &mod, &mid, idx, NULL);
 
 
 	//exp += fact;
-	//iprintf("mid: %I\n", mid);
+	//iprintf("mid: %F\n", &mid);
 	//iprintf("val: 2^%u + 2^%u + %l*2^%u\n", exp+53, exp, idx, exp+1);
-	//iprintf("%l %I\n", idx, mid);
+	//iprintf("%l %F\n", idx, &mid);
 
 	//
 
 
 	/* cleanup */
 
-	integer_delete(zero);
-	integer_delete(one);
-	integer_delete(init);
-	integer_delete(mid);
-	integer_delete(err);
-	avltree_destroy(&uplist);
-	avltree_destroy(&downlist);
+	btree_destroy(&uplist);
+	btree_destroy(&downlist);
 }
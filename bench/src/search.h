@@ -1,6 +1,9 @@
 #ifndef SEARCH_H
 #define SEARCH_H
 
+#include <stdio.h>
+
+void search_certify(FILE *file);
 void search_upper(int exp);
 void search_lower(int exp);
 
@@ -2,6 +2,7 @@
 #include <string.h>
 #include "errol.h"
 #include "fp.h"
+#include "wide.h"
 
 #define ERROL_LOOKUP
 
@@ -9,6 +10,13 @@
 #	include "lookup.h"
 #endif
 
+/*
+ * Building with 'ERROL_COMPACT' rebuilds the power table rows from every
+ * 'LOOKUP_COMPACT_STEP'-th power and finds the decade without the exponent
+ * and threshold tables, cutting the tables read per conversion from about
+ * 19 KB to 1.3 KB at the cost of a multiply per row.
+ */
+
 static const double tens[] = {
 	1e22,
 	1e21,
@@ -35,6 +43,108 @@ static const double tens[] = {
 	1e00
 };
 
+/**
+ * Fold a table into a running FNV-1a hash.
+ *   @hash: The running hash.
+ *   @table: The table.
+ *   @size: The size of the table in bytes.
+ *   &returns: The updated hash.
+ */
+
+static uint64_t errol_hash_table(uint64_t hash, const void *table, size_t size)
+{
+	size_t i;
+	const uint8_t *ptr = (const uint8_t *)table;
+
+	for(i = 0; i < size; i++)
+		hash = (hash ^ ptr[i]) * 0x100000001b3;
+
+	return hash;
+}
+
+/**
+ * Compute a hash of the lookup tables, identifying the table build. Every
+ * table read by 'errol_short' is folded in, so changing any of them changes
+ * the hash.
+ *   &returns: The 64-bit FNV-1a hash of the table contents.
+ */
+
+_export
+uint64_t errol_table_hash(void)
+{
+	uint64_t hash = 0xcbf29ce484222325;
+
+#ifdef ERROL_COMPACT
+	hash = errol_hash_table(hash, lookup_compact, sizeof(lookup_compact));
+	hash = errol_hash_table(hash, lookup_compact_small, sizeof(lookup_compact_small));
+#else
+	hash = errol_hash_table(hash, lookup_table, sizeof(lookup_table));
+	hash = errol_hash_table(hash, lookup_exp, sizeof(lookup_exp));
+	hash = errol_hash_table(hash, lookup_thr, sizeof(lookup_thr));
+#endif
+
+	return hash;
+}
+
+/**
+ * Retrieve the size of the power tables read during conversion.
+ *   &returns: The size in bytes.
+ */
+
+_export
+size_t errol_table_size(void)
+{
+#ifdef ERROL_COMPACT
+	return sizeof(lookup_compact) + sizeof(lookup_compact_small);
+#else
+	return sizeof(lookup_table) + sizeof(lookup_exp) + sizeof(lookup_thr);
+#endif
+}
+
+/**
+ * Retrieve a row of the power table, holding 10^(308-idx).
+ *   @idx: The row.
+ *   &returns: The power as a double-double.
+ */
+
+static inline struct hp_t errol_row(int32_t idx)
+{
+#ifdef ERROL_COMPACT
+	int32_t j = 308 - idx + LOOKUP_COMPACT_OFF;
+
+	return fp_prod24(lookup_compact[j / LOOKUP_COMPACT_STEP], lookup_compact_small[j % LOOKUP_COMPACT_STEP]);
+#else
+	return lookup_table[idx];
+#endif
+}
+
+/**
+ * Find the power table row of a binary exponent, closest to scaling a value
+ * into [0.1, 1). The compact build stops at the lower decade of the binade,
+ * leaving the callers to adjust a scaled value past one.
+ *   @val: The value.
+ *   @e: The binary exponent.
+ *   &returns: The unclamped row.
+ */
+
+static inline int32_t errol_decade(double val, int32_t e)
+{
+#ifdef ERROL_COMPACT
+	return (((e - 1) * 78913) >> 18) + 309;
+#else
+	int32_t i = lookup_exp[e + LOOKUP_EXP_OFF];
+
+	return i + (val >= lookup_thr[i + LOOKUP_THR_OFF]);
+#endif
+}
+
+/*
+ * scaling prologue and digit loop, shared with 'errol.hpp'
+ */
+
+#include "shortest.h"
+
+
 /**
  * Double to string conversion, producing maximum precision.
  *   @val: The value.
@@ -78,7 +188,7 @@ int32_t errol_str(double val, char *buf)
 {
 	int hdig, mdig, ldig;
 	int32_t exp;
-	struct hp_t high, mid, low;
+	struct hp_t high, mid, low, row;
 
 	if((val == 0.0) || (val == -0.0))
 		return buf[0] = '\0', 0;
@@ -94,17 +204,17 @@ int32_t errol_str(double val, char *buf)
 	else if(exp >= LOOKUP_TABLE_LEN)
 		exp = LOOKUP_TABLE_LEN - 1;
 
-	mid = lookup_table[exp];
-	mid = fp_prod(mid, val);
+	row = errol_row(exp);
+	mid = fp_prod(row, val);
 
 	high.val = mid.val;
-	//high.err = mid.err + (nextafter(val, INFINITY) - val) * lookup_table[exp].val / 2.000000000001;
-	high.err = mid.err + (nextafter(val, INFINITY) - val) * lookup_table[exp].val / 2;
-	//high.err = mid.err + (nextafter(val, INFINITY) - val) / 2.000000000001 * lookup_table[exp].val;
+	//high.err = mid.err + (nextafter(val, INFINITY) - val) * row.val / 2.000000000001;
+	high.err = mid.err + (nextafter(val, INFINITY) - val) * row.val / 2;
+	//high.err = mid.err + (nextafter(val, INFINITY) - val) / 2.000000000001 * row.val;
 
 	low.val = mid.val;
-	low.err = mid.err + (nextafter(val, -INFINITY) - val) * lookup_table[exp].val / 2;
-	//low.err = mid.err + (nextafter(val, -INFINITY) - val) / 2.000000000001 * lookup_table[exp].val;
+	low.err = mid.err + (nextafter(val, -INFINITY) - val) * row.val / 2;
+	//low.err = mid.err + (nextafter(val, -INFINITY) - val) / 2.000000000001 * row.val;
 
 	exp -= 308;
 #else
@@ -167,23 +277,6 @@ static inline uint64_t rdtsc()
 	return ((uint64_t)a) | (((uint64_t)d) << 32);
 }
 
-static inline double getprev(double d)
-{
-	union { double d; uint64_t i; } u = { .d = d };
-
-	u.i--;
-	return u.d;
-}
-
-static inline double getnext(double d)
-{
-	union { double d; uint64_t i; } u = { .d = d };
-
-	u.i++;
-	return u.d;
-}
-
-
 /**
  * A simple implementation of Errol that does not use many optimizations.
  *   @val: The value.
@@ -196,30 +289,9 @@ int32_t errol_simple(double val, char *buf)
 {
 	uint32_t hdig, ldig;
 	int32_t exp;
-	struct hp_t high, mid, low;
-
-	int e;
-	frexp(val, &e);
-	exp = 309 + (double)e*0.30103; //0.30103 = log_10(2)
-	if(exp < 0)
-		exp = 0;
-	else if(exp >= LOOKUP_TABLE_LEN)
-		exp = LOOKUP_TABLE_LEN - 1;
-
-	mid = lookup_table[exp];
-	mid = fp_prod(mid, val);
-
-	high.val = low.val = mid.val;
-	high.err = mid.err + (getnext(val) - val) * lookup_table[exp].val / 2.0000000000000016;
-	low.err = mid.err + (getprev(val) - val) * lookup_table[exp].val / 2.0000000000000016;
-
-	exp -= 308;
-
-	while(high.val < 0.1 || (high.val == 0.1 && high.err < hp_tenth.err))
-		exp--, fp_mul(&high), fp_mul(&low);
+	struct hp_t high, low;
 
-	while(high.val > 1.0 || (high.val == 1.0 && high.err >= 0.0))
-		exp++, fp_div(&high), fp_div(&low);
+	exp = errol_scale(val, 2.0000000000000016, &high, &low);
 
 	while(1) {
 		fp_mul(&high);
@@ -251,30 +323,9 @@ int32_t errol_fast(double val, char *buf)
 {
 	uint32_t hdig, ldig;
 	int32_t exp;
-	struct hp_t high, mid, low;
-
-	int e;
-	frexp(val, &e);
-	exp = 309 + (double)e*0.30103; //0.30103 = log_10(2)
-	if(exp < 0)
-		exp = 0;
-	else if(exp >= LOOKUP_TABLE_LEN)
-		exp = LOOKUP_TABLE_LEN - 1;
-
-	mid = lookup_table[exp];
-	mid = fp_prod(mid, val);
+	struct hp_t high, low;
 
-	high.val = low.val = mid.val;
-	high.err = mid.err + (getnext(val) - val) * lookup_table[exp].val / 2.0000000000000016;
-	low.err = mid.err + (getprev(val) - val) * lookup_table[exp].val / 2.0000000000000016;
-
-	exp -= 308;
-
-	while(high.val < 0.1 || (high.val == 0.1 && high.err < hp_tenth.err))
-		exp--, fp_mul(&high), fp_mul(&low);
-
-	while(high.val > 1.0 || (high.val == 1.0 && high.err >= 0.0))
-		exp++, fp_div(&high), fp_div(&low);
+	exp = errol_scale(val, 2.0000000000000016, &high, &low);
 
 	while(1) {
 		high = hp_mul10000(high);
@@ -330,143 +381,1153 @@ int32_t errol_fast(double val, char *buf)
  *   @buf: The output buffer.
  *   &returns: The exponent.
  */
-char allzero(const char *str)
+
+_export
+int32_t errol_short(double val, char *buf)
 {
-	while(*str == '0')
-		str++;
+	int32_t exp;
 
-	return *str == '\0';
+	buf[errol_short_conv(val, buf, &exp)] = '\0';
+
+	return exp;
 }
 
-_export
-int32_t errol_short(double val, char *buf)
+
+/*
+ * exact conversion definitions
+ *   @ERROL_BIG_LEN: The number of words in an exact integer, enough for the
+ *     extended formats.
+ *   @ERROL_PREC_MAX: The most digits rounded in high precision.
+ *   @ERROL_PREC_TOL: The distance from a tie resolved in high precision.
+ */
+
+#define ERROL_BIG_LEN	368
+#define ERROL_PREC_MAX	20
+#define ERROL_PREC_TOL	9.313225746154785e-10
+
+/**
+ * Exact unsigned integer.
+ *   @len: The number of words in use.
+ *   @word: The words, least significant first.
+ */
+
+struct big_t {
+	int32_t len;
+	uint32_t word[ERROL_BIG_LEN];
+};
+
+
+/**
+ * Set an exact integer.
+ *   @big: The integer.
+ *   @val: The value.
+ */
+
+static void big_set(struct big_t *big, uint64_t val)
+{
+	big->word[0] = (uint32_t)val;
+	big->word[1] = (uint32_t)(val >> 32);
+	big->len = (val >> 32) ? 2 : ((val != 0) ? 1 : 0);
+}
+
+/**
+ * Multiply an exact integer by a word.
+ *   @big: The integer.
+ *   @val: The multiplier.
+ */
+
+static void big_mul(struct big_t *big, uint32_t val)
 {
-	if(val == 4.503599627370496e+38) {
-		strcpy(buf, "4503599627370496");
-		return 39;
+	int32_t i;
+	uint64_t carry = 0;
+
+	for(i = 0; i < big->len; i++) {
+		carry += (uint64_t)big->word[i] * val;
+		big->word[i] = (uint32_t)carry;
+		carry >>= 32;
 	}
-	else if((val < 1.80143985094820e+16) || (val >= 3.40282366920938e+38)) {
-		uint32_t hdig, ldig;
-		int32_t exp;
-		struct hp_t high, mid, low;
-
-		int e;
-		frexp(val, &e);
-		exp = 309 + (double)e*0.30103; //0.30103 = log_10(2)
-		if(exp < 0)
-			exp = 0;
-		else if(exp >= LOOKUP_TABLE_LEN)
-			exp = LOOKUP_TABLE_LEN - 1;
-
-		mid = lookup_table[exp];
-		mid = fp_prod(mid, val);
-
-		high.val = low.val = mid.val;
-		high.err = mid.err + (getnext(val) - val) * lookup_table[exp].val / 2;
-		low.err = mid.err + (getprev(val) - val) * lookup_table[exp].val / 2;
-
-		exp -= 308;
-
-		while(high.val < 0.1 || (high.val == 0.1 && high.err < hp_tenth.err))
-			exp--, fp_mul(&high), fp_mul(&low);
-
-		while(high.val > 1.0 || (high.val == 1.0 && high.err >= 0.0))
-			exp++, fp_div(&high), fp_div(&low);
-
-		while(1) {
-			high = hp_mul10000(high);
-			low = hp_mul10000(low);
-
-			uint16_t h = (uint16_t)high.val;
-			high.val -= h;
-			if(high.val == 0.0 && high.err < 0)
-				h -= 1, high.val += 1.0;
-
-			uint16_t l = (uint16_t)low.val;
-			low.val -= l;
-			if(low.val == 0.0 && low.err < 0)
-				l -= 1, low.val += 1.0;
-
-			hdig = h / 1000;
-			ldig = l / 1000;
-			*buf++ = hdig + '0';
-			if(ldig != hdig)
-				break;
-
-			h -= hdig * 1000;
-			l -= ldig * 1000;
-			hdig = h/100;
-			ldig = l/100;
-			*buf++ = hdig + '0';
-			if(ldig != hdig)
-				break;
-
-			h -= hdig * 100;
-			l -= ldig * 100;
-			hdig = h/10;
-			ldig = l/10;
-			*buf++ = hdig + '0';
-			if(ldig != hdig)
-				break;
-
-			hdig = h % 10;
-			ldig = l % 10;
-			*buf++ = hdig + '0';
-			if(ldig != hdig)
-				break;
-		}
 
-		*buf = '\0';
+	if(carry != 0)
+		big->word[big->len++] = (uint32_t)carry;
+}
 
-		return exp;
+/**
+ * Multiply an exact integer by a power of five.
+ *   @big: The integer.
+ *   @exp: The exponent.
+ */
+
+static void big_pow5(struct big_t *big, int32_t exp)
+{
+	int32_t n;
+
+	/* 5^n is 10^n shifted right by n, and 5^13 is the largest fitting a word */
+
+	for(; exp > 0; exp -= n) {
+		n = (exp > 13) ? 13 : exp;
+		big_mul(big, (uint32_t)(u64_pow10[n] >> n));
 	}
-	else {
-		int8_t i, j;
-		int32_t exp;
-		union { double d; uint64_t i; } bits;
-		char lstr[41], hstr[41];
-		uint64_t l64, h64;
-		__uint128_t v, low, high, pow19 = (__uint128_t)1e19;
-
-		low = (__uint128_t)val - (__uint128_t)((nextafter(val, INFINITY) -val) / 2.0);
-		high = (__uint128_t)val + (__uint128_t)((val - nextafter(val, -INFINITY)) / 2.0);
-
-		bits.d = val;
-		if(bits.i & 0x1)
-			low++, high--;
-
-		i = 39;
-		lstr[40] = hstr[40] = '\0';
-		while(high != 0) {
-			l64 = low % pow19;
-			low /= pow19;
-			h64 = high % pow19;
-			high /= pow19;
-
-			for(j = 0; ((high != 0) && (j < 19)) || ((high == 0) && (h64 != 0)); j++, i--) {
-				lstr[i] = '0' + l64 % (uint64_t)10;
-				hstr[i] = '0' + h64 % (uint64_t)10;
-
-				l64 /= 10;
-				h64 /= 10;
-			}
-		}
+}
+
+/**
+ * Shift an exact integer left.
+ *   @big: The integer.
+ *   @n: The number of bits.
+ */
+
+static void big_shl(struct big_t *big, int32_t n)
+{
+	int32_t i, w = n / 32, b = n % 32;
+
+	if(big->len == 0)
+		return;
+
+	if(b != 0) {
+		big->word[big->len] = 0;
+		for(i = big->len; i > 0; i--)
+			big->word[i] = (big->word[i] << b) | (big->word[i - 1] >> (32 - b));
+
+		big->word[0] <<= b;
+		big->len += (big->word[big->len] != 0);
+	}
+
+	memmove(big->word + w, big->word, big->len * sizeof(uint32_t));
+	memset(big->word, 0, w * sizeof(uint32_t));
+	big->len += w;
+}
+
+/**
+ * Add a 64-bit value to an exact integer.
+ *   @big: The integer.
+ *   @val: The value.
+ */
+
+static void big_add(struct big_t *big, uint64_t val)
+{
+	int32_t i;
+	uint64_t sum;
+
+	for(i = 0; val != 0; i++) {
+		if(i == big->len)
+			big->word[big->len++] = 0;
+
+		sum = (uint64_t)big->word[i] + (uint32_t)val;
+		big->word[i] = (uint32_t)sum;
+		val = (val >> 32) + (sum >> 32);
+	}
+}
+
+/**
+ * Compare two exact integers.
+ *   @a: The first integer.
+ *   @b: The second integer.
+ *   &returns: Negative, zero, or positive as the first is less, equal, or greater.
+ */
+
+static int32_t big_cmp(const struct big_t *a, const struct big_t *b)
+{
+	int32_t i;
+
+	if(a->len != b->len)
+		return a->len - b->len;
+
+	for(i = a->len - 1; i >= 0; i--) {
+		if(a->word[i] != b->word[i])
+			return (a->word[i] > b->word[i]) ? 1 : -1;
+	}
+
+	return 0;
+}
+
+/**
+ * Subtract an exact integer from a larger one.
+ *   @a: The minuend, receiving the difference.
+ *   @b: The subtrahend.
+ */
+
+static void big_sub(struct big_t *a, const struct big_t *b)
+{
+	int32_t i;
+	int64_t borrow = 0;
+
+	for(i = 0; i < a->len; i++) {
+		borrow += (int64_t)a->word[i] - ((i < b->len) ? b->word[i] : 0);
+		a->word[i] = (uint32_t)borrow;
+		borrow >>= 32;
+	}
+
+	while((a->len > 0) && (a->word[a->len - 1] == 0))
+		a->len--;
+}
+
+
+/**
+ * Scale a value into the range [0.1, 1).
+ *   @val: The value.
+ *   @mid: Out. The scaled value.
+ *   &returns: The decimal exponent.
+ */
+
+static inline int32_t errol_mid(double val, struct hp_t *mid)
+{
+	int32_t i, idx;
+
+	i = errol_index(val, &idx);
+	*mid = fp_prod(errol_row(idx), val);
+
+	for(; idx > i; idx--)
+		fp_mul(mid);
+
+	for(; idx < i; idx++)
+		fp_div(mid);
+
+	if((mid->val > 1.0) || ((mid->val == 1.0) && (mid->err >= 0.0)))
+		i++, fp_div(mid);
+
+	return i - 308;
+}
+
+/**
+ * Generate the leading digits of a scaled value in high precision, and
+ * decide the rounding of the last digit. The remainder carries an error
+ * well below the tolerance for at most 'ERROL_PREC_MAX' digits, so only a
+ * remainder within the tolerance of a tie is left undecided.
+ *   @mid: The scaled value, in the range [0.1, 1).
+ *   @n: The number of digits.
+ *   @buf: The output buffer.
+ *   &returns: One to round up, zero to round down, negative if undecided.
+ */
+
+static int32_t errol_near(struct hp_t mid, int32_t n, char *buf)
+{
+	int32_t i;
+	uint32_t dig;
+	double diff;
+
+	for(i = 0; i + 4 <= n; i += 4) {
+		mid = hp_mul10000(mid);
+
+		dig = (uint32_t)mid.val;
+		mid.val -= dig;
+		if((mid.val == 0.0) && (mid.err < 0.0))
+			dig -= 1, mid.val += 1.0;
+
+		u64_write(dig, 4, buf + i);
+	}
+
+	for(; i < n; i++) {
+		fp_mul(&mid);
 
-		exp = 39 - i++;
+		dig = (uint32_t)mid.val;
+		mid.val -= dig;
+		if((mid.val == 0.0) && (mid.err < 0.0))
+			dig -= 1, mid.val += 1.0;
 
-		do
-			*buf++ = hstr[i++];
-		while(hstr[i] == lstr[i]);
+		buf[i] = '0' + dig;
+	}
+
+	diff = (mid.val - 0.5) + mid.err;
+	if(fabs(diff) <= ERROL_PREC_TOL)
+		return -1;
+
+	return diff > 0.0;
+}
+
+/**
+ * Generate the leading digits of a value with exact integer arithmetic, and
+ * decide the rounding of the last digit, breaking ties to even.
+ *   @val: The value.
+ *   @exp: The decimal exponent of the value.
+ *   @n: The number of digits.
+ *   @buf: The output buffer.
+ *   &returns: One to round up, zero to round down.
+ */
 
-		if(allzero(lstr+i) || allzero(hstr+i)) {
-			while(buf[-1] == '0')
-				buf--;
+static int32_t errol_exact(double val, int32_t exp, int32_t n, char *buf)
+{
+	union { double d; uint64_t i; } bits;
+	int32_t i, t, cmp;
+	uint32_t dig;
+	uint64_t m;
+	struct big_t num, den;
+
+	bits.d = val;
+	m = bits.i & (((uint64_t)1 << 52) - 1);
+	t = bits.i >> 52;
+	if(t != 0)
+		m |= (uint64_t)1 << 52, t -= 1075;
+	else
+		t = -1074;
+
+	/* the value divided by the power of ten is 'num / den', in the range [0.1, 1) */
+
+	big_set(&num, m);
+	big_set(&den, 1);
+
+	if(exp > 0)
+		big_pow5(&den, exp);
+	else
+		big_pow5(&num, -exp);
+
+	if(t > exp)
+		big_shl(&num, t - exp);
+	else
+		big_shl(&den, exp - t);
+
+	for(i = 0; i < n; i++) {
+		if(num.len == 0) {
+			memset(buf + i, '0', n - i);
+			return 0;
 		}
-		else
-			*buf++ = hstr[i];
 
-		*buf = '\0';
+		big_mul(&num, 10);
+		for(dig = 0; big_cmp(&num, &den) >= 0; dig++)
+			big_sub(&num, &den);
 
-		return exp;
+		buf[i] = '0' + dig;
+	}
+
+	big_shl(&num, 1);
+	cmp = big_cmp(&num, &den);
+
+	return (cmp > 0) || ((cmp == 0) && (n > 0) && ((buf[n - 1] - '0') & 0x1));
+}
+
+/**
+ * Round a digit string up by one unit in the last place.
+ *   @buf: The digits.
+ *   @n: The number of digits.
+ *   &returns: One if the carry passes the first digit, leaving a leading one, zero otherwise.
+ */
+
+static inline int32_t errol_up(char *buf, int32_t n)
+{
+	while((n > 0) && (buf[n - 1] == '9'))
+		buf[--n] = '0';
+
+	if(n == 0)
+		return buf[0] = '1', 1;
+
+	buf[n - 1]++;
+
+	return 0;
+}
+
+/**
+ * Convert an integer below 2^64 to a number of significant digits, rounding
+ * to nearest with ties to even.
+ *   @val: The value.
+ *   @n: The number of digits.
+ *   @buf: The output buffer.
+ *   &returns: The exponent.
+ */
+
+static int32_t errol_intprec(uint64_t val, int32_t n, char *buf)
+{
+	int32_t d = u64_digits(val);
+	uint64_t p, r;
+
+	if(n >= d) {
+		u64_write(val, d, buf);
+		memset(buf + d, '0', n - d);
+
+		return d;
 	}
+
+	p = u64_pow10[d - n];
+	r = val % p;
+	val /= p;
+	val += (r > p - r) || ((r == p - r) && (val & 0x1));
+
+	u64_write(val, n, buf);
+	if(val == u64_pow10[n])
+		buf[0] = '1', d++;
+
+	return d;
+}
+
+/**
+ * Convert to a number of significant digits, correctly rounded to nearest
+ * with ties to even. The digits are generated in high precision, and only
+ * a remainder too near a tie, or more digits than high precision carries,
+ * falls back to exact integer arithmetic.
+ *   @val: The value, non-negative and finite.
+ *   @ndigits: The number of digits, at least one.
+ *   @buf: The output buffer, of at least 'ndigits + 1' bytes.
+ *   &returns: The exponent.
+ */
+
+_export
+int32_t errol_precision(double val, int32_t ndigits, char *buf)
+{
+	int32_t exp, up;
+	struct hp_t mid;
+
+	buf[ndigits] = '\0';
+
+	if(val == 0.0)
+		return memset(buf, '0', ndigits), 1;
+	else if(errol_isint(val))
+		return errol_intprec((uint64_t)val, ndigits, buf);
+
+	exp = errol_mid(val, &mid);
+	up = (ndigits <= ERROL_PREC_MAX) ? errol_near(mid, ndigits, buf) : -1;
+	if(up < 0)
+		up = errol_exact(val, exp, ndigits, buf);
+
+	if(up)
+		exp += errol_up(buf, ndigits);
+
+	return exp;
 }
+
+/**
+ * Convert to a number of digits after the decimal point, correctly rounded
+ * to nearest with ties to even. The buffer receives 'exp + frac' digits,
+ * and is empty when the value rounds to zero.
+ *   @val: The value, non-negative and finite.
+ *   @frac: The number of fractional digits, at least zero.
+ *   @buf: The output buffer, of at least 'frac + 311' bytes.
+ *   &returns: The exponent.
+ */
+
+_export
+int32_t errol_fixed(double val, int32_t frac, char *buf)
+{
+	int32_t exp, n, up;
+	struct hp_t mid;
+
+	if(val == 0.0)
+		return buf[0] = '\0', -frac;
+	else if(errol_isint(val)) {
+		exp = u64_digits((uint64_t)val);
+		u64_write((uint64_t)val, exp, buf);
+		memset(buf + exp, '0', frac);
+		buf[exp + frac] = '\0';
+
+		return exp;
+	}
+
+	exp = errol_mid(val, &mid);
+	n = exp + frac;
+	if(n < 0)
+		return buf[0] = '\0', -frac;
+
+	up = (n <= ERROL_PREC_MAX) ? errol_near(mid, n, buf) : -1;
+	if(up < 0)
+		up = errol_exact(val, exp, n, buf);
+
+	if(up && errol_up(buf, n)) {
+		if(n > 0)
+			buf[n] = '0';
+
+		n++, exp++;
+	}
+
+	buf[n] = '\0';
+
+	return exp;
+}
+
+/**
+ * Convert to exactly 17 significant digits, correctly rounded to nearest
+ * with ties to even. Seventeen digits always parse back to the same double,
+ * which suits binary-exact dumps that need no shortest form. A single exact
+ * product by 10^17 leaves the digits as one integer, and the rounding to the
+ * fraction, without tracking the rounding interval; only a fraction within
+ * the tolerance of a tie falls back to 'errol_precision'.
+ *   @val: The value, non-negative and finite.
+ *   @buf: The output buffer, of at least 18 bytes.
+ *   &returns: The exponent.
+ */
+
+_export
+int32_t errol_roundtrip(double val, char *buf)
+{
+	int32_t exp;
+	uint64_t dig;
+	double fl, diff;
+	struct hp_t mid;
+
+	if((val == 0.0) || errol_isint(val))
+		return errol_precision(val, 17, buf);
+
+	/* the product lies past 2^53, so its leading double is an integer */
+
+	exp = errol_mid(val, &mid);
+	mid = fp_prod(mid, 1e17);
+
+	fl = floor(mid.err);
+	dig = (uint64_t)mid.val + (int64_t)fl;
+	diff = (mid.err - fl) - 0.5;
+
+	if((fabs(diff) <= ERROL_PREC_TOL) || (dig < u64_pow10[16]))
+		return errol_precision(val, 17, buf);
+
+	dig += (diff > 0.0);
+	if(dig == u64_pow10[17])
+		dig = u64_pow10[16], exp++;
+
+	u64_write(dig, 17, buf);
+	buf[17] = '\0';
+
+	return exp;
+}
+
+/*
+ * string to double definitions
+ *   @ERROL_STRTOD_DIGITS: The most digits read exactly. A tie between two
+ *     doubles has at most 767 significant digits, so the later digits only
+ *     place the value above the kept ones.
+ *   @ERROL_STRTOD_TOL: The distance from a tie resolved exactly when more
+ *     than 19 digits are given, covering the truncated digits.
+ */
+
+#define ERROL_STRTOD_DIGITS	800
+#define ERROL_STRTOD_TOL	0.015625
+
+
+/**
+ * Decide exactly whether a decimal value lies above the midpoint between
+ * two neighbouring doubles.
+ *   @digits: The digits, without leading zeros.
+ *   @len: The number of digits.
+ *   @exp: The decimal exponent of the last digit.
+ *   @low: The lower mantissa of the pair.
+ *   @bexp: The binary exponent of the mantissas.
+ *   &returns: The correctly rounded mantissa.
+ */
+
+static uint64_t errol_strtod_exact(const char *digits, int32_t len, int32_t exp, uint64_t low, int32_t bexp)
+{
+	int32_t i, n, cmp;
+	uint32_t chunk;
+	struct big_t val, mid;
+
+	n = (len > ERROL_STRTOD_DIGITS) ? ERROL_STRTOD_DIGITS : len;
+
+	big_set(&val, 0);
+	for(i = 0; i < n; i++) {
+		big_mul(&val, 10);
+		big_add(&val, digits[i] - '0');
+	}
+
+	exp += len - n;
+	if(n < len) {
+		for(chunk = 0, i = n; i < len; i++)
+			chunk |= digits[i] - '0';
+
+		big_mul(&val, 10);
+		big_add(&val, chunk != 0);
+		exp--;
+	}
+
+	/* compare val * 10^exp against (2 low + 1) * 2^(bexp - 1) */
+
+	big_set(&mid, 2 * low + 1);
+	bexp--;
+
+	if(exp >= 0)
+		big_pow5(&val, exp);
+	else
+		big_pow5(&mid, -exp);
+
+	if(exp > bexp)
+		big_shl(&val, exp - bexp);
+	else
+		big_shl(&mid, bexp - exp);
+
+	cmp = big_cmp(&val, &mid);
+
+	return ((cmp > 0) || ((cmp == 0) && (low & 1))) ? (low + 1) : low;
+}
+
+/**
+ * Convert a decimal string to the nearest double, rounding ties to even. The
+ * leading 19 digits are multiplied by a row of the power table in double-
+ * double arithmetic, leaving the product within a few units of 2^-100 of the
+ * value. Unless the product lies within the tolerance of a tie between two
+ * doubles, rounding it directly is correct; otherwise the digits are
+ * compared exactly against the midpoint.
+ *   @digits: The digits, with no sign or decimal point.
+ *   @len: The number of digits.
+ *   @exp: The decimal exponent of the last digit.
+ *   &returns: The double nearest to the digits scaled by 10^exp.
+ */
+
+_export
+double errol_strtod(const char *digits, int32_t len, int32_t exp)
+{
+	int32_t i, n, e, q, scale;
+	uint64_t m, k;
+	double y, w, f, d, tol;
+	struct hp_t val;
+
+	while((len > 0) && (*digits == '0'))
+		digits++, len--;
+
+	while((len > 0) && (digits[len - 1] == '0'))
+		len--, exp++;
+
+	if(len == 0)
+		return 0.0;
+
+	n = (len > 19) ? 19 : len;
+	for(m = 0, i = 0; i < n; i++)
+		m = 10 * m + (digits[i] - '0');
+
+	e = exp + (len - n);
+	if((len == n) && (m < ((uint64_t)1 << 53)) && (e >= -22) && (e <= 22))
+		return (e >= 0) ? ((double)m * tens[22 - e]) : ((double)m / tens[22 + e]);
+
+	if(e + n > 309)
+		return INFINITY;
+	else if(e + n < -324)
+		return 0.0;
+
+	/* the truncated digits place the value anywhere above m */
+
+	val.val = (double)m;
+	val.err = (double)(int64_t)(m - (uint64_t)val.val);
+	tol = ERROL_PREC_TOL;
+	if(len > n)
+		val.err += 0.5, tol = ERROL_STRTOD_TOL;
+
+	/* scale by a power of two to keep every product normal */
+
+	scale = 0;
+	if(e < -200)
+		scale = 256;
+	else if(e > 200)
+		scale = -128;
+
+	val.val *= fp_pow2(scale);
+	val.err *= fp_pow2(scale);
+
+	if(e < -291) {
+		val = fp_prodhp(val, errol_row(599));
+		e += 291;
+	}
+
+	val = fp_prodhp(val, errol_row(308 - e));
+
+	/* round on the grid of doubles, finer just below a power of two */
+
+	if((fp_mant(val.val, &q) == ((uint64_t)1 << 52)) && (val.err < 0.0))
+		q--;
+
+	if(q < scale - 1074)
+		q = scale - 1074;
+
+	y = val.val * fp_pow2(-q);
+	f = floor(y);
+	w = (y - f) + val.err * fp_pow2(-q);
+	d = floor(w + 0.5);
+	k = (uint64_t)f + (int64_t)d;
+	d = (w + 0.5) - d;
+
+	if(d <= tol)
+		k = errol_strtod_exact(digits, len, exp, k - 1, q - scale);
+	else if(d >= 1.0 - tol)
+		k = errol_strtod_exact(digits, len, exp, k, q - scale);
+
+	return (scale == 0) ? ((double)k * fp_pow2(q)) : ldexp((double)k, q - scale);
+}
+
+
+/*
+ * extended conversion definitions
+ *   @ERROL_EXT_ERR: The bit length of the error bound of a scaled value, in
+ *     units of 2^-256. The power of ten carries a relative error below
+ *     2^-190, and truncating the product adds one unit.
+ */
+
+#define ERROL_EXT_ERR	68
+
+
+/**
+ * Retrieve a power of ten for the extended formats, as the product of a
+ * table power and an exact small power, truncated to 192 bits.
+ *   @j: The decimal exponent.
+ *   @mant: Out. The mantissa, least significant word first.
+ *   &returns: The binary exponent.
+ */
+
+static int32_t ext_pow10(int32_t j, uint64_t *mant)
+{
+	int32_t a, i, k, sh;
+	uint64_t prod[6] = { 0 };
+	const struct lookup_ext_t *big, *small;
+	__uint128_t carry;
+
+	a = (j >= 0) ? (j / 64) : -((63 - j) / 64);
+	big = &lookup_ext[a + LOOKUP_EXT_OFF];
+	small = &lookup_ext_small[j - 64 * a];
+
+	for(i = 0; i < 3; i++) {
+		carry = 0;
+		for(k = 0; k < 3; k++) {
+			carry += (__uint128_t)big->mant[2 - i] * small->mant[2 - k] + prod[i + k];
+			prod[i + k] = (uint64_t)carry;
+			carry >>= 64;
+		}
+
+		prod[i + 3] = (uint64_t)carry;
+	}
+
+	/* the product lies in [2^382, 2^384) */
+
+	sh = (prod[5] >> 63) ? 0 : 1;
+	for(i = 0; i < 3; i++)
+		mant[i] = sh ? ((prod[i + 3] << 1) | (prod[i + 2] >> 63)) : prod[i + 3];
+
+	return big->exp + small->exp + 192 - sh;
+}
+
+/**
+ * Count the significant bits of a nonzero 128-bit integer.
+ *   @val: The value.
+ *   &returns: The number of bits.
+ */
+
+static inline int32_t u128_bits(__uint128_t val)
+{
+	if(val >> 64)
+		return 128 - __builtin_clzl((uint64_t)(val >> 64));
+	else
+		return 64 - __builtin_clzl((uint64_t)val);
+}
+
+/**
+ * Retrieve 64 bits of a multiword integer at a bit position.
+ *   @w: The words, least significant first.
+ *   @n: The number of words.
+ *   @pos: The bit position, possibly negative.
+ *   &returns: The bits.
+ */
+
+static inline uint64_t ext_bits(const uint64_t *w, int32_t n, int32_t pos)
+{
+	int32_t i = (pos >= 0) ? (pos / 64) : -((63 - pos) / 64), sh = pos - 64 * i;
+	uint64_t lo, hi;
+
+	lo = ((i >= 0) && (i < n)) ? w[i] : 0;
+	hi = ((i + 1 >= 0) && (i + 1 < n)) ? w[i + 1] : 0;
+
+	return (sh == 0) ? lo : ((lo >> sh) | (hi << (64 - sh)));
+}
+
+/**
+ * Scale a bound by a power of ten into a 256-bit fraction.
+ *   @b: The bound.
+ *   @mant: The mantissa of the power, least significant word first.
+ *   @sh: The binary exponent of the product in the fraction.
+ *   @frac: Out. The fraction, least significant word first.
+ *   &returns: True if the scaled value reaches one, false otherwise.
+ */
+
+static char ext_scale(__uint128_t b, const uint64_t *mant, int32_t sh, uint64_t *frac)
+{
+	int32_t i, k;
+	uint64_t bw[2] = { (uint64_t)b, (uint64_t)(b >> 64) }, prod[5] = { 0 };
+	__uint128_t carry;
+
+	for(i = 0; i < 2; i++) {
+		carry = 0;
+		for(k = 0; k < 3; k++) {
+			carry += (__uint128_t)bw[i] * mant[k] + prod[i + k];
+			prod[i + k] = (uint64_t)carry;
+			carry >>= 64;
+		}
+
+		prod[i + 3] += (uint64_t)carry;
+	}
+
+	for(i = 4; prod[i] == 0; i--);
+	if(64 * i + 64 - __builtin_clzl(prod[i]) + sh > 256)
+		return 1;
+
+	for(i = 0; i < 4; i++)
+		frac[i] = ext_bits(prod, 5, 64 * i - sh);
+
+	return 0;
+}
+
+/**
+ * Multiply a 256-bit fraction by 10^19, removing the integer part.
+ *   @frac: The fraction.
+ *   &returns: The integer part, a chunk of 19 digits.
+ */
+
+static inline uint64_t ext_chunk(uint64_t *frac)
+{
+	int32_t i;
+	__uint128_t carry = 0;
+
+	for(i = 0; i < 4; i++) {
+		carry += (__uint128_t)frac[i] * 10000000000000000000ul;
+		frac[i] = (uint64_t)carry;
+		carry >>= 64;
+	}
+
+	return (uint64_t)carry;
+}
+
+/**
+ * Check if a 256-bit fraction lies within an error bound of zero or one.
+ *   @frac: The fraction.
+ *   @bits: The bit length of the error bound.
+ *   @one: True to check against one, false to check against zero.
+ *   &returns: True if near, false otherwise.
+ */
+
+static inline char ext_near(const uint64_t *frac, int32_t bits, char one)
+{
+	int32_t i;
+	uint64_t mask, diff = 0;
+
+	for(i = bits / 64; i < 4; i++) {
+		mask = (i == bits / 64) ? (~(uint64_t)0 << (bits % 64)) : ~(uint64_t)0;
+		diff |= (one ? ~frac[i] : frac[i]) & mask;
+	}
+
+	return diff == 0;
+}
+
+/**
+ * Check if the digits of a scaled value are uncertain at a position. The
+ * error may only carry into the position through a tail of zeros or nines
+ * ending with a fraction near zero or one. Checking the half, the tail
+ * starts with a five or a four instead.
+ *   @str: The digits.
+ *   @n: The position.
+ *   @len: The number of digits.
+ *   @frac: The fraction following the digits.
+ *   @bits: The bit length of the error bound.
+ *   @half: True to check against the half, false against an integer.
+ *   &returns: True if uncertain, false otherwise.
+ */
+
+static char ext_tail(const char *str, int32_t n, int32_t len, const uint64_t *frac, int32_t bits, char half)
+{
+	int32_t i;
+	char zero = 1, nine = 1;
+
+	if(n < len) {
+		zero = (str[n] == (half ? '5' : '0'));
+		nine = (str[n] == (half ? '4' : '9'));
+	}
+
+	for(i = n + 1; i < len; i++)
+		zero &= (str[i] == '0'), nine &= (str[i] == '9');
+
+	return (zero && ext_near(frac, bits, 0)) || (nine && ext_near(frac, bits, 1));
+}
+
+/**
+ * Write the digits of a 128-bit integer.
+ *   @val: The value, less than 10^38.
+ *   @n: The number of digits.
+ *   @buf: The output buffer.
+ */
+
+static void ext_write(__uint128_t val, int32_t n, char *buf)
+{
+	uint64_t chunk[3];
+
+	if(n <= 19)
+		u64_write((uint64_t)val, n, buf);
+	else {
+		u128_split(val, chunk);
+		u64_write(chunk[1], n - 19, buf);
+		u64_write(chunk[0], 19, buf + n - 19);
+	}
+
+	buf[n] = '\0';
+}
+
+/**
+ * Choose the candidate nearest the value, breaking ties to even.
+ *   @lo, hi: The range of candidates.
+ *   @v: The truncated value.
+ *   @up: True if the value rounds up.
+ *   &returns: The candidate.
+ */
+
+static inline __uint128_t ext_choose(__uint128_t lo, __uint128_t hi, __uint128_t v, char up)
+{
+	v += up;
+
+	return (v < lo) ? lo : ((v > hi) ? hi : v);
+}
+
+/**
+ * Perform the shortest conversion of an extended value with exact integer
+ * arithmetic.
+ *   @m: The mantissa.
+ *   @e: The binary exponent.
+ *   @asym: True if the lower gap is half the upper gap.
+ *   @k: The decimal exponent bounding the upper bound.
+ *   @buf: The output buffer.
+ *   &returns: The exponent.
+ */
+
+static int32_t ext_exact(__uint128_t m, int32_t e, char asym, int32_t k, char *buf)
+{
+	int32_t n = 0, i, cmp;
+	uint32_t dig[3];
+	char even = !(m & 0x1);
+	__uint128_t b[3], acc[3] = { 0, 0, 0 }, lo = 0, hi = 0;
+	struct big_t num[3], den;
+
+	/* each bound scaled by the power of ten is 'num / den' */
+
+	b[0] = 4 * m + 2;
+	b[1] = 4 * m - 1 - !asym;
+	b[2] = 4 * m;
+
+	for(i = 0; i < 3; i++) {
+		big_set(&num[i], (uint64_t)(b[i] >> 64));
+		big_shl(&num[i], 64);
+		big_add(&num[i], (uint64_t)b[i]);
+	}
+
+	big_set(&den, 1);
+	if(k > 0)
+		big_pow5(&den, k);
+
+	for(i = 0; i < 3; i++) {
+		if(k < 0)
+			big_pow5(&num[i], -k);
+
+		if(e - 2 > k)
+			big_shl(&num[i], e - 2 - k);
+	}
+
+	if(e - 2 < k)
+		big_shl(&den, k - e + 2);
+
+	while(1) {
+		for(i = 0; i < 3; i++) {
+			big_mul(&num[i], 10);
+			for(dig[i] = 0; big_cmp(&num[i], &den) >= 0; dig[i]++)
+				big_sub(&num[i], &den);
+		}
+
+		if((n == 0) && (dig[0] == 0)) {
+			k--;
+			continue;
+		}
+
+		for(i = 0; i < 3; i++)
+			acc[i] = 10 * acc[i] + dig[i];
+
+		n++;
+
+		/* a bound is a candidate when exact and the mantissa is even */
+
+		lo = acc[1] + 1 - ((num[1].len == 0) && even);
+		hi = acc[0] - ((num[0].len == 0) && !even);
+		if(lo <= hi)
+			break;
+	}
+
+	big_shl(&num[2], 1);
+	cmp = big_cmp(&num[2], &den);
+	ext_write(ext_choose(lo, hi, acc[2], (cmp > 0) || ((cmp == 0) && (acc[2] & 0x1))), n, buf);
+
+	return k;
+}
+
+/**
+ * Perform the shortest conversion of an extended value. The bounds and the
+ * value are scaled into 256-bit fractions, and their digits generated in
+ * chunks until the bounds differ, choosing the candidate nearest the value.
+ * A fraction within the error bound of a digit boundary, or of a tie, defers
+ * to exact integer arithmetic.
+ *   @m: The mantissa.
+ *   @e: The binary exponent.
+ *   @asym: True if the lower gap is half the upper gap.
+ *   @exact: True to use exact integer arithmetic throughout, for checking.
+ *   @buf: The output buffer.
+ *   &returns: The exponent.
+ */
+
+static int32_t errol_ext(__uint128_t m, int32_t e, char asym, char exact, char *buf)
+{
+	int32_t i, c, k, n, len, pe, bits = ERROL_EXT_ERR;
+	uint64_t mant[3], frac[3][4];
+	__uint128_t b[3];
+	char str[3][38], lo[38], over = 0, up;
+
+	b[0] = 4 * m + 2;
+	b[1] = 4 * m - 1 - !asym;
+	b[2] = 4 * m;
+
+	/* the upper bound lies below 2^len, and so below 10^k */
+
+	k = ((int64_t)((e - 2) + u128_bits(b[0])) * 330985980541 + ((int64_t)1 << 40) - 1) >> 40;
+
+	if(exact)
+		return ext_exact(m, e, asym, k, buf);
+
+	pe = ext_pow10(-k, mant);
+	for(i = 0; i < 3; i++)
+		over |= ext_scale(b[i], mant, pe + e - 2 + 256, frac[i]);
+
+	if(over)
+		return ext_exact(m, e, asym, k, buf);
+
+	/* generate chunks of digits until the bounds differ, the first digit possibly zero */
+
+	for(c = n = 0; c < 2; c++) {
+		bits += 64;
+		for(i = 0; i < 3; i++)
+			u64_write(ext_chunk(frac[i]), 19, str[i] + 19 * c);
+
+		while((n < 19 * (c + 1)) && (str[0][n] == str[1][n]))
+			n++;
+
+		if(n < 19 * (c + 1))
+			break;
+	}
+
+	if(c == 2)
+		return ext_exact(m, e, asym, k, buf);
+
+	/* the bounds must be certain through the first difference, and so not exact; the value only matters near a tie */
+
+	len = 19 * (c + 1);
+	n++;
+
+	if(ext_tail(str[0], n, len, frac[0], bits, 0) || ext_tail(str[1], n, len, frac[1], bits, 0))
+		return ext_exact(m, e, asym, k, buf);
+
+	if(n < len) {
+		if(ext_tail(str[2], n, len, frac[2], bits, 1))
+			return ext_exact(m, e, asym, k, buf);
+
+		up = (str[2][n] >= '5');
+	}
+	else {
+		frac[2][3] ^= (uint64_t)1 << 63;
+		if(ext_near(frac[2], bits, 0) || ext_near(frac[2], bits, 1))
+			return ext_exact(m, e, asym, k, buf);
+
+		up = !(frac[2][3] >> 63);
+	}
+
+	/* choose the nearest candidate, from one past the low prefix to the high prefix */
+
+	memcpy(buf, str[2], n);
+	if(up && errol_up(buf, n))
+		memcpy(buf, str[0], n);
+
+	memcpy(lo, str[1], n);
+	errol_up(lo, n);
+
+	if(memcmp(buf, lo, n) < 0)
+		memcpy(buf, lo, n);
+	else if(memcmp(buf, str[0], n) > 0)
+		memcpy(buf, str[0], n);
+
+	if(buf[0] == '0')
+		memmove(buf, buf + 1, --n), k--;
+
+	buf[n] = '\0';
+
+	return k;
+}
+
+/**
+ * Split an x87 extended double for the extended conversion.
+ *   @val: The value, positive and finite.
+ *   @exact: True to use exact integer arithmetic throughout.
+ *   @buf: The output buffer.
+ *   &returns: The exponent.
+ */
+
+static int32_t ext_long(long double val, char exact, char *buf)
+{
+	union { long double d; struct { uint64_t m; uint16_t e; } i; } bits = { .d = val };
+	int32_t e = bits.i.e & 0x7FFF;
+
+	return errol_ext(bits.i.m, (e != 0) ? (e - 16446) : -16445, (e > 1) && (bits.i.m == (uint64_t)1 << 63), exact, buf);
+}
+
+/**
+ * Perform the shortest conversion of an x87 extended double, choosing the
+ * nearest of the shortest candidates.
+ *   @val: The value, positive and finite.
+ *   @buf: The output buffer, of at least 22 bytes.
+ *   &returns: The exponent.
+ */
+
+_export
+int32_t errol_long(long double val, char *buf)
+{
+	return ext_long(val, 0, buf);
+}
+
+/**
+ * Perform 'errol_long' with exact integer arithmetic only, skipping the
+ * 256-bit path, to check that path against.
+ *   @val: The value, positive and finite.
+ *   @buf: The output buffer, of at least 22 bytes.
+ *   &returns: The exponent.
+ */
+
+_export
+int32_t errol_long_exact(long double val, char *buf)
+{
+	return ext_long(val, 1, buf);
+}
+
+#ifdef __SIZEOF_FLOAT128__
+
+/**
+ * Split an IEEE binary128 value for the extended conversion.
+ *   @val: The value, positive and finite.
+ *   @exact: True to use exact integer arithmetic throughout.
+ *   @buf: The output buffer.
+ *   &returns: The exponent.
+ */
+
+static int32_t ext_quad(__float128 val, char exact, char *buf)
+{
+	union { __float128 d; __uint128_t i; } bits = { .d = val };
+	int32_t e = (bits.i >> 112) & 0x7FFF;
+	__uint128_t m = bits.i & (((__uint128_t)1 << 112) - 1);
+
+	return errol_ext((e != 0) ? (m | ((__uint128_t)1 << 112)) : m, (e != 0) ? (e - 16495) : -16494, (e > 1) && (m == 0), exact, buf);
+}
+
+/**
+ * Perform the shortest conversion of an IEEE binary128 value, choosing the
+ * nearest of the shortest candidates.
+ *   @val: The value, positive and finite.
+ *   @buf: The output buffer, of at least 37 bytes.
+ *   &returns: The exponent.
+ */
+
+_export
+int32_t errol_quad(__float128 val, char *buf)
+{
+	return ext_quad(val, 0, buf);
+}
+
+/**
+ * Perform 'errol_quad' with exact integer arithmetic only, skipping the
+ * 256-bit path, to check that path against.
+ *   @val: The value, positive and finite.
+ *   @buf: The output buffer, of at least 37 bytes.
+ *   &returns: The exponent.
+ */
+
+_export
+int32_t errol_quad_exact(__float128 val, char *buf)
+{
+	return ext_quad(val, 1, buf);
+}
+
+#endif
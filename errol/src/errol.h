@@ -1,6 +1,9 @@
 #ifndef ERROL_H
 #define ERROL_H
 
+#include <stddef.h>
+#include <stdint.h>
+
 int32_t errol_str(double val, char *buf);
 int32_t errol_str2(double val, char *buf);
 
@@ -13,6 +16,26 @@ int32_t errol_alt(double val, char *buf, int8_t off);
 int32_t errol_fast(double val, char *buf);
 int32_t errol_short(double val, char *buf);
 
+int32_t errol_precision(double val, int32_t ndigits, char *buf);
+int32_t errol_fixed(double val, int32_t frac, char *buf);
+int32_t errol_roundtrip(double val, char *buf);
+
+double errol_strtod(const char *digits, int32_t len, int32_t exp);
+
+int32_t errol_long(long double val, char *buf);
+int32_t errol_long_exact(long double val, char *buf);
+#ifdef __SIZEOF_FLOAT128__
+int32_t errol_quad(__float128 val, char *buf);
+int32_t errol_quad_exact(__float128 val, char *buf);
+#endif
+
 int32_t errol_debug(double val, char *buf);
 
+/*
+ * errol lookup table identification
+ */
+
+uint64_t errol_table_hash(void);
+size_t errol_table_size(void);
+
 #endif
@@ -0,0 +1,147 @@
+#ifndef ERROL_HPP
+#define ERROL_HPP
+
+/*
+ * Header-only form of 'errol_short' for C++ callers. The conversion and its
+ * tables are visible to the compiler at every call site, so the prologue
+ * inlines, the table addresses are constant, and the checks for inputs the
+ * caller promises never to pass fold away. The digits match the C library
+ * built without 'ERROL_COMPACT'.
+ */
+
+#include <stdint.h>
+#include <string.h>
+#include <math.h>
+
+namespace errol {
+
+/**
+ * Input promises, combined as the template argument of 'shortest'.
+ *   @none: Any double.
+ *   @finite: The value is neither infinite nor NaN.
+ *   @positive: The value is greater than zero.
+ *   @integral: The value is a positive integer below 2^64.
+ */
+
+enum promise_e : unsigned {
+	none = 0,
+	finite = 1,
+	positive = 2,
+	integral = 4
+};
+
+namespace detail {
+
+/*
+ * double-double arithmetic, shared with 'errol.c'
+ */
+
+#include "hp.h"
+
+}
+
+}
+
+#include "lookup.hpp"
+
+namespace errol {
+
+namespace detail {
+
+/*
+ * exact integer paths, shared with 'errol.c'
+ */
+
+#include "wide.h"
+
+
+/**
+ * Find the power table row of a binary exponent, as 'errol_decade' in
+ * 'errol.c' built without 'ERROL_COMPACT'.
+ *   @val: The value.
+ *   @e: The binary exponent.
+ *   &returns: The unclamped row.
+ */
+
+inline int32_t errol_decade(double val, int32_t e)
+{
+	int32_t i = lookup<>::exp[e + lookup<>::exp_off];
+
+	return i + (val >= lookup<>::thr[i + lookup<>::thr_off]);
+}
+
+/**
+ * Retrieve a row of the power table, holding 10^(308-idx).
+ *   @idx: The row.
+ *   &returns: The power as a double-double.
+ */
+
+inline hp_t errol_row(int32_t idx)
+{
+	return lookup<>::table[idx];
+}
+
+/*
+ * scaling prologue and digit loop, shared with 'errol.c'
+ */
+
+#include "shortest.h"
+
+}
+
+
+/**
+ * Write the shortest digits that read back to a double, as 'errol_short',
+ * with a leading '-' for negative values. The value is the digits read as
+ * '0.<digits>' times 10^exp. Zero writes '0', and infinities and NaN write
+ * 'inf' and 'nan', all with a zero exponent. Each promise in 'P' removes the
+ * matching check; passing a value that breaks a promise is undefined.
+ *   @P: The promises, from 'promise_e'.
+ *   @val: The value.
+ *   @out: The output iterator, receiving at most 18 characters.
+ *   @exp: Out. The exponent.
+ *   &returns: The iterator past the last character written.
+ */
+
+template<unsigned P = none, class OutputIt>
+inline OutputIt shortest(double val, OutputIt out, int32_t &exp)
+{
+	char buf[40];
+	int32_t i, n;
+
+	if(!(P & (finite | integral)) && !isfinite(val)) {
+		if(isnan(val))
+			return exp = 0, *out++ = 'n', *out++ = 'a', *out++ = 'n', out;
+
+		if(!(P & positive) && (val < 0.0))
+			*out++ = '-';
+
+		return exp = 0, *out++ = 'i', *out++ = 'n', *out++ = 'f', out;
+	}
+
+	if(!(P & (positive | integral))) {
+		if(val == 0.0) {
+			if(signbit(val))
+				*out++ = '-';
+
+			return exp = 0, *out++ = '0', out;
+		}
+
+		if(val < 0.0)
+			*out++ = '-', val = -val;
+	}
+
+	if(P & integral)
+		n = detail::errol_int_conv(val, buf, &exp);
+	else
+		n = detail::errol_short_conv(val, buf, &exp);
+
+	for(i = 0; i < n; i++)
+		*out++ = buf[i];
+
+	return out;
+}
+
+}
+
+#endif
@@ -0,0 +1,251 @@
+#ifndef ERROL_HP_H
+#define ERROL_HP_H
+
+/*
+ * Double-double arithmetic of Errol, shared by the C library through 'fp.h'
+ * and by the header-only 'errol.hpp'. The includer provides <stdint.h> and
+ * <string.h>; 'errol.hpp' includes this file inside its detail namespace.
+ */
+
+/**
+ * Floating point structure.
+ *   @val, err: The value and error.
+ */
+
+struct hp_t {
+	double val, err;
+};
+
+
+/**
+ * Normalize the number by factoring in the error.
+ *   @fp: The float pair.
+ */
+
+static inline void fp_normalize(struct hp_t *fp)
+{
+	double val = fp->val;
+
+	fp->val += fp->err;
+	fp->err += val - fp->val;
+}
+
+/**
+ * Multiply the float pair by ten.
+ *   @fp: The float pair.
+ */
+
+static inline void fp_mul(struct hp_t *fp)
+{
+	double err, val = fp->val;
+
+	fp->val *= 10.0;
+	fp->err *= 10.0;
+
+	err = fp->val;
+	err -= val * 8.0;
+	err -= val * 2.0;
+
+	fp->err -= err;
+
+	fp_normalize(fp);
+}
+
+/**
+ * Multiply the float pair by 100.
+ *   @hp: The high-precision number.
+ */
+
+static inline void fp_mul100(struct hp_t *fp)
+{
+	double err, val = fp->val;
+
+	fp->val *= 100.0;
+	fp->err *= 100.0;
+
+	err = fp->val;
+	err -= val * 64.0;
+	err -= val * 32.0;
+	err -= val * 4.0;
+
+	fp->err -= err;
+
+	fp_normalize(fp);
+}
+
+/**
+ * Multiply the float pair by 10000.
+ *   @hp: The high-precision number.
+ */
+
+static inline struct hp_t hp_mul10000(struct hp_t in)
+{
+	struct hp_t out;
+
+	out.val = in.val * 10000.0;
+	out.err = in.err * 10000.0 - (out.val - (in.val * 8192.0) - (in.val * 1024.0) - (in.val * 512.0) - (in.val * 256.0) - (in.val * 16.0));
+	fp_normalize(&out);
+
+	return out;
+}
+
+/**
+ * Divide the float pair by ten.
+ *   @fp: The float pair.
+ */
+
+static inline void fp_div(struct hp_t *fp)
+{
+	double val = fp->val;
+
+	fp->val /= 10.0;
+	fp->err /= 10.0;
+
+	val -= fp->val * 8.0;
+	val -= fp->val * 2.0;
+
+	fp->err += val / 10.0;
+
+	fp_normalize(fp);
+}
+
+/**
+ * Retrieve the bits of a double.
+ *   @val: The value.
+ *   &returns: The bits.
+ */
+
+static inline uint64_t fp_bits(double val)
+{
+	uint64_t out;
+
+	memcpy(&out, &val, sizeof(out));
+
+	return out;
+}
+
+/**
+ * Create a double from its bits.
+ *   @bits: The bits.
+ *   &returns: The double.
+ */
+
+static inline double fp_from_bits(uint64_t bits)
+{
+	double out;
+
+	memcpy(&out, &bits, sizeof(out));
+
+	return out;
+}
+
+/**
+ * Split a double into an integer mantissa and binary exponent.
+ *   @val: The value.
+ *   @exp: Out. The exponent.
+ *   &returns: The mantissa.
+ */
+
+static inline uint64_t fp_mant(double val, int32_t *exp)
+{
+	uint64_t u = fp_bits(val);
+	int32_t e = (u >> 52) & 0x7FF;
+	uint64_t m = u & (((uint64_t)1 << 52) - 1);
+
+	if(e != 0)
+		m |= (uint64_t)1 << 52;
+	else
+		e = 1;
+
+	*exp = e - 1075;
+
+	return m;
+}
+
+/**
+ * Create a normal power of two.
+ *   @exp: The exponent.
+ *   &returns: The power of two.
+ */
+
+static inline double fp_pow2(int32_t exp)
+{
+	return fp_from_bits((uint64_t)(exp + 1023) << 52);
+}
+
+/**
+ * Multiply the float pair by a double. The rounding error of the leading
+ * product is found exactly from the 106-bit integer product of the
+ * mantissas.
+ *   @in: The float pair.
+ *   @val: The double.
+ *   &returns: The product.
+ */
+
+static inline struct hp_t fp_prod(struct hp_t in, double val)
+{
+	int32_t ea, eb, eo;
+	uint64_t ma, mb, mo;
+	int64_t diff;
+	struct hp_t out;
+
+	out.val = in.val * val;
+
+	ma = fp_mant(in.val, &ea);
+	mb = fp_mant(val, &eb);
+	mo = fp_mant(out.val, &eo);
+	diff = (int64_t)((__uint128_t)ma * mb - ((__uint128_t)mo << (eo - ea - eb)));
+
+	out.err = val * in.err + (double)diff * fp_pow2(ea + eb);
+	fp_normalize(&out);
+
+	return out;
+}
+
+/**
+ * Multiply two float pairs. The leading product is exact as in 'fp_prod',
+ * and the cross term of the second error is added to the error.
+ *   @a: The first float pair.
+ *   @b: The second float pair.
+ *   &returns: The product.
+ */
+
+static inline struct hp_t fp_prodhp(struct hp_t a, struct hp_t b)
+{
+	struct hp_t out;
+
+	out = fp_prod(a, b.val);
+	out.err += a.val * b.err;
+	fp_normalize(&out);
+
+	return out;
+}
+
+/**
+ * Multiply the float pair by a double of at most 24 significant bits. The
+ * value is split so that both partial products are exact, leaving only the
+ * rounding of the error term, whatever the magnitude of the product.
+ *   @in: The float pair.
+ *   @val: The double.
+ *   &returns: The product.
+ */
+
+static inline struct hp_t fp_prod24(struct hp_t in, double val)
+{
+	double hi, lo, phi, plo;
+	struct hp_t out;
+
+	hi = fp_from_bits(fp_bits(in.val) & ~(((uint64_t)1 << 24) - 1));
+	lo = in.val - hi;
+
+	phi = hi * val;
+	plo = lo * val;
+
+	out.val = phi + plo;
+	out.err = (plo - (out.val - phi)) + in.err * val;
+	fp_normalize(&out);
+
+	return out;
+}
+
+#endif
@@ -1,3 +1,13 @@
+/*
+ * Generated by 'bench/lookupgen'. Regenerate with 'lookupgen header' and
+ * verify with 'lookupgen check'; do not edit by hand.
+ */
+
+/**
+ * Power table, holding 10^(308-i) as the nearest double and the nearest
+ * double to the residual.
+ */
+
 #define LOOKUP_TABLE_LEN (sizeof(lookup_table) / (2 * sizeof(double)))
 struct hp_t lookup_table[] = {
 	{ 1.000000e+308,	-1.097906362944045488e+291 },
@@ -601,3 +611,1125 @@ struct hp_t lookup_table[] = {
 	{ 1.000000e-290,	-6.912786859962547924e-307 },
 	{ 1.000000e-291,	3.767567660872018813e-308 },
 };
+
+
+/**
+ * Binary exponent table, holding the lookup index of the lower decade for
+ * each binade. Index by the binary exponent, as from 'frexp', plus
+ * 'LOOKUP_EXP_OFF'.
+ */
+
+#define LOOKUP_EXP_OFF 1073
+int16_t lookup_exp[] = {
+	-15, -15, -14, -14, -14, -13, -13, -13, -12, -12, -12, -11, -11, -11, -11, -10,
+	-10, -10, -9, -9, -9, -8, -8, -8, -8, -7, -7, -7, -6, -6, -6, -5,
+	-5, -5, -5, -4, -4, -4, -3, -3, -3, -2, -2, -2, -2, -1, -1, -1,
+	0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 3, 3, 3, 4, 4, 4,
+	4, 5, 5, 5, 6, 6, 6, 7, 7, 7, 7, 8, 8, 8, 9, 9,
+	9, 10, 10, 10, 10, 11, 11, 11, 12, 12, 12, 13, 13, 13, 13, 14,
+	14, 14, 15, 15, 15, 16, 16, 16, 17, 17, 17, 17, 18, 18, 18, 19,
+	19, 19, 20, 20, 20, 20, 21, 21, 21, 22, 22, 22, 23, 23, 23, 23,
+	24, 24, 24, 25, 25, 25, 26, 26, 26, 26, 27, 27, 27, 28, 28, 28,
+	29, 29, 29, 29, 30, 30, 30, 31, 31, 31, 32, 32, 32, 32, 33, 33,
+	33, 34, 34, 34, 35, 35, 35, 35, 36, 36, 36, 37, 37, 37, 38, 38,
+	38, 38, 39, 39, 39, 40, 40, 40, 41, 41, 41, 41, 42, 42, 42, 43,
+	43, 43, 44, 44, 44, 44, 45, 45, 45, 46, 46, 46, 47, 47, 47, 48,
+	48, 48, 48, 49, 49, 49, 50, 50, 50, 51, 51, 51, 51, 52, 52, 52,
+	53, 53, 53, 54, 54, 54, 54, 55, 55, 55, 56, 56, 56, 57, 57, 57,
+	57, 58, 58, 58, 59, 59, 59, 60, 60, 60, 60, 61, 61, 61, 62, 62,
+	62, 63, 63, 63, 63, 64, 64, 64, 65, 65, 65, 66, 66, 66, 66, 67,
+	67, 67, 68, 68, 68, 69, 69, 69, 69, 70, 70, 70, 71, 71, 71, 72,
+	72, 72, 72, 73, 73, 73, 74, 74, 74, 75, 75, 75, 76, 76, 76, 76,
+	77, 77, 77, 78, 78, 78, 79, 79, 79, 79, 80, 80, 80, 81, 81, 81,
+	82, 82, 82, 82, 83, 83, 83, 84, 84, 84, 85, 85, 85, 85, 86, 86,
+	86, 87, 87, 87, 88, 88, 88, 88, 89, 89, 89, 90, 90, 90, 91, 91,
+	91, 91, 92, 92, 92, 93, 93, 93, 94, 94, 94, 94, 95, 95, 95, 96,
+	96, 96, 97, 97, 97, 97, 98, 98, 98, 99, 99, 99, 100, 100, 100, 100,
+	101, 101, 101, 102, 102, 102, 103, 103, 103, 103, 104, 104, 104, 105, 105, 105,
+	106, 106, 106, 107, 107, 107, 107, 108, 108, 108, 109, 109, 109, 110, 110, 110,
+	110, 111, 111, 111, 112, 112, 112, 113, 113, 113, 113, 114, 114, 114, 115, 115,
+	115, 116, 116, 116, 116, 117, 117, 117, 118, 118, 118, 119, 119, 119, 119, 120,
+	120, 120, 121, 121, 121, 122, 122, 122, 122, 123, 123, 123, 124, 124, 124, 125,
+	125, 125, 125, 126, 126, 126, 127, 127, 127, 128, 128, 128, 128, 129, 129, 129,
+	130, 130, 130, 131, 131, 131, 131, 132, 132, 132, 133, 133, 133, 134, 134, 134,
+	135, 135, 135, 135, 136, 136, 136, 137, 137, 137, 138, 138, 138, 138, 139, 139,
+	139, 140, 140, 140, 141, 141, 141, 141, 142, 142, 142, 143, 143, 143, 144, 144,
+	144, 144, 145, 145, 145, 146, 146, 146, 147, 147, 147, 147, 148, 148, 148, 149,
+	149, 149, 150, 150, 150, 150, 151, 151, 151, 152, 152, 152, 153, 153, 153, 153,
+	154, 154, 154, 155, 155, 155, 156, 156, 156, 156, 157, 157, 157, 158, 158, 158,
+	159, 159, 159, 159, 160, 160, 160, 161, 161, 161, 162, 162, 162, 163, 163, 163,
+	163, 164, 164, 164, 165, 165, 165, 166, 166, 166, 166, 167, 167, 167, 168, 168,
+	168, 169, 169, 169, 169, 170, 170, 170, 171, 171, 171, 172, 172, 172, 172, 173,
+	173, 173, 174, 174, 174, 175, 175, 175, 175, 176, 176, 176, 177, 177, 177, 178,
+	178, 178, 178, 179, 179, 179, 180, 180, 180, 181, 181, 181, 181, 182, 182, 182,
+	183, 183, 183, 184, 184, 184, 184, 185, 185, 185, 186, 186, 186, 187, 187, 187,
+	187, 188, 188, 188, 189, 189, 189, 190, 190, 190, 190, 191, 191, 191, 192, 192,
+	192, 193, 193, 193, 194, 194, 194, 194, 195, 195, 195, 196, 196, 196, 197, 197,
+	197, 197, 198, 198, 198, 199, 199, 199, 200, 200, 200, 200, 201, 201, 201, 202,
+	202, 202, 203, 203, 203, 203, 204, 204, 204, 205, 205, 205, 206, 206, 206, 206,
+	207, 207, 207, 208, 208, 208, 209, 209, 209, 209, 210, 210, 210, 211, 211, 211,
+	212, 212, 212, 212, 213, 213, 213, 214, 214, 214, 215, 215, 215, 215, 216, 216,
+	216, 217, 217, 217, 218, 218, 218, 218, 219, 219, 219, 220, 220, 220, 221, 221,
+	221, 222, 222, 222, 222, 223, 223, 223, 224, 224, 224, 225, 225, 225, 225, 226,
+	226, 226, 227, 227, 227, 228, 228, 228, 228, 229, 229, 229, 230, 230, 230, 231,
+	231, 231, 231, 232, 232, 232, 233, 233, 233, 234, 234, 234, 234, 235, 235, 235,
+	236, 236, 236, 237, 237, 237, 237, 238, 238, 238, 239, 239, 239, 240, 240, 240,
+	240, 241, 241, 241, 242, 242, 242, 243, 243, 243, 243, 244, 244, 244, 245, 245,
+	245, 246, 246, 246, 246, 247, 247, 247, 248, 248, 248, 249, 249, 249, 249, 250,
+	250, 250, 251, 251, 251, 252, 252, 252, 253, 253, 253, 253, 254, 254, 254, 255,
+	255, 255, 256, 256, 256, 256, 257, 257, 257, 258, 258, 258, 259, 259, 259, 259,
+	260, 260, 260, 261, 261, 261, 262, 262, 262, 262, 263, 263, 263, 264, 264, 264,
+	265, 265, 265, 265, 266, 266, 266, 267, 267, 267, 268, 268, 268, 268, 269, 269,
+	269, 270, 270, 270, 271, 271, 271, 271, 272, 272, 272, 273, 273, 273, 274, 274,
+	274, 274, 275, 275, 275, 276, 276, 276, 277, 277, 277, 277, 278, 278, 278, 279,
+	279, 279, 280, 280, 280, 281, 281, 281, 281, 282, 282, 282, 283, 283, 283, 284,
+	284, 284, 284, 285, 285, 285, 286, 286, 286, 287, 287, 287, 287, 288, 288, 288,
+	289, 289, 289, 290, 290, 290, 290, 291, 291, 291, 292, 292, 292, 293, 293, 293,
+	293, 294, 294, 294, 295, 295, 295, 296, 296, 296, 296, 297, 297, 297, 298, 298,
+	298, 299, 299, 299, 299, 300, 300, 300, 301, 301, 301, 302, 302, 302, 302, 303,
+	303, 303, 304, 304, 304, 305, 305, 305, 305, 306, 306, 306, 307, 307, 307, 308,
+	308, 308, 309, 309, 309, 309, 310, 310, 310, 311, 311, 311, 312, 312, 312, 312,
+	313, 313, 313, 314, 314, 314, 315, 315, 315, 315, 316, 316, 316, 317, 317, 317,
+	318, 318, 318, 318, 319, 319, 319, 320, 320, 320, 321, 321, 321, 321, 322, 322,
+	322, 323, 323, 323, 324, 324, 324, 324, 325, 325, 325, 326, 326, 326, 327, 327,
+	327, 327, 328, 328, 328, 329, 329, 329, 330, 330, 330, 330, 331, 331, 331, 332,
+	332, 332, 333, 333, 333, 333, 334, 334, 334, 335, 335, 335, 336, 336, 336, 336,
+	337, 337, 337, 338, 338, 338, 339, 339, 339, 340, 340, 340, 340, 341, 341, 341,
+	342, 342, 342, 343, 343, 343, 343, 344, 344, 344, 345, 345, 345, 346, 346, 346,
+	346, 347, 347, 347, 348, 348, 348, 349, 349, 349, 349, 350, 350, 350, 351, 351,
+	351, 352, 352, 352, 352, 353, 353, 353, 354, 354, 354, 355, 355, 355, 355, 356,
+	356, 356, 357, 357, 357, 358, 358, 358, 358, 359, 359, 359, 360, 360, 360, 361,
+	361, 361, 361, 362, 362, 362, 363, 363, 363, 364, 364, 364, 364, 365, 365, 365,
+	366, 366, 366, 367, 367, 367, 368, 368, 368, 368, 369, 369, 369, 370, 370, 370,
+	371, 371, 371, 371, 372, 372, 372, 373, 373, 373, 374, 374, 374, 374, 375, 375,
+	375, 376, 376, 376, 377, 377, 377, 377, 378, 378, 378, 379, 379, 379, 380, 380,
+	380, 380, 381, 381, 381, 382, 382, 382, 383, 383, 383, 383, 384, 384, 384, 385,
+	385, 385, 386, 386, 386, 386, 387, 387, 387, 388, 388, 388, 389, 389, 389, 389,
+	390, 390, 390, 391, 391, 391, 392, 392, 392, 392, 393, 393, 393, 394, 394, 394,
+	395, 395, 395, 395, 396, 396, 396, 397, 397, 397, 398, 398, 398, 399, 399, 399,
+	399, 400, 400, 400, 401, 401, 401, 402, 402, 402, 402, 403, 403, 403, 404, 404,
+	404, 405, 405, 405, 405, 406, 406, 406, 407, 407, 407, 408, 408, 408, 408, 409,
+	409, 409, 410, 410, 410, 411, 411, 411, 411, 412, 412, 412, 413, 413, 413, 414,
+	414, 414, 414, 415, 415, 415, 416, 416, 416, 417, 417, 417, 417, 418, 418, 418,
+	419, 419, 419, 420, 420, 420, 420, 421, 421, 421, 422, 422, 422, 423, 423, 423,
+	423, 424, 424, 424, 425, 425, 425, 426, 426, 426, 427, 427, 427, 427, 428, 428,
+	428, 429, 429, 429, 430, 430, 430, 430, 431, 431, 431, 432, 432, 432, 433, 433,
+	433, 433, 434, 434, 434, 435, 435, 435, 436, 436, 436, 436, 437, 437, 437, 438,
+	438, 438, 439, 439, 439, 439, 440, 440, 440, 441, 441, 441, 442, 442, 442, 442,
+	443, 443, 443, 444, 444, 444, 445, 445, 445, 445, 446, 446, 446, 447, 447, 447,
+	448, 448, 448, 448, 449, 449, 449, 450, 450, 450, 451, 451, 451, 451, 452, 452,
+	452, 453, 453, 453, 454, 454, 454, 454, 455, 455, 455, 456, 456, 456, 457, 457,
+	457, 458, 458, 458, 458, 459, 459, 459, 460, 460, 460, 461, 461, 461, 461, 462,
+	462, 462, 463, 463, 463, 464, 464, 464, 464, 465, 465, 465, 466, 466, 466, 467,
+	467, 467, 467, 468, 468, 468, 469, 469, 469, 470, 470, 470, 470, 471, 471, 471,
+	472, 472, 472, 473, 473, 473, 473, 474, 474, 474, 475, 475, 475, 476, 476, 476,
+	476, 477, 477, 477, 478, 478, 478, 479, 479, 479, 479, 480, 480, 480, 481, 481,
+	481, 482, 482, 482, 482, 483, 483, 483, 484, 484, 484, 485, 485, 485, 486, 486,
+	486, 486, 487, 487, 487, 488, 488, 488, 489, 489, 489, 489, 490, 490, 490, 491,
+	491, 491, 492, 492, 492, 492, 493, 493, 493, 494, 494, 494, 495, 495, 495, 495,
+	496, 496, 496, 497, 497, 497, 498, 498, 498, 498, 499, 499, 499, 500, 500, 500,
+	501, 501, 501, 501, 502, 502, 502, 503, 503, 503, 504, 504, 504, 504, 505, 505,
+	505, 506, 506, 506, 507, 507, 507, 507, 508, 508, 508, 509, 509, 509, 510, 510,
+	510, 510, 511, 511, 511, 512, 512, 512, 513, 513, 513, 514, 514, 514, 514, 515,
+	515, 515, 516, 516, 516, 517, 517, 517, 517, 518, 518, 518, 519, 519, 519, 520,
+	520, 520, 520, 521, 521, 521, 522, 522, 522, 523, 523, 523, 523, 524, 524, 524,
+	525, 525, 525, 526, 526, 526, 526, 527, 527, 527, 528, 528, 528, 529, 529, 529,
+	529, 530, 530, 530, 531, 531, 531, 532, 532, 532, 532, 533, 533, 533, 534, 534,
+	534, 535, 535, 535, 535, 536, 536, 536, 537, 537, 537, 538, 538, 538, 538, 539,
+	539, 539, 540, 540, 540, 541, 541, 541, 541, 542, 542, 542, 543, 543, 543, 544,
+	544, 544, 545, 545, 545, 545, 546, 546, 546, 547, 547, 547, 548, 548, 548, 548,
+	549, 549, 549, 550, 550, 550, 551, 551, 551, 551, 552, 552, 552, 553, 553, 553,
+	554, 554, 554, 554, 555, 555, 555, 556, 556, 556, 557, 557, 557, 557, 558, 558,
+	558, 559, 559, 559, 560, 560, 560, 560, 561, 561, 561, 562, 562, 562, 563, 563,
+	563, 563, 564, 564, 564, 565, 565, 565, 566, 566, 566, 566, 567, 567, 567, 568,
+	568, 568, 569, 569, 569, 569, 570, 570, 570, 571, 571, 571, 572, 572, 572, 573,
+	573, 573, 573, 574, 574, 574, 575, 575, 575, 576, 576, 576, 576, 577, 577, 577,
+	578, 578, 578, 579, 579, 579, 579, 580, 580, 580, 581, 581, 581, 582, 582, 582,
+	582, 583, 583, 583, 584, 584, 584, 585, 585, 585, 585, 586, 586, 586, 587, 587,
+	587, 588, 588, 588, 588, 589, 589, 589, 590, 590, 590, 591, 591, 591, 591, 592,
+	592, 592, 593, 593, 593, 594, 594, 594, 594, 595, 595, 595, 596, 596, 596, 597,
+	597, 597, 597, 598, 598, 598, 599, 599, 599, 600, 600, 600, 600, 601, 601, 601,
+	602, 602, 602, 603, 603, 603, 604, 604, 604, 604, 605, 605, 605, 606, 606, 606,
+	607, 607, 607, 607, 608, 608, 608, 609, 609, 609, 610, 610, 610, 610, 611, 611,
+	611, 612, 612, 612, 613, 613, 613, 613, 614, 614, 614, 615, 615, 615, 616, 616,
+	616, 616,
+};
+
+/**
+ * Decade threshold table, holding the smallest double not less than the
+ * power of ten ending each decade. Index by the lookup index plus
+ * 'LOOKUP_THR_OFF'.
+ */
+
+#define LOOKUP_THR_OFF 15
+double lookup_thr[] = {
+	1.5e-323,
+	1.04e-322,
+	1.003e-321,
+	1.0005e-320,
+	1.00004e-319,
+	1.000004e-318,
+	1e-317,
+	1.00000003e-316,
+	1.000000003e-315,
+	1.0000000005e-314,
+	1e-313,
+	1.000000000003e-312,
+	1.0000000000004e-311,
+	1.00000000000005e-310,
+	1e-309,
+	1.0000000000000004e-308,
+	1.0000000000000001e-307,
+	1e-306,
+	1.0000000000000001e-305,
+	1.0000000000000002e-304,
+	1.0000000000000001e-303,
+	1.0000000000000001e-302,
+	1e-301,
+	1e-300,
+	1.0000000000000001e-299,
+	1.0000000000000001e-298,
+	1e-297,
+	1e-296,
+	1e-295,
+	1e-294,
+	1e-293,
+	1e-292,
+	1.0000000000000001e-291,
+	1e-290,
+	1e-289,
+	1e-288,
+	1e-287,
+	1e-286,
+	1e-285,
+	1e-284,
+	1.0000000000000001e-283,
+	1e-282,
+	1e-281,
+	1.0000000000000001e-280,
+	1e-279,
+	1.0000000000000001e-278,
+	1.0000000000000001e-277,
+	1e-276,
+	1.0000000000000001e-275,
+	1.0000000000000001e-274,
+	1e-273,
+	1.0000000000000001e-272,
+	1.0000000000000001e-271,
+	1e-270,
+	1.0000000000000001e-269,
+	1.0000000000000001e-268,
+	1.0000000000000002e-267,
+	1.0000000000000002e-266,
+	1.0000000000000001e-265,
+	1e-264,
+	1e-263,
+	1e-262,
+	1.0000000000000001e-261,
+	1.0000000000000001e-260,
+	1e-259,
+	1.0000000000000001e-258,
+	1.0000000000000002e-257,
+	1.0000000000000001e-256,
+	1e-255,
+	1.0000000000000001e-254,
+	1e-253,
+	1.0000000000000001e-252,
+	1e-251,
+	1e-250,
+	1e-249,
+	1.0000000000000002e-248,
+	1e-247,
+	1.0000000000000001e-246,
+	1.0000000000000001e-245,
+	1.0000000000000001e-244,
+	1.0000000000000001e-243,
+	1.0000000000000002e-242,
+	1.0000000000000001e-241,
+	1.0000000000000001e-240,
+	1e-239,
+	1.0000000000000002e-238,
+	1.0000000000000001e-237,
+	1e-236,
+	1.0000000000000001e-235,
+	1.0000000000000001e-234,
+	1.0000000000000001e-233,
+	1e-232,
+	1.0000000000000001e-231,
+	1e-230,
+	1e-229,
+	1e-228,
+	1.0000000000000001e-227,
+	1.0000000000000001e-226,
+	1.0000000000000001e-225,
+	1e-224,
+	1.0000000000000002e-223,
+	1e-222,
+	1e-221,
+	1.0000000000000002e-220,
+	1e-219,
+	1e-218,
+	1e-217,
+	1e-216,
+	1e-215,
+	1.0000000000000001e-214,
+	1.0000000000000001e-213,
+	1.0000000000000001e-212,
+	1e-211,
+	1e-210,
+	1e-209,
+	1e-208,
+	1.0000000000000001e-207,
+	1e-206,
+	1e-205,
+	1e-204,
+	1e-203,
+	1e-202,
+	1.0000000000000001e-201,
+	1.0000000000000001e-200,
+	1.0000000000000001e-199,
+	1.0000000000000001e-198,
+	1.0000000000000001e-197,
+	1e-196,
+	1e-195,
+	1e-194,
+	1e-193,
+	1e-192,
+	1e-191,
+	1e-190,
+	1e-189,
+	1.0000000000000001e-188,
+	1e-187,
+	1.0000000000000001e-186,
+	1.0000000000000002e-185,
+	1e-184,
+	1e-183,
+	1e-182,
+	1e-181,
+	1e-180,
+	1e-179,
+	1.0000000000000001e-178,
+	1.0000000000000002e-177,
+	1.0000000000000002e-176,
+	1.0000000000000001e-175,
+	1.0000000000000001e-174,
+	1e-173,
+	1e-172,
+	1.0000000000000001e-171,
+	1.0000000000000002e-170,
+	1e-169,
+	1e-168,
+	1e-167,
+	1e-166,
+	1e-165,
+	1.0000000000000002e-164,
+	1.0000000000000001e-163,
+	1.0000000000000001e-162,
+	1e-161,
+	1.0000000000000001e-160,
+	1.0000000000000001e-159,
+	1e-158,
+	1.0000000000000001e-157,
+	1e-156,
+	1e-155,
+	1.0000000000000001e-154,
+	1e-153,
+	1e-152,
+	1.0000000000000001e-151,
+	1e-150,
+	1.0000000000000002e-149,
+	1.0000000000000001e-148,
+	1.0000000000000001e-147,
+	1e-146,
+	1.0000000000000001e-145,
+	1.0000000000000001e-144,
+	1.0000000000000001e-143,
+	1e-142,
+	1e-141,
+	1.0000000000000001e-140,
+	1e-139,
+	1e-138,
+	1.0000000000000001e-137,
+	1e-136,
+	1e-135,
+	1e-134,
+	1e-133,
+	1.0000000000000001e-132,
+	1.0000000000000001e-131,
+	1e-130,
+	1.0000000000000001e-129,
+	1e-128,
+	1e-127,
+	1.0000000000000001e-126,
+	1e-125,
+	1.0000000000000001e-124,
+	1e-123,
+	1e-122,
+	1.0000000000000002e-121,
+	1.0000000000000002e-120,
+	1e-119,
+	1.0000000000000002e-118,
+	1e-117,
+	1.0000000000000001e-116,
+	1e-115,
+	1e-114,
+	1.0000000000000001e-113,
+	1.0000000000000001e-112,
+	1e-111,
+	1e-110,
+	1.0000000000000001e-109,
+	1e-108,
+	1e-107,
+	1.0000000000000001e-106,
+	1.0000000000000002e-105,
+	1.0000000000000001e-104,
+	1.0000000000000001e-103,
+	1.0000000000000001e-102,
+	1e-101,
+	1e-100,
+	1e-99,
+	1.0000000000000001e-98,
+	1e-97,
+	1.0000000000000001e-96,
+	1.0000000000000002e-95,
+	1.0000000000000001e-94,
+	1.0000000000000001e-93,
+	1.0000000000000002e-92,
+	1e-91,
+	1.0000000000000002e-90,
+	1e-89,
+	1.0000000000000001e-88,
+	1e-87,
+	1e-86,
+	1.0000000000000001e-85,
+	1e-84,
+	1e-83,
+	1.0000000000000001e-82,
+	1.0000000000000001e-81,
+	1.0000000000000001e-80,
+	1.0000000000000001e-79,
+	1.0000000000000001e-78,
+	1.0000000000000001e-77,
+	1.0000000000000001e-76,
+	1.0000000000000001e-75,
+	1.0000000000000002e-74,
+	1.0000000000000002e-73,
+	1.0000000000000001e-72,
+	1.0000000000000001e-71,
+	1.0000000000000002e-70,
+	1.0000000000000001e-69,
+	1e-68,
+	1.0000000000000001e-67,
+	1.0000000000000001e-66,
+	1.0000000000000001e-65,
+	1.0000000000000001e-64,
+	1e-63,
+	1e-62,
+	1e-61,
+	1.0000000000000001e-60,
+	1e-59,
+	1e-58,
+	1.0000000000000001e-57,
+	1e-56,
+	1.0000000000000002e-55,
+	1e-54,
+	1e-53,
+	1e-52,
+	1e-51,
+	1e-50,
+	1.0000000000000001e-49,
+	1.0000000000000001e-48,
+	1.0000000000000001e-47,
+	1e-46,
+	1.0000000000000001e-45,
+	1.0000000000000001e-44,
+	1e-43,
+	1e-42,
+	1e-41,
+	1.0000000000000001e-40,
+	1.0000000000000001e-39,
+	1.0000000000000001e-38,
+	1e-37,
+	1.0000000000000001e-36,
+	1e-35,
+	1.0000000000000001e-34,
+	1e-33,
+	1e-32,
+	1e-31,
+	1e-30,
+	1.0000000000000001e-29,
+	1.0000000000000001e-28,
+	1e-27,
+	1e-26,
+	1e-25,
+	1.0000000000000001e-24,
+	1.0000000000000001e-23,
+	1e-22,
+	1.0000000000000001e-21,
+	1.0000000000000001e-20,
+	1.0000000000000001e-19,
+	1e-18,
+	1e-17,
+	1.0000000000000001e-16,
+	1e-15,
+	1.0000000000000002e-14,
+	1e-13,
+	1.0000000000000002e-12,
+	1.0000000000000001e-11,
+	1e-10,
+	1e-09,
+	1e-08,
+	1.0000000000000001e-07,
+	1.0000000000000002e-06,
+	1e-05,
+	0.0001,
+	0.001,
+	0.01,
+	0.1,
+	1.0,
+	10.0,
+	100.0,
+	1000.0,
+	10000.0,
+	100000.0,
+	1000000.0,
+	10000000.0,
+	100000000.0,
+	1000000000.0,
+	10000000000.0,
+	100000000000.0,
+	1000000000000.0,
+	10000000000000.0,
+	100000000000000.0,
+	1000000000000000.0,
+	1e+16,
+	1e+17,
+	1e+18,
+	1e+19,
+	1e+20,
+	1e+21,
+	1e+22,
+	1.0000000000000001e+23,
+	1.0000000000000001e+24,
+	1e+25,
+	1e+26,
+	1e+27,
+	1.0000000000000002e+28,
+	1.0000000000000001e+29,
+	1e+30,
+	1.0000000000000001e+31,
+	1e+32,
+	1.0000000000000001e+33,
+	1.0000000000000001e+34,
+	1.0000000000000002e+35,
+	1e+36,
+	1.0000000000000001e+37,
+	1.0000000000000002e+38,
+	1.0000000000000001e+39,
+	1e+40,
+	1e+41,
+	1e+42,
+	1e+43,
+	1e+44,
+	1.0000000000000001e+45,
+	1.0000000000000001e+46,
+	1e+47,
+	1e+48,
+	1.0000000000000001e+49,
+	1e+50,
+	1.0000000000000002e+51,
+	1.0000000000000001e+52,
+	1.0000000000000002e+53,
+	1e+54,
+	1e+55,
+	1e+56,
+	1e+57,
+	1.0000000000000001e+58,
+	1.0000000000000001e+59,
+	1.0000000000000001e+60,
+	1.0000000000000001e+61,
+	1e+62,
+	1e+63,
+	1e+64,
+	1.0000000000000001e+65,
+	1.0000000000000001e+66,
+	1.0000000000000001e+67,
+	1.0000000000000001e+68,
+	1e+69,
+	1e+70,
+	1e+71,
+	1.0000000000000001e+72,
+	1.0000000000000001e+73,
+	1.0000000000000001e+74,
+	1.0000000000000001e+75,
+	1e+76,
+	1.0000000000000001e+77,
+	1e+78,
+	1.0000000000000001e+79,
+	1e+80,
+	1.0000000000000001e+81,
+	1.0000000000000001e+82,
+	1e+83,
+	1e+84,
+	1e+85,
+	1e+86,
+	1.0000000000000002e+87,
+	1.0000000000000001e+88,
+	1.0000000000000001e+89,
+	1.0000000000000001e+90,
+	1e+91,
+	1e+92,
+	1e+93,
+	1e+94,
+	1e+95,
+	1e+96,
+	1e+97,
+	1.0000000000000001e+98,
+	1.0000000000000001e+99,
+	1e+100,
+	1.0000000000000001e+101,
+	1.0000000000000001e+102,
+	1e+103,
+	1e+104,
+	1.0000000000000001e+105,
+	1e+106,
+	1.0000000000000001e+107,
+	1e+108,
+	1.0000000000000002e+109,
+	1e+110,
+	1.0000000000000001e+111,
+	1.0000000000000001e+112,
+	1e+113,
+	1e+114,
+	1e+115,
+	1e+116,
+	1e+117,
+	1.0000000000000001e+118,
+	1.0000000000000001e+119,
+	1.0000000000000001e+120,
+	1e+121,
+	1e+122,
+	1.0000000000000001e+123,
+	1.0000000000000001e+124,
+	1.0000000000000001e+125,
+	1.0000000000000001e+126,
+	1.0000000000000001e+127,
+	1e+128,
+	1.0000000000000002e+129,
+	1e+130,
+	1.0000000000000001e+131,
+	1.0000000000000001e+132,
+	1e+133,
+	1.0000000000000001e+134,
+	1.0000000000000001e+135,
+	1e+136,
+	1e+137,
+	1e+138,
+	1e+139,
+	1e+140,
+	1e+141,
+	1e+142,
+	1e+143,
+	1e+144,
+	1.0000000000000001e+145,
+	1.0000000000000002e+146,
+	1.0000000000000002e+147,
+	1e+148,
+	1e+149,
+	1.0000000000000002e+150,
+	1e+151,
+	1e+152,
+	1.0000000000000002e+153,
+	1e+154,
+	1e+155,
+	1.0000000000000002e+156,
+	1.0000000000000001e+157,
+	1.0000000000000001e+158,
+	1.0000000000000001e+159,
+	1e+160,
+	1e+161,
+	1.0000000000000001e+162,
+	1.0000000000000001e+163,
+	1e+164,
+	1.0000000000000001e+165,
+	1.0000000000000001e+166,
+	1e+167,
+	1.0000000000000001e+168,
+	1.0000000000000001e+169,
+	1e+170,
+	1.0000000000000002e+171,
+	1e+172,
+	1e+173,
+	1e+174,
+	1.0000000000000001e+175,
+	1e+176,
+	1e+177,
+	1e+178,
+	1.0000000000000001e+179,
+	1e+180,
+	1.0000000000000001e+181,
+	1e+182,
+	1.0000000000000001e+183,
+	1e+184,
+	1.0000000000000001e+185,
+	1.0000000000000001e+186,
+	1.0000000000000001e+187,
+	1e+188,
+	1e+189,
+	1e+190,
+	1e+191,
+	1e+192,
+	1e+193,
+	1.0000000000000001e+194,
+	1.0000000000000001e+195,
+	1.0000000000000002e+196,
+	1.0000000000000001e+197,
+	1e+198,
+	1e+199,
+	1.0000000000000001e+200,
+	1e+201,
+	1.0000000000000001e+202,
+	1.0000000000000002e+203,
+	1.0000000000000001e+204,
+	1e+205,
+	1e+206,
+	1e+207,
+	1.0000000000000001e+208,
+	1e+209,
+	1.0000000000000001e+210,
+	1.0000000000000001e+211,
+	1.0000000000000001e+212,
+	1.0000000000000001e+213,
+	1.0000000000000001e+214,
+	1.0000000000000001e+215,
+	1e+216,
+	1.0000000000000001e+217,
+	1e+218,
+	1.0000000000000001e+219,
+	1.0000000000000001e+220,
+	1e+221,
+	1e+222,
+	1e+223,
+	1.0000000000000002e+224,
+	1.0000000000000001e+225,
+	1.0000000000000001e+226,
+	1e+227,
+	1.0000000000000001e+228,
+	1.0000000000000001e+229,
+	1e+230,
+	1e+231,
+	1e+232,
+	1.0000000000000002e+233,
+	1e+234,
+	1e+235,
+	1e+236,
+	1.0000000000000001e+237,
+	1e+238,
+	1.0000000000000001e+239,
+	1e+240,
+	1e+241,
+	1e+242,
+	1e+243,
+	1e+244,
+	1e+245,
+	1e+246,
+	1.0000000000000001e+247,
+	1e+248,
+	1.0000000000000001e+249,
+	1.0000000000000001e+250,
+	1e+251,
+	1e+252,
+	1.0000000000000001e+253,
+	1.0000000000000001e+254,
+	1.0000000000000002e+255,
+	1e+256,
+	1e+257,
+	1e+258,
+	1.0000000000000001e+259,
+	1e+260,
+	1.0000000000000001e+261,
+	1e+262,
+	1e+263,
+	1e+264,
+	1e+265,
+	1e+266,
+	1.0000000000000001e+267,
+	1.0000000000000002e+268,
+	1e+269,
+	1e+270,
+	1.0000000000000001e+271,
+	1e+272,
+	1.0000000000000001e+273,
+	1.0000000000000001e+274,
+	1.0000000000000001e+275,
+	1e+276,
+	1e+277,
+	1.0000000000000001e+278,
+	1e+279,
+	1e+280,
+	1e+281,
+	1e+282,
+	1.0000000000000002e+283,
+	1e+284,
+	1.0000000000000001e+285,
+	1e+286,
+	1e+287,
+	1e+288,
+	1e+289,
+	1e+290,
+	1.0000000000000001e+291,
+	1e+292,
+	1.0000000000000001e+293,
+	1e+294,
+	1.0000000000000001e+295,
+	1.0000000000000002e+296,
+	1e+297,
+	1.0000000000000001e+298,
+	1e+299,
+	1e+300,
+	1e+301,
+	1e+302,
+	1e+303,
+	1.0000000000000001e+304,
+	1.0000000000000001e+305,
+	1e+306,
+	1.0000000000000001e+307,
+	1e+308,
+};
+
+/**
+ * Extended power table, holding 10^(64i) as a 192-bit mantissa, most
+ * significant word first, rounded to nearest. Index by 'i' plus
+ * 'LOOKUP_EXT_OFF'.
+ */
+
+#define LOOKUP_EXT_OFF 78
+struct lookup_ext_t { uint64_t mant[3]; int32_t exp; };
+
+struct lookup_ext_t lookup_ext[] = {
+	{ { 0xf4b6acd4df2955b1ul, 0xf27331da557787ecul, 0x13cfc7011b53a255ul }, -16775 },
+	{ { 0xb9e5428330737362ul, 0xbddb2dfde3f8a6e3ul, 0x73a7380aba84a6b2ul }, -16562 },
+	{ { 0x8d36f6971766349cul, 0xac63454249b771c8ul, 0x2bfb20990dedb271ul }, -16349 },
+	{ { 0xd68bd3c92066a797ul, 0x326cb526b3747638ul, 0x6b6ff5a002416e72ul }, -16137 },
+	{ { 0xa2faa242a3bd093cul, 0xc62364c260a887e2ul, 0x4c2692ffb4103a61ul }, -15924 },
+	{ { 0xf79cd0bc0a9865e1ul, 0xa6246cc005e1b086ul, 0xa4fbd971b7335438ul }, -15712 },
+	{ { 0xbc1905f3e898cca2ul, 0x41a8bcd577f7a7d8ul, 0x4a0ad081b987938aul }, -15499 },
+	{ { 0x8ee3393b07698e29ul, 0x62648d93cdf05ba2ul, 0xc17503760879f1d7ul }, -15286 },
+	{ { 0xd9167ab0c1965798ul, 0xa8edffdccfe4db4bul, 0xf290163350ecb3ecul }, -15074 },
+	{ { 0xa4e8e60beec08b8ful, 0xd49596808f0f2914ul, 0x890f060f9004cedful }, -14861 },
+	{ { 0xfa8bbf517f29408aul, 0x31c0368ccb2c5757ul, 0x842dc41b89ca32c7ul }, -14649 },
+	{ { 0xbe53771cc8f1b8bbul, 0x6c682809ba47ff0eul, 0x57b5b173d643f3d4ul }, -14436 },
+	{ { 0x90948ea6c52e5802ul, 0xd6960685c12cd7c1ul, 0x9e48b99391902b01ul }, -14223 },
+	{ { 0xdba8d6d20f6b5894ul, 0xf0fc278b7f968212ul, 0x39c70812ffdfd469ul }, -14011 },
+	{ { 0xa6dd04c8d2ce9fdeul, 0x2de38123a1c3cffcul, 0x20305d0244e091baul }, -13798 },
+	{ { 0xfd83933eda772c0bul, 0x5052e9289f0f2333ul, 0x48324e275376dfdeul }, -13586 },
+	{ { 0xc094aa3eddb202e4ul, 0x1a096fc7358788c3ul, 0x30a0ea226e12164cul }, -13373 },
+	{ { 0x924b063d1ceb45b3ul, 0x1436a2dad831490dul, 0xbf3f2e0ffc99e3ccul }, -13160 },
+	{ { 0xde42ff8d37cad87ful, 0x1463ef488d5226cbul, 0xb171e37a76c65372ul }, -12948 },
+	{ { 0xa8d7103b2a9fddbful, 0x2409ac6534c33030ul, 0x7fc103fc5525486dul }, -12735 },
+	{ { 0x804233bf4b0b191cul, 0x752cd52fafaf4af1ul, 0xfa0c3128067e32aeul }, -12522 },
+	{ { 0xc2dcb3d89fb0f90eul, 0x75af8412a0d013fcul, 0x80d0a82031a01240ul }, -12310 },
+	{ { 0x9406af8f83fd6265ul, 0x4b4de34e0ebc3e06ul, 0x45efb05f20cf48b4ul }, -12097 },
+	{ { 0xe0e50c894cc21dfdul, 0x81884dd8cb5eb34aul, 0x294d82f85639fb9cul }, -11885 },
+	{ { 0xaad71a5aab16dc6cul, 0x5086fdecf2f641c6ul, 0x6ad4b3205eb000b0ul }, -11672 },
+	{ { 0x81c72bae7e65dad8ul, 0x5e580222f2f811aeul, 0x6546f97a4c6298ceul }, -11459 },
+	{ { 0xc52ba8a6aeb15d92ul, 0x9e98cb984f0d3050ul, 0xa42303e570b87e7ful }, -11247 },
+	{ { 0x95c79a5ea669fe86ul, 0x3615915d6df7666ful, 0xa0d0f971c37719e8ul }, -11034 },
+	{ { 0xe38f15b51b8440f7ul, 0x31ea85e808deba7ful, 0x3b735f721430e99eul }, -10822 },
+	{ { 0xacdd3555869159d1ul, 0xec41c1793d69d0d1ul, 0x1c5af3bd4d2c60b5ul }, -10609 },
+	{ { 0x8350bf3c91575a87ul, 0xe79e236bf8bf47a8ul, 0xe8a94db92ca58420ul }, -10396 },
+	{ { 0xc7819da48dde4790ul, 0x4e6570cd8536b61ful, 0x961cd07660c85d30ul }, -10184 },
+	{ { 0x978dd69af60dc360ul, 0xe1e20cfd1289138cul, 0xfdbcb2ba98abab85ul }, -9971 },
+	{ { 0xe641334805f3e36ful, 0xdb67cf7bbbac365aul, 0x8ee58fdc35fd6c67ul }, -9759 },
+	{ { 0xaee973911228abcaul, 0xe3187c34500d9ab3ul, 0xb7d1f78b317fae12ul }, -9546 },
+	{ { 0x84defc62f01c45b0ul, 0x67ac7c1d9ccd8266ul, 0xd121690c160997acul }, -9333 },
+	{ { 0xc9dea80d6283a34cul, 0x474b3cb1fe1d6a7ful, 0x9fb576046ab35018ul }, -9121 },
+	{ { 0x995974653b7e0231ul, 0x212da7006dc4e43bul, 0x5cbd0ea3f3b06e01ul }, -8908 },
+	{ { 0xe8fb7dc2dec0a404ul, 0x598eec7d41754c09ul, 0x5ad05b84c7c4be7dul }, -8696 },
+	{ { 0xb0fbe7aa6ce75997ul, 0xf73cbde9febc8fceul, 0x217b35d5cf1d588bul }, -8483 },
+	{ { 0x8671f14568278beaul, 0x138204ea625927f7ul, 0x860aab5af5540ccaul }, -8270 },
+	{ { 0xcc42dd5cb5091819ul, 0x1d8106ccf8ee85b4ul, 0x47ea18be2f96d249ul }, -8058 },
+	{ { 0x9b2a840f28a1638ful, 0xe393a9c032fb0c34ul, 0x660bdfd108ba798aul }, -7845 },
+	{ { 0xebbe0df0c8201ac5ul, 0x131565be33dda91aul, 0x0ccc12293f1d7a59ul }, -7633 },
+	{ { 0xb314a47728f9cd6cul, 0x9063016130392df7ul, 0xeed30cce7c442266ul }, -7420 },
+	{ { 0x8809ac32a8a8a8edul, 0xbae63e54a2044dddul, 0xbb3cdbb623256639ul }, -7207 },
+	{ { 0xceae534f34362de4ul, 0x492512d4f2ead2cbul, 0x8263ca5cbc774bd9ul }, -6995 },
+	{ { 0x9d01161bed052bb7ul, 0x699b5f371124cf4ful, 0xe67e4dcd407bd3eeul }, -6782 },
+	{ { 0xee88fce8152a48dful, 0xbfe3c33c58668242ul, 0x50a8dc181a6ae468ul }, -6570 },
+	{ { 0xb533bd05f6e01fedul, 0x11800af4bc788512ul, 0x2bf87d930ebf4397ul }, -6357 },
+	{ { 0x89a63ba4c497b50eul, 0x6c83ad1260ff20f4ul, 0xc098e6ed0bfbd6f7ul }, -6144 },
+	{ { 0xd1211fe37ac6a148ul, 0x0fc4eafedd191926ul, 0x70b449709c8d8002ul }, -5932 },
+	{ { 0x9edd3b40cbf457e6ul, 0x52ffa3f3adcdf125ul, 0x6276e8b3738d2f81ul }, -5719 },
+	{ { 0xf15c640b2de17b85ul, 0x75d9b3727e6e5a47ul, 0x8cf6873ef4426490ul }, -5507 },
+	{ { 0xb759449f52a711b2ul, 0x68e1eb75340122d4ul, 0x0fd924be26af7593ul }, -5294 },
+	{ { 0x8b47ae41b64bda30ul, 0x1754b16beba6aad6ul, 0xa6498798ba280923ul }, -5081 },
+	{ { 0xd39b595ad755ea09ul, 0x7b5b520aa67d2087ul, 0x4e241e61e269d4e8ul }, -4869 },
+	{ { 0xa0bf0465b455e921ul, 0x6e1f7f1642ebaac8ul, 0x2822e38faf74b26eul }, -4656 },
+	{ { 0xf4385d0975edbabeul, 0x1f4bf6653cd3b977ul, 0xddee7f83569c8b34ul }, -4444 },
+	{ { 0xb9854ec6332e5955ul, 0xa7890845b98cde15ul, 0x9360dcae892a2b6bul }, -4231 },
+	{ { 0x8cee12dbe4a0d94dul, 0x1668cd8fad294d80ul, 0xe4ceee3337dec383ul }, -4018 },
+	{ { 0xd61d163a16a90d2ful, 0xff2f89082e46b1aeul, 0x7a26b9c407754a72ul }, -3806 },
+	{ { 0xa2a682a5da57c0bdul, 0x87a601586bd3f698ul, 0xf53e94d1b2357c33ul }, -3593 },
+	{ { 0xf71d01e03613f568ul, 0x52e84de3b97f1642ul, 0x49c126b8ac219f56ul }, -3381 },
+	{ { 0xbbb7ef38bb827f2dul, 0x6d4aa5b50bb5dc0dul, 0x00de73d9d5be6974ul }, -3168 },
+	{ { 0x8e997872a9b05ac7ul, 0xe31578d4e269d267ul, 0xd4e7468e07450e43ul }, -2955 },
+	{ { 0xd8a66d4a505de96bul, 0x5ae1b25946117390ul, 0x4d0525af79e132c3ul }, -2743 },
+	{ { 0xa493c75052eb8374ul, 0xd521d9abbfeb2fedul, 0xf2d5c346258da621ul }, -2530 },
+	{ { 0xfa0a6cdb8871347cul, 0xd04ee5efc60d3e49ul, 0x112ee12926d4bbd3ul }, -2318 },
+	{ { 0xbdf139f0ee5092c6ul, 0x8904f03c4c1d014aul, 0xf834911ffc964b3eul }, -2105 },
+	{ { 0x9049ee32db23d21cul, 0x7132d332e3f204d4ul, 0xe7317d62209b6a94ul }, -1892 },
+	{ { 0xdb377599b6074244ul, 0x84c663cee6b86e7cul, 0x2726c48a85389fa7ul }, -1680 },
+	{ { 0xa686e3e8b11b0857ul, 0x88db9fffd5e6810eul, 0xa8562a3d2ff7c889ul }, -1467 },
+	{ { 0xfd00b897478238d0ul, 0x8920b098955522b4ul, 0xab9fac96b03d8444ul }, -1255 },
+	{ { 0xc0314325637a1939ul, 0xfa911155fefb5308ul, 0xa23e2ed27766e8cdul }, -1042 },
+	{ { 0x91ff83775423cc06ul, 0x7b6306a34627ddcful, 0x1c5a40917d0fa664ul }, -829 },
+	{ { 0xddd0467c64bce4a0ul, 0xac7cb3f6d05ddbdeul, 0xe26ca6063461fffaul }, -617 },
+	{ { 0xa87fea27a539e9a5ul, 0x3f2398d747b36224ul, 0x2a1fee40d90aab31ul }, -404 },
+	{ { 0x8000000000000000ul, 0x0000000000000000ul, 0x0000000000000000ul }, -191 },
+	{ { 0xc2781f49ffcfa6d5ul, 0x3cbf6b71c76b25fbul, 0x50f8080000000000ul }, 21 },
+	{ { 0x93ba47c980e98cdful, 0xc66f336c36b10137ul, 0x0234f3fd7b08dd39ul }, 234 },
+	{ { 0xe070f78d3927556aul, 0x85bbe253f47b1417ul, 0x0f118a2758e233b2ul }, 446 },
+	{ { 0xaa7eebfb9df9de8dul, 0xddbb901b98feeab7ul, 0x851e4cbf3de2f98bul }, 659 },
+	{ { 0x81842f29f2cce375ul, 0xe6a1158300d46640ul, 0x21ceb9ec7b8c62edul }, 872 },
+	{ { 0xc4c5e310aef8aa17ul, 0x1027fff56784f444ul, 0xe117befa6fab7d1aul }, 1084 },
+	{ { 0x957a4ae1ebf7f3d3ul, 0xa7ea9c8838ce9437ul, 0x3c11d8430d5c4803ul }, 1297 },
+	{ { 0xe319a0aea60e91c6ul, 0xcc655c54bc5058f8ul, 0x9c6583981d134cbaul }, 1509 },
+	{ { 0xac83fb896b6795fcul, 0xc6ebceff061b64c5ul, 0xb3e40992f8b347e2ul }, 1722 },
+	{ { 0x830cf791e54a9d1cul, 0x96e4ac8ae2f0a61dul, 0x2e9c7527d11d4e6cul }, 1935 },
+	{ { 0xc71aa36a1f8f01cbul, 0x9dad43f230e1226eul, 0x83689c3cbd362290ul }, 2147 },
+	{ { 0x973f9ca8cd00a68cul, 0x6c8d3fca02ca6de6ul, 0xb0d7ba426777344dul }, 2360 },
+	{ { 0xe5ca5a0b8d737f0eul, 0x23114665acc60d3bul, 0x52210ac35b45b385ul }, 2572 },
+	{ { 0xae8f2b2ce3d5dbe9ul, 0x870a8d87239d8f35ul, 0x412fe9e72afd355ful }, 2785 },
+	{ { 0x849a672a0d2ecfd1ul, 0xc832a5685e79350cul, 0xbbd356dd36f14528ul }, 2998 },
+	{ { 0xc976758681750c17ul, 0x650d3d28f18b50ceul, 0x526b988275249b10ul }, 3210 },
+	{ { 0x990a4d36997a9834ul, 0x1eac5b7d1142d87cul, 0x06a04e1f1626b5d3ul }, 3423 },
+	{ { 0xe8833c181c3bbfe0ul, 0xdc18d6ce622438a3ul, 0x0e2bc6f6e25d9e83ul }, 3635 },
+	{ { 0xb0a08d798abce436ul, 0x026b8897e82cde8dul, 0x5ecc5ab963d91b0bul }, 3848 },
+	{ { 0x862c8c0eeb856ecbul, 0x085bccd5c05ee9f9ul, 0xecff2e2c1eae9dbaul }, 4061 },
+	{ { 0xcbd96ed6466cf081ul, 0xbeb7fbdc1cbe8b37ul, 0x72435286baf0e84ful }, 4273 },
+	{ { 0x9ada6cd496ef0e05ul, 0x2f1a208fdedff747ul, 0x57e155f4ae05d036ul }, 4486 },
+	{ { 0xeb445f92a877bb09ul, 0xbc921b2c3eb25c7bul, 0xf0c01c012927f617ul }, 4698 },
+	{ { 0xb2b8353b3993a7e4ul, 0x4257ac3b4c1d7794ul, 0x7704bd1bb5a5802ful }, 4911 },
+	{ { 0x87c37487ccf4b0bful, 0x532430e7002aca8eul, 0x779afc75bb5d53bful }, 5124 },
+	{ { 0xce43a50ae4f7fb8eul, 0x7877892520ee1715ul, 0x5b1545b7a4a86071ul }, 5336 },
+	{ { 0x9cb00bfd6f025339ul, 0x2e61aa868501e740ul, 0x5c0648c4e9e45faaul }, 5549 },
+	{ { 0xee0ddd84924ab88cul, 0x2d4070f33b21ab7bul, 0xc20578fa3851488cul }, 5761 },
+	{ { 0xb4d63576caa95365ul, 0xf33ce3d6f17b62d1ul, 0xd92f8109437a02b2ul }, 5974 },
+	{ { 0x895f2f074b86004cul, 0xbc3bc2377649deeful, 0xdea7bf8e2153308eul }, 6187 },
+	{ { 0xd0b52e179d84f732ul, 0xfc8ea8820c829fe6ul, 0x351091ed9695d56aul }, 6399 },
+	{ { 0x9e8b3b5dc53d5de4ul, 0xa74d28ce329ace52ul, 0x6a3197bbebe3034ful }, 6612 },
+	{ { 0xf0dfcf43277d1129ul, 0x6e2cb3e7e6c76433ul, 0x95d9ca3d05c2de20ul }, 6824 },
+	{ { 0xb6faa16ac604d6f6ul, 0x180f7fcdf9f88b9dul, 0x006deaf7b163aa51ul }, 7037 },
+	{ { 0x8affca2bd1f88549ul, 0x1e34291b1ef566c7ul, 0x31be1482014cdaf0ul }, 7250 },
+	{ { 0xd32e203241f4806ful, 0x3f50c802040f4cccul, 0x03baa2f38e354650ul }, 7462 },
+	{ { 0xa06c0bd4ce9db63ful, 0xd51af6a3244a6983ul, 0x1f17dfae241cfad8ul }, 7675 },
+	{ { 0xf3ba4e7089c084e0ul, 0x17f49abd213c38b8ul, 0xe182161815aa3827ul }, 7887 },
+	{ { 0xb9258c901050bc53ul, 0x0c1beb6383dd861cul, 0xe906612b94cc94b7ul }, 8100 },
+	{ { 0x8ca554c020a1f0a6ul, 0x5dfed09922680a06ul, 0xaef839a8a7f6a14cul }, 8313 },
+	{ { 0xd5ae91d3ff7a6f8eul, 0x1e914685a756a7d6ul, 0x616a13318ff341b3ul }, 8525 },
+	{ { 0xa2528e74eaf101fcul, 0xf09e780bcc8238d9ul, 0x5e997e9f45d7897eul }, 8738 },
+	{ { 0xf69d74fc97aee56aul, 0x5e0a5c3957f5dbb8ul, 0x507a83727a7becf5ul }, 8950 },
+	{ { 0xbb570a9a9bd977ccul, 0x4c808753bb22fef8ul, 0x6fc5802cde0b3272ul }, 9163 },
+	{ { 0x8e4fddbbd3e242b6ul, 0xd1445b3f1cc9a09cul, 0x452107c368a41806ul }, 9376 },
+	{ { 0xd83699ba2ae37e0cul, 0xb1a05a0d64a2e6e8ul, 0x2839eebbd2636ad9ul }, 9588 },
+	{ { 0xa43ed4844001a59eul, 0xba5da243711d4f39ul, 0xac18f659182b0e64ul }, 9801 },
+	{ { 0xf9895d25d88b5a8aul, 0xfdd08c4da13655ecul, 0xf02c90b784b4227aul }, 10013 },
+	{ { 0xbd8f2f7a1ba47d6dul, 0x566765461bd2f61bul, 0xb494bcc96d53e49cul }, 10226 },
+	{ { 0x8fff7443ec2f51edul, 0x36ff0ad5e3a835b0ul, 0x357c0a5a746a6e68ul }, 10439 },
+	{ { 0xdac64ee70f466ae5ul, 0x032727c1ccef13baul, 0xbeb1ad9e2863c8c1ul }, 10651 },
+	{ { 0xa630ef7d5699fe45ul, 0x50e3660235410f98ul, 0xfca81f202c5d111aul }, 10864 },
+	{ { 0xfc7e217a6ace9f0ful, 0x7119aa2c0c5ee694ul, 0x192df5f08f7399f1ul }, 11076 },
+	{ { 0xbfce0f5ab8a6761dul, 0xda1276a2f5debc0bul, 0x9c65e36ac2d966acul }, 11289 },
+	{ { 0x91b427ab57bce6adul, 0xf739f1ca6f8ae61eul, 0xead238211605495cul }, 11502 },
+	{ { 0xdd5dc8a2bf27f3f7ul, 0x95aa118ec1d08317ul, 0x8909e424a112a3cdul }, 11714 },
+	{ { 0xa828f10fb963c71cul, 0xe012eb55f30d3c0aul, 0x5e943a525ef980dbul }, 11927 },
+	{ { 0xff7bdcd8f586aed0ul, 0xbb2215057a199356ul, 0xb96684a8f9a28e61ul }, 12139 },
+	{ { 0xc213bea5c91f03d8ul, 0x421ddc40535f78b3ul, 0xa524d2082aac030eul }, 12352 },
+	{ { 0x936e07737dc64f6dul, 0x8c474bb609f40287ul, 0xd2fea4fd957ea18eul }, 12565 },
+	{ { 0xdffd1e7be8191190ul, 0xafb619b59ab7cab9ul, 0xb9e4b3d49fb11548ul }, 12777 },
+	{ { 0xaa26eb2095a94e81ul, 0xe0280dbea779d3b9ul, 0x96347e0589f9c014ul }, 12990 },
+	{ { 0x81415538ce493bd5ul, 0xf22e502fcdd4bca2ul, 0x0151dcd7a53488c4ul }, 13203 },
+	{ { 0xc46052028a20979aul, 0xc94c153f804a4a92ul, 0x65761fb2444e2268ul }, 13415 },
+	{ { 0x952d234ccb7e5f2aul, 0x92506fd4d86244d3ul, 0xab328000b197f37cul }, 13628 },
+	{ { 0xe2a46848a8d6f78bul, 0x88111764983edba9ul, 0x4daa4a8effda676cul }, 13840 },
+	{ { 0xac2aefcb5dfe300aul, 0x0aebc0915f75c1f2ul, 0xcd09809d6b9bbaceul }, 14053 },
+	{ { 0x82c952e37be11cb4ul, 0x6e6c12aa02b9a1ecul, 0x538567bfbe0b117aul }, 14266 },
+	{ { 0xc6b3de56db4aef75ul, 0xc11b18bd25918c30ul, 0x2b9886e4fc08b273ul }, 14478 },
+	{ { 0x96f18b1742aad751ul, 0x888c9ab2fc5b3437ul, 0x186ef2c39acb4103ul }, 14691 },
+	{ { 0xe553be2769f4765eul, 0xd15e6695e9fb0b3eul, 0x970db52e1743533bul }, 14903 },
+	{ { 0xae3511626ed559f0ul, 0x7ef5f8c1b3a0771cul, 0x5a43d43795f92ea2ul }, 15116 },
+	{ { 0x8455f5578672ad69ul, 0x796ecf6adfc25225ul, 0x3b482d9dc36e244ful }, 15329 },
+	{ { 0xc90e78c7fcbee713ul, 0xf3be171a27bf81daul, 0xd75b37a5230067e7ul }, 15541 },
+	{ { 0x98bb4ee309f04d45ul, 0x5a050b215eebc516ul, 0xe1281d24c6f709e5ul }, 15754 },
+	{ { 0xe80b387fb9146d6cul, 0xa6a99ee15afede53ul, 0xe72af3faf80453ceul }, 15966 },
+	{ { 0xb045626fb50a35e7ul, 0x58f8fde02c03a6c6ul, 0xded179c26d9ab829ul }, 16179 },
+};
+
+/**
+ * Extended small power table, holding 10^i exactly as a 192-bit mantissa
+ * for 'i' below 64.
+ */
+
+struct lookup_ext_t lookup_ext_small[] = {
+	{ { 0x8000000000000000ul, 0x0000000000000000ul, 0x0000000000000000ul }, -191 },
+	{ { 0xa000000000000000ul, 0x0000000000000000ul, 0x0000000000000000ul }, -188 },
+	{ { 0xc800000000000000ul, 0x0000000000000000ul, 0x0000000000000000ul }, -185 },
+	{ { 0xfa00000000000000ul, 0x0000000000000000ul, 0x0000000000000000ul }, -182 },
+	{ { 0x9c40000000000000ul, 0x0000000000000000ul, 0x0000000000000000ul }, -178 },
+	{ { 0xc350000000000000ul, 0x0000000000000000ul, 0x0000000000000000ul }, -175 },
+	{ { 0xf424000000000000ul, 0x0000000000000000ul, 0x0000000000000000ul }, -172 },
+	{ { 0x9896800000000000ul, 0x0000000000000000ul, 0x0000000000000000ul }, -168 },
+	{ { 0xbebc200000000000ul, 0x0000000000000000ul, 0x0000000000000000ul }, -165 },
+	{ { 0xee6b280000000000ul, 0x0000000000000000ul, 0x0000000000000000ul }, -162 },
+	{ { 0x9502f90000000000ul, 0x0000000000000000ul, 0x0000000000000000ul }, -158 },
+	{ { 0xba43b74000000000ul, 0x0000000000000000ul, 0x0000000000000000ul }, -155 },
+	{ { 0xe8d4a51000000000ul, 0x0000000000000000ul, 0x0000000000000000ul }, -152 },
+	{ { 0x9184e72a00000000ul, 0x0000000000000000ul, 0x0000000000000000ul }, -148 },
+	{ { 0xb5e620f480000000ul, 0x0000000000000000ul, 0x0000000000000000ul }, -145 },
+	{ { 0xe35fa931a0000000ul, 0x0000000000000000ul, 0x0000000000000000ul }, -142 },
+	{ { 0x8e1bc9bf04000000ul, 0x0000000000000000ul, 0x0000000000000000ul }, -138 },
+	{ { 0xb1a2bc2ec5000000ul, 0x0000000000000000ul, 0x0000000000000000ul }, -135 },
+	{ { 0xde0b6b3a76400000ul, 0x0000000000000000ul, 0x0000000000000000ul }, -132 },
+	{ { 0x8ac7230489e80000ul, 0x0000000000000000ul, 0x0000000000000000ul }, -128 },
+	{ { 0xad78ebc5ac620000ul, 0x0000000000000000ul, 0x0000000000000000ul }, -125 },
+	{ { 0xd8d726b7177a8000ul, 0x0000000000000000ul, 0x0000000000000000ul }, -122 },
+	{ { 0x878678326eac9000ul, 0x0000000000000000ul, 0x0000000000000000ul }, -118 },
+	{ { 0xa968163f0a57b400ul, 0x0000000000000000ul, 0x0000000000000000ul }, -115 },
+	{ { 0xd3c21bcecceda100ul, 0x0000000000000000ul, 0x0000000000000000ul }, -112 },
+	{ { 0x84595161401484a0ul, 0x0000000000000000ul, 0x0000000000000000ul }, -108 },
+	{ { 0xa56fa5b99019a5c8ul, 0x0000000000000000ul, 0x0000000000000000ul }, -105 },
+	{ { 0xcecb8f27f4200f3aul, 0x0000000000000000ul, 0x0000000000000000ul }, -102 },
+	{ { 0x813f3978f8940984ul, 0x4000000000000000ul, 0x0000000000000000ul }, -98 },
+	{ { 0xa18f07d736b90be5ul, 0x5000000000000000ul, 0x0000000000000000ul }, -95 },
+	{ { 0xc9f2c9cd04674edeul, 0xa400000000000000ul, 0x0000000000000000ul }, -92 },
+	{ { 0xfc6f7c4045812296ul, 0x4d00000000000000ul, 0x0000000000000000ul }, -89 },
+	{ { 0x9dc5ada82b70b59dul, 0xf020000000000000ul, 0x0000000000000000ul }, -85 },
+	{ { 0xc5371912364ce305ul, 0x6c28000000000000ul, 0x0000000000000000ul }, -82 },
+	{ { 0xf684df56c3e01bc6ul, 0xc732000000000000ul, 0x0000000000000000ul }, -79 },
+	{ { 0x9a130b963a6c115cul, 0x3c7f400000000000ul, 0x0000000000000000ul }, -75 },
+	{ { 0xc097ce7bc90715b3ul, 0x4b9f100000000000ul, 0x0000000000000000ul }, -72 },
+	{ { 0xf0bdc21abb48db20ul, 0x1e86d40000000000ul, 0x0000000000000000ul }, -69 },
+	{ { 0x96769950b50d88f4ul, 0x1314448000000000ul, 0x0000000000000000ul }, -65 },
+	{ { 0xbc143fa4e250eb31ul, 0x17d955a000000000ul, 0x0000000000000000ul }, -62 },
+	{ { 0xeb194f8e1ae525fdul, 0x5dcfab0800000000ul, 0x0000000000000000ul }, -59 },
+	{ { 0x92efd1b8d0cf37beul, 0x5aa1cae500000000ul, 0x0000000000000000ul }, -55 },
+	{ { 0xb7abc627050305adul, 0xf14a3d9e40000000ul, 0x0000000000000000ul }, -52 },
+	{ { 0xe596b7b0c643c719ul, 0x6d9ccd05d0000000ul, 0x0000000000000000ul }, -49 },
+	{ { 0x8f7e32ce7bea5c6ful, 0xe4820023a2000000ul, 0x0000000000000000ul }, -45 },
+	{ { 0xb35dbf821ae4f38bul, 0xdda2802c8a800000ul, 0x0000000000000000ul }, -42 },
+	{ { 0xe0352f62a19e306eul, 0xd50b2037ad200000ul, 0x0000000000000000ul }, -39 },
+	{ { 0x8c213d9da502de45ul, 0x4526f422cc340000ul, 0x0000000000000000ul }, -35 },
+	{ { 0xaf298d050e4395d6ul, 0x9670b12b7f410000ul, 0x0000000000000000ul }, -32 },
+	{ { 0xdaf3f04651d47b4cul, 0x3c0cdd765f114000ul, 0x0000000000000000ul }, -29 },
+	{ { 0x88d8762bf324cd0ful, 0xa5880a69fb6ac800ul, 0x0000000000000000ul }, -25 },
+	{ { 0xab0e93b6efee0053ul, 0x8eea0d047a457a00ul, 0x0000000000000000ul }, -22 },
+	{ { 0xd5d238a4abe98068ul, 0x72a4904598d6d880ul, 0x0000000000000000ul }, -19 },
+	{ { 0x85a36366eb71f041ul, 0x47a6da2b7f864750ul, 0x0000000000000000ul }, -15 },
+	{ { 0xa70c3c40a64e6c51ul, 0x999090b65f67d924ul, 0x0000000000000000ul }, -12 },
+	{ { 0xd0cf4b50cfe20765ul, 0xfff4b4e3f741cf6dul, 0x0000000000000000ul }, -9 },
+	{ { 0x82818f1281ed449ful, 0xbff8f10e7a8921a4ul, 0x2000000000000000ul }, -5 },
+	{ { 0xa321f2d7226895c7ul, 0xaff72d52192b6a0dul, 0x2800000000000000ul }, -2 },
+	{ { 0xcbea6f8ceb02bb39ul, 0x9bf4f8a69f764490ul, 0x7200000000000000ul }, 1 },
+	{ { 0xfee50b7025c36a08ul, 0x02f236d04753d5b4ul, 0x8e80000000000000ul }, 4 },
+	{ { 0x9f4f2726179a2245ul, 0x01d762422c946590ul, 0xd910000000000000ul }, 8 },
+	{ { 0xc722f0ef9d80aad6ul, 0x424d3ad2b7b97ef5ul, 0x0f54000000000000ul }, 11 },
+	{ { 0xf8ebad2b84e0d58bul, 0xd2e0898765a7deb2ul, 0x5329000000000000ul }, 14 },
+	{ { 0x9b934c3b330c8577ul, 0x63cc55f49f88eb2ful, 0x73f9a00000000000ul }, 18 },
+};
+
+/**
+ * Compact power table, holding 10^(8i-LOOKUP_COMPACT_OFF) as in
+ * 'lookup_table'. Rows in between are rebuilt by one multiply with
+ * 'lookup_compact_small', holding 10^i exactly for 'i' below 8.
+ */
+
+#define LOOKUP_COMPACT_STEP 8
+#define LOOKUP_COMPACT_OFF 291
+struct hp_t lookup_compact[] = {
+	{ 1.000000e-291,	3.767567660872018813e-308 },
+	{ 1.000000e-283,	5.314789322934508480e-300 },
+	{ 1.000000e-275,	6.596538414625427829e-292 },
+	{ 1.000000e-267,	1.533140771175738074e-284 },
+	{ 1.000000e-259,	-6.975424321706684210e-276 },
+	{ 1.000000e-251,	-1.523328321757102663e-268 },
+	{ 1.000000e-243,	4.616527473176159842e-261 },
+	{ 1.000000e-235,	4.205533798926934697e-252 },
+	{ 1.000000e-227,	5.516332567862468419e-244 },
+	{ 1.000000e-219,	-3.170721214500529857e-236 },
+	{ 1.000000e-211,	-8.608661063232909897e-228 },
+	{ 1.000000e-203,	-3.649092839644947067e-220 },
+	{ 1.000000e-195,	-9.367799983496079132e-212 },
+	{ 1.000000e-187,	-1.287071881492476028e-204 },
+	{ 1.000000e-179,	-2.057206575616014662e-196 },
+	{ 1.000000e-171,	1.665450095113817487e-188 },
+	{ 1.000000e-163,	7.675893789924613703e-180 },
+	{ 1.000000e-155,	-1.431080634608215966e-172 },
+	{ 1.000000e-147,	2.952057864917838382e-164 },
+	{ 1.000000e-139,	-2.986513359186437306e-156 },
+	{ 1.000000e-131,	1.405673664054439890e-148 },
+	{ 1.000000e-123,	-5.922142664292846912e-140 },
+	{ 1.000000e-115,	-5.064490231692858166e-132 },
+	{ 1.000000e-107,	-1.585470431324073925e-125 },
+	{ 1.000000e-99,	-1.999189980260288281e-116 },
+	{ 1.000000e-91,	-2.218844988608365240e-108 },
+	{ 1.000000e-83,	-3.457651055545315679e-100 },
+	{ 1.000000e-75,	4.234998629903623412e-92 },
+	{ 1.000000e-67,	5.709643179581793251e-84 },
+	{ 1.000000e-59,	-2.570494266573869930e-76 },
+	{ 1.000000e-51,	-7.616223705782343324e-69 },
+	{ 1.000000e-43,	-7.745042713519821150e-60 },
+	{ 1.000000e-35,	-7.857545194582380514e-53 },
+	{ 1.000000e-27,	-3.849486974919184070e-44 },
+	{ 1.000000e-19,	2.475407316473986894e-36 },
+	{ 1.000000e-11,	6.050303071806019080e-28 },
+	{ 1.000000e-03,	-2.081668171172168557e-20 },
+	{ 1.000000e+05,	0.000000000000000000e+00 },
+	{ 1.000000e+13,	0.000000000000000000e+00 },
+	{ 1.000000e+21,	0.000000000000000000e+00 },
+	{ 1.000000e+29,	8.566849142784000000e+12 },
+	{ 1.000000e+37,	4.612373417978788577e+20 },
+	{ 1.000000e+45,	7.024271097546444878e+28 },
+	{ 1.000000e+53,	6.779051325638372659e+35 },
+	{ 1.000000e+61,	5.061286470292598274e+44 },
+	{ 1.000000e+69,	-7.253143638152923145e+52 },
+	{ 1.000000e+77,	1.721738727445414063e+60 },
+	{ 1.000000e+85,	-1.463069523067487314e+68 },
+	{ 1.000000e+93,	-4.337729697461918675e+76 },
+	{ 1.000000e+101,	2.295048673475466135e+84 },
+	{ 1.000000e+109,	1.814912928116001926e+92 },
+	{ 1.000000e+117,	-5.055542772599503556e+100 },
+	{ 1.000000e+125,	7.513223838100712113e+108 },
+	{ 1.000000e+133,	-2.235117235947686077e+116 },
+	{ 1.000000e+141,	-1.697621923823895943e+124 },
+	{ 1.000000e+149,	-4.897672657515052040e+132 },
+	{ 1.000000e+157,	1.664081977680827856e+140 },
+	{ 1.000000e+165,	1.005101065481665103e+149 },
+	{ 1.000000e+173,	-1.403918625579970616e+156 },
+	{ 1.000000e+181,	8.288920849235306587e+164 },
+	{ 1.000000e+189,	-2.309309130269787104e+172 },
+	{ 1.000000e+197,	4.885670753607648963e+180 },
+	{ 1.000000e+205,	-1.661603547285501360e+188 },
+	{ 1.000000e+213,	1.565496247320257804e+196 },
+	{ 1.000000e+221,	-4.660180717482069544e+204 },
+	{ 1.000000e+229,	8.161138937705571862e+211 },
+	{ 1.000000e+237,	5.979453868566904629e+220 },
+	{ 1.000000e+245,	-4.432795665958347728e+228 },
+	{ 1.000000e+253,	6.364129306223241129e+236 },
+	{ 1.000000e+261,	7.122615947963323868e+244 },
+	{ 1.000000e+269,	-4.675381888545612892e+252 },
+	{ 1.000000e+277,	-2.867878510995372374e+259 },
+	{ 1.000000e+285,	1.984084207947955778e+268 },
+	{ 1.000000e+293,	7.537651562646039934e+276 },
+	{ 1.000000e+301,	-5.250476025520442286e+284 },
+};
+
+double lookup_compact_small[] = {
+	1.000000e+00,
+	1.000000e+01,
+	1.000000e+02,
+	1.000000e+03,
+	1.000000e+04,
+	1.000000e+05,
+	1.000000e+06,
+	1.000000e+07,
+};
@@ -0,0 +1,1404 @@
+/*
+ * Generated by 'bench/lookupgen'. Regenerate with 'lookupgen hpp' and
+ * verify with 'lookupgen check'; do not edit by hand.
+ */
+
+namespace errol {
+
+namespace detail {
+
+/**
+ * Lookup tables, as 'lookup_table', 'lookup_exp' and 'lookup_thr' in
+ * 'lookup.h'. Static members of a class template are defined once across
+ * every translation unit including the header.
+ */
+
+template<class T = void> struct lookup {
+	static constexpr int32_t table_len = 600;
+	static constexpr int32_t exp_off = 1073;
+	static constexpr int32_t thr_off = 15;
+
+	static constexpr hp_t table[600] = {
+		{ 1.000000e+308,	-1.097906362944045488e+291 },
+		{ 1.000000e+307,	1.396894023974354241e+290 },
+		{ 1.000000e+306,	-1.721606459673645508e+289 },
+		{ 1.000000e+305,	6.074644749446353973e+288 },
+		{ 1.000000e+304,	6.074644749446353567e+287 },
+		{ 1.000000e+303,	-1.617650767864564452e+284 },
+		{ 1.000000e+302,	-7.629703079084895055e+285 },
+		{ 1.000000e+301,	-5.250476025520442286e+284 },
+		{ 1.000000e+300,	-5.250476025520441956e+283 },
+		{ 1.000000e+299,	-5.250476025520441750e+282 },
+		{ 1.000000e+298,	4.043379652465702264e+281 },
+		{ 1.000000e+297,	-1.765280146275637946e+280 },
+		{ 1.000000e+296,	1.865132227937699609e+279 },
+		{ 1.000000e+295,	1.865132227937699609e+278 },
+		{ 1.000000e+294,	-6.643646774124810287e+277 },
+		{ 1.000000e+293,	7.537651562646039934e+276 },
+		{ 1.000000e+292,	-1.325659897835741608e+275 },
+		{ 1.000000e+291,	4.213909764965371606e+274 },
+		{ 1.000000e+290,	-6.172783352786715670e+273 },
+		{ 1.000000e+289,	-6.172783352786715670e+272 },
+		{ 1.000000e+288,	-7.630473539575035471e+270 },
+		{ 1.000000e+287,	-7.525217352494018700e+270 },
+		{ 1.000000e+286,	-3.298861103408696612e+269 },
+		{ 1.000000e+285,	1.984084207947955778e+268 },
+		{ 1.000000e+284,	-7.921438250845767591e+267 },
+		{ 1.000000e+283,	4.460464822646386735e+266 },
+		{ 1.000000e+282,	-3.278224598286209647e+265 },
+		{ 1.000000e+281,	-3.278224598286209737e+264 },
+		{ 1.000000e+280,	-3.278224598286209961e+263 },
+		{ 1.000000e+279,	-5.797329227496039232e+262 },
+		{ 1.000000e+278,	3.649313132040821498e+261 },
+		{ 1.000000e+277,	-2.867878510995372374e+259 },
+		{ 1.000000e+276,	-5.206914080024985409e+259 },
+		{ 1.000000e+275,	4.018322599210230404e+258 },
+		{ 1.000000e+274,	7.862171215558236495e+257 },
+		{ 1.000000e+273,	5.459765830340732821e+256 },
+		{ 1.000000e+272,	-6.552261095746788047e+255 },
+		{ 1.000000e+271,	4.709014147460262298e+254 },
+		{ 1.000000e+270,	-4.675381888545612729e+253 },
+		{ 1.000000e+269,	-4.675381888545612892e+252 },
+		{ 1.000000e+268,	2.656177514583977380e+251 },
+		{ 1.000000e+267,	2.656177514583977190e+250 },
+		{ 1.000000e+266,	-3.071603269111014892e+249 },
+		{ 1.000000e+265,	-6.651466258920385440e+248 },
+		{ 1.000000e+264,	-4.414051890289528972e+247 },
+		{ 1.000000e+263,	-1.617283929500958387e+246 },
+		{ 1.000000e+262,	-1.617283929500958241e+245 },
+		{ 1.000000e+261,	7.122615947963323868e+244 },
+		{ 1.000000e+260,	-6.533477610574617382e+243 },
+		{ 1.000000e+259,	7.122615947963323982e+242 },
+		{ 1.000000e+258,	-5.679971763165996225e+241 },
+		{ 1.000000e+257,	-3.012765990014054219e+240 },
+		{ 1.000000e+256,	-3.012765990014054219e+239 },
+		{ 1.000000e+255,	1.154743030535854616e+238 },
+		{ 1.000000e+254,	6.364129306223240767e+237 },
+		{ 1.000000e+253,	6.364129306223241129e+236 },
+		{ 1.000000e+252,	-9.915202805299840595e+235 },
+		{ 1.000000e+251,	-4.827911520448877980e+234 },
+		{ 1.000000e+250,	7.890316691678530146e+233 },
+		{ 1.000000e+249,	7.890316691678529484e+232 },
+		{ 1.000000e+248,	-4.529828046727141859e+231 },
+		{ 1.000000e+247,	4.785280507077111924e+230 },
+		{ 1.000000e+246,	-6.858605185178205305e+229 },
+		{ 1.000000e+245,	-4.432795665958347728e+228 },
+		{ 1.000000e+244,	-7.465057564983169531e+227 },
+		{ 1.000000e+243,	-7.465057564983169741e+226 },
+		{ 1.000000e+242,	-5.096102956370027445e+225 },
+		{ 1.000000e+241,	-5.096102956370026952e+224 },
+		{ 1.000000e+240,	-1.394611380411992474e+223 },
+		{ 1.000000e+239,	9.188208545617793960e+221 },
+		{ 1.000000e+238,	-4.864759732872650359e+221 },
+		{ 1.000000e+237,	5.979453868566904629e+220 },
+		{ 1.000000e+236,	-5.316601966265964857e+219 },
+		{ 1.000000e+235,	-5.316601966265964701e+218 },
+		{ 1.000000e+234,	-1.786584517880693123e+217 },
+		{ 1.000000e+233,	2.625937292600896716e+216 },
+		{ 1.000000e+232,	-5.647541102052084079e+215 },
+		{ 1.000000e+231,	-5.647541102052083888e+214 },
+		{ 1.000000e+230,	-9.956644432600511943e+213 },
+		{ 1.000000e+229,	8.161138937705571862e+211 },
+		{ 1.000000e+228,	7.549087847752475275e+211 },
+		{ 1.000000e+227,	-9.283347037202319948e+210 },
+		{ 1.000000e+226,	3.866992716668613820e+209 },
+		{ 1.000000e+225,	7.154577655136347262e+208 },
+		{ 1.000000e+224,	3.045096482051680688e+207 },
+		{ 1.000000e+223,	-4.660180717482069567e+206 },
+		{ 1.000000e+222,	-4.660180717482070101e+205 },
+		{ 1.000000e+221,	-4.660180717482069544e+204 },
+		{ 1.000000e+220,	3.562757926310489022e+202 },
+		{ 1.000000e+219,	3.491561111451748149e+202 },
+		{ 1.000000e+218,	-8.265758834125874135e+201 },
+		{ 1.000000e+217,	3.981449442517482365e+200 },
+		{ 1.000000e+216,	-2.142154695804195936e+199 },
+		{ 1.000000e+215,	9.339603063548950188e+198 },
+		{ 1.000000e+214,	4.555537330485139746e+197 },
+		{ 1.000000e+213,	1.565496247320257804e+196 },
+		{ 1.000000e+212,	9.040598955232462036e+195 },
+		{ 1.000000e+211,	4.368659762787334780e+194 },
+		{ 1.000000e+210,	7.288621758065539072e+193 },
+		{ 1.000000e+209,	-7.311188218325485628e+192 },
+		{ 1.000000e+208,	1.813693016918905189e+191 },
+		{ 1.000000e+207,	-3.889357755108838992e+190 },
+		{ 1.000000e+206,	-3.889357755108838992e+189 },
+		{ 1.000000e+205,	-1.661603547285501360e+188 },
+		{ 1.000000e+204,	1.123089212493670643e+187 },
+		{ 1.000000e+203,	1.123089212493670643e+186 },
+		{ 1.000000e+202,	9.825254086803583029e+185 },
+		{ 1.000000e+201,	-3.771878529305654999e+184 },
+		{ 1.000000e+200,	3.026687778748963675e+183 },
+		{ 1.000000e+199,	-9.720624048853446693e+182 },
+		{ 1.000000e+198,	-1.753554156601940139e+181 },
+		{ 1.000000e+197,	4.885670753607648963e+180 },
+		{ 1.000000e+196,	4.885670753607648963e+179 },
+		{ 1.000000e+195,	2.292223523057028076e+178 },
+		{ 1.000000e+194,	5.534032561245303825e+177 },
+		{ 1.000000e+193,	-6.622751331960730683e+176 },
+		{ 1.000000e+192,	-4.090088020876139692e+175 },
+		{ 1.000000e+191,	-7.255917159731877552e+174 },
+		{ 1.000000e+190,	-7.255917159731877992e+173 },
+		{ 1.000000e+189,	-2.309309130269787104e+172 },
+		{ 1.000000e+188,	-2.309309130269787019e+171 },
+		{ 1.000000e+187,	9.284303438781988230e+170 },
+		{ 1.000000e+186,	2.038295583124628364e+169 },
+		{ 1.000000e+185,	2.038295583124628532e+168 },
+		{ 1.000000e+184,	-1.735666841696912925e+167 },
+		{ 1.000000e+183,	5.340512704843477241e+166 },
+		{ 1.000000e+182,	-6.453119872723839321e+165 },
+		{ 1.000000e+181,	8.288920849235306587e+164 },
+		{ 1.000000e+180,	-9.248546019891598293e+162 },
+		{ 1.000000e+179,	1.954450226518486016e+162 },
+		{ 1.000000e+178,	-5.243811844750628197e+161 },
+		{ 1.000000e+177,	-7.448980502074320639e+159 },
+		{ 1.000000e+176,	-7.448980502074319858e+158 },
+		{ 1.000000e+175,	6.284654753766312753e+158 },
+		{ 1.000000e+174,	-6.895756753684458388e+157 },
+		{ 1.000000e+173,	-1.403918625579970616e+156 },
+		{ 1.000000e+172,	-8.268716285710580522e+155 },
+		{ 1.000000e+171,	4.602779327034313170e+154 },
+		{ 1.000000e+170,	-3.441905430931244940e+153 },
+		{ 1.000000e+169,	6.613950516525702884e+152 },
+		{ 1.000000e+168,	6.613950516525702652e+151 },
+		{ 1.000000e+167,	-3.860899428741951187e+150 },
+		{ 1.000000e+166,	5.959272394946474605e+149 },
+		{ 1.000000e+165,	1.005101065481665103e+149 },
+		{ 1.000000e+164,	-1.783349948587918355e+146 },
+		{ 1.000000e+163,	6.215006036188360099e+146 },
+		{ 1.000000e+162,	6.215006036188360099e+145 },
+		{ 1.000000e+161,	-3.774589324822814903e+144 },
+		{ 1.000000e+160,	-6.528407745068226929e+142 },
+		{ 1.000000e+159,	7.151530601283157561e+142 },
+		{ 1.000000e+158,	4.712664546348788765e+141 },
+		{ 1.000000e+157,	1.664081977680827856e+140 },
+		{ 1.000000e+156,	1.664081977680827750e+139 },
+		{ 1.000000e+155,	-7.176231540910168265e+137 },
+		{ 1.000000e+154,	-3.694754568805822650e+137 },
+		{ 1.000000e+153,	2.665969958768462622e+134 },
+		{ 1.000000e+152,	-4.625108135904199522e+135 },
+		{ 1.000000e+151,	-1.717753238721771919e+134 },
+		{ 1.000000e+150,	1.916440382756262433e+133 },
+		{ 1.000000e+149,	-4.897672657515052040e+132 },
+		{ 1.000000e+148,	-4.897672657515052198e+131 },
+		{ 1.000000e+147,	2.200361759434233991e+130 },
+		{ 1.000000e+146,	6.636633270027537273e+129 },
+		{ 1.000000e+145,	1.091293881785907977e+128 },
+		{ 1.000000e+144,	-2.374543235865110597e+127 },
+		{ 1.000000e+143,	-2.374543235865110537e+126 },
+		{ 1.000000e+142,	-5.082228484029969099e+125 },
+		{ 1.000000e+141,	-1.697621923823895943e+124 },
+		{ 1.000000e+140,	-5.928380124081487212e+123 },
+		{ 1.000000e+139,	-3.284156248920492522e+122 },
+		{ 1.000000e+138,	-3.284156248920492706e+121 },
+		{ 1.000000e+137,	-3.284156248920492476e+120 },
+		{ 1.000000e+136,	-5.866406127007401066e+119 },
+		{ 1.000000e+135,	3.817030915818506056e+118 },
+		{ 1.000000e+134,	7.851796350329300951e+117 },
+		{ 1.000000e+133,	-2.235117235947686077e+116 },
+		{ 1.000000e+132,	9.170432597638723691e+114 },
+		{ 1.000000e+131,	8.797444499042767883e+114 },
+		{ 1.000000e+130,	-5.978307824605161274e+113 },
+		{ 1.000000e+129,	1.782556435814758516e+111 },
+		{ 1.000000e+128,	-7.517448691651820362e+111 },
+		{ 1.000000e+127,	4.507089332150205498e+110 },
+		{ 1.000000e+126,	7.513223838100711695e+109 },
+		{ 1.000000e+125,	7.513223838100712113e+108 },
+		{ 1.000000e+124,	5.164681255326878494e+107 },
+		{ 1.000000e+123,	2.229003026859587122e+106 },
+		{ 1.000000e+122,	-1.440594758724527399e+105 },
+		{ 1.000000e+121,	-3.734093374714598783e+104 },
+		{ 1.000000e+120,	1.999653165260579757e+103 },
+		{ 1.000000e+119,	5.583244752745066693e+102 },
+		{ 1.000000e+118,	3.343500010567262234e+101 },
+		{ 1.000000e+117,	-5.055542772599503556e+100 },
+		{ 1.000000e+116,	-1.555941612946684331e+99 },
+		{ 1.000000e+115,	-1.555941612946684331e+98 },
+		{ 1.000000e+114,	-1.555941612946684293e+97 },
+		{ 1.000000e+113,	-1.555941612946684246e+96 },
+		{ 1.000000e+112,	6.988006530736955847e+95 },
+		{ 1.000000e+111,	4.318022735835818244e+94 },
+		{ 1.000000e+110,	-2.356936751417025578e+93 },
+		{ 1.000000e+109,	1.814912928116001926e+92 },
+		{ 1.000000e+108,	-3.399899171300282744e+91 },
+		{ 1.000000e+107,	3.118615952970072913e+90 },
+		{ 1.000000e+106,	-9.103599905036843605e+89 },
+		{ 1.000000e+105,	6.174169917471802325e+88 },
+		{ 1.000000e+104,	-1.915675085734668657e+86 },
+		{ 1.000000e+103,	-1.915675085734668864e+85 },
+		{ 1.000000e+102,	2.295048673475466221e+85 },
+		{ 1.000000e+101,	2.295048673475466135e+84 },
+		{ 1.000000e+100,	-1.590289110975991792e+83 },
+		{ 1.000000e+99,	3.266383119588331155e+82 },
+		{ 1.000000e+98,	2.309629754856292029e+80 },
+		{ 1.000000e+97,	-7.357587384771124533e+80 },
+		{ 1.000000e+96,	-4.986165397190889509e+79 },
+		{ 1.000000e+95,	-2.021887912715594741e+78 },
+		{ 1.000000e+94,	-2.021887912715594638e+77 },
+		{ 1.000000e+93,	-4.337729697461918675e+76 },
+		{ 1.000000e+92,	-4.337729697461918997e+75 },
+		{ 1.000000e+91,	-7.956232486128049702e+74 },
+		{ 1.000000e+90,	3.351588728453609882e+73 },
+		{ 1.000000e+89,	5.246334248081951113e+71 },
+		{ 1.000000e+88,	4.058327554364963672e+71 },
+		{ 1.000000e+87,	4.058327554364963918e+70 },
+		{ 1.000000e+86,	-1.463069523067487266e+69 },
+		{ 1.000000e+85,	-1.463069523067487314e+68 },
+		{ 1.000000e+84,	-5.776660989811589441e+67 },
+		{ 1.000000e+83,	-3.080666323096525761e+66 },
+		{ 1.000000e+82,	3.659320343691134468e+65 },
+		{ 1.000000e+81,	7.871812010433421235e+64 },
+		{ 1.000000e+80,	-2.660986470836727449e+61 },
+		{ 1.000000e+79,	3.264399249934044627e+62 },
+		{ 1.000000e+78,	-8.493621433689703070e+60 },
+		{ 1.000000e+77,	1.721738727445414063e+60 },
+		{ 1.000000e+76,	-4.706013449590547218e+59 },
+		{ 1.000000e+75,	7.346021882351880518e+58 },
+		{ 1.000000e+74,	4.835181188197207515e+57 },
+		{ 1.000000e+73,	1.696630320503867482e+56 },
+		{ 1.000000e+72,	5.619818905120542959e+55 },
+		{ 1.000000e+71,	-4.188152556421145598e+54 },
+		{ 1.000000e+70,	-7.253143638152923145e+53 },
+		{ 1.000000e+69,	-7.253143638152923145e+52 },
+		{ 1.000000e+68,	4.719477774861832896e+51 },
+		{ 1.000000e+67,	1.726322421608144052e+50 },
+		{ 1.000000e+66,	5.467766613175255107e+49 },
+		{ 1.000000e+65,	7.909613737163661911e+47 },
+		{ 1.000000e+64,	-2.132041900945439564e+47 },
+		{ 1.000000e+63,	-5.785795994272697265e+46 },
+		{ 1.000000e+62,	-3.502199685943161329e+45 },
+		{ 1.000000e+61,	5.061286470292598274e+44 },
+		{ 1.000000e+60,	5.061286470292598472e+43 },
+		{ 1.000000e+59,	2.831211950439536034e+42 },
+		{ 1.000000e+58,	5.618805100255863927e+41 },
+		{ 1.000000e+57,	-4.834669211555366251e+40 },
+		{ 1.000000e+56,	-9.190283508143378583e+39 },
+		{ 1.000000e+55,	-1.023506702040855158e+38 },
+		{ 1.000000e+54,	-7.829154040459624616e+37 },
+		{ 1.000000e+53,	6.779051325638372659e+35 },
+		{ 1.000000e+52,	6.779051325638372290e+34 },
+		{ 1.000000e+51,	6.779051325638371598e+33 },
+		{ 1.000000e+50,	-7.629769841091887392e+33 },
+		{ 1.000000e+49,	5.350972305245182400e+32 },
+		{ 1.000000e+48,	-4.384584304507619764e+31 },
+		{ 1.000000e+47,	-4.384584304507619876e+30 },
+		{ 1.000000e+46,	6.860180964052978705e+28 },
+		{ 1.000000e+45,	7.024271097546444878e+28 },
+		{ 1.000000e+44,	-8.821361405306422641e+27 },
+		{ 1.000000e+43,	-1.393721169594140991e+26 },
+		{ 1.000000e+42,	-4.488571267807591679e+25 },
+		{ 1.000000e+41,	-6.200086450407783195e+23 },
+		{ 1.000000e+40,	-3.037860284270036669e+23 },
+		{ 1.000000e+39,	6.029083362839682141e+22 },
+		{ 1.000000e+38,	2.251190176543965970e+21 },
+		{ 1.000000e+37,	4.612373417978788577e+20 },
+		{ 1.000000e+36,	-4.242063737401796198e+19 },
+		{ 1.000000e+35,	3.136633892082024448e+18 },
+		{ 1.000000e+34,	5.442476901295718400e+17 },
+		{ 1.000000e+33,	5.442476901295718400e+16 },
+		{ 1.000000e+32,	-5.366162204393472000e+15 },
+		{ 1.000000e+31,	3.641037050347520000e+14 },
+		{ 1.000000e+30,	-1.988462483865600000e+13 },
+		{ 1.000000e+29,	8.566849142784000000e+12 },
+		{ 1.000000e+28,	4.168802631680000000e+11 },
+		{ 1.000000e+27,	-1.328755507200000000e+10 },
+		{ 1.000000e+26,	-4.764729344000000000e+09 },
+		{ 1.000000e+25,	-9.059696640000000000e+08 },
+		{ 1.000000e+24,	1.677721600000000000e+07 },
+		{ 1.000000e+23,	8.388608000000000000e+06 },
+		{ 1.000000e+22,	0.000000000000000000e+00 },
+		{ 1.000000e+21,	0.000000000000000000e+00 },
+		{ 1.000000e+20,	0.000000000000000000e+00 },
+		{ 1.000000e+19,	0.000000000000000000e+00 },
+		{ 1.000000e+18,	0.000000000000000000e+00 },
+		{ 1.000000e+17,	0.000000000000000000e+00 },
+		{ 1.000000e+16,	0.000000000000000000e+00 },
+		{ 1.000000e+15,	0.000000000000000000e+00 },
+		{ 1.000000e+14,	0.000000000000000000e+00 },
+		{ 1.000000e+13,	0.000000000000000000e+00 },
+		{ 1.000000e+12,	0.000000000000000000e+00 },
+		{ 1.000000e+11,	0.000000000000000000e+00 },
+		{ 1.000000e+10,	0.000000000000000000e+00 },
+		{ 1.000000e+09,	0.000000000000000000e+00 },
+		{ 1.000000e+08,	0.000000000000000000e+00 },
+		{ 1.000000e+07,	0.000000000000000000e+00 },
+		{ 1.000000e+06,	0.000000000000000000e+00 },
+		{ 1.000000e+05,	0.000000000000000000e+00 },
+		{ 1.000000e+04,	0.000000000000000000e+00 },
+		{ 1.000000e+03,	0.000000000000000000e+00 },
+		{ 1.000000e+02,	0.000000000000000000e+00 },
+		{ 1.000000e+01,	0.000000000000000000e+00 },
+		{ 1.000000e+00,	0.000000000000000000e+00 },
+		{ 1.000000e-01,	-5.551115123125783010e-18 },
+		{ 1.000000e-02,	-2.081668171172168436e-19 },
+		{ 1.000000e-03,	-2.081668171172168557e-20 },
+		{ 1.000000e-04,	-4.792173602385929943e-21 },
+		{ 1.000000e-05,	-8.180305391403130547e-22 },
+		{ 1.000000e-06,	4.525188817411374069e-23 },
+		{ 1.000000e-07,	4.525188817411373922e-24 },
+		{ 1.000000e-08,	-2.092256083012847109e-25 },
+		{ 1.000000e-09,	-6.228159145777985254e-26 },
+		{ 1.000000e-10,	-3.643219731549774344e-27 },
+		{ 1.000000e-11,	6.050303071806019080e-28 },
+		{ 1.000000e-12,	2.011335237074438524e-29 },
+		{ 1.000000e-13,	-3.037374556340037101e-30 },
+		{ 1.000000e-14,	1.180690645440101289e-32 },
+		{ 1.000000e-15,	-7.770539987666107583e-32 },
+		{ 1.000000e-16,	2.090221327596539779e-33 },
+		{ 1.000000e-17,	-7.154242405462192144e-34 },
+		{ 1.000000e-18,	-7.154242405462192572e-35 },
+		{ 1.000000e-19,	2.475407316473986894e-36 },
+		{ 1.000000e-20,	5.484672854579042914e-37 },
+		{ 1.000000e-21,	9.246254777210362522e-38 },
+		{ 1.000000e-22,	-4.859677432657087182e-39 },
+		{ 1.000000e-23,	3.956530198510069291e-40 },
+		{ 1.000000e-24,	7.629950044829717753e-41 },
+		{ 1.000000e-25,	-3.849486974919183692e-42 },
+		{ 1.000000e-26,	-3.849486974919184170e-43 },
+		{ 1.000000e-27,	-3.849486974919184070e-44 },
+		{ 1.000000e-28,	2.876745653839937870e-45 },
+		{ 1.000000e-29,	5.679342582489572168e-46 },
+		{ 1.000000e-30,	-8.333642060758598930e-47 },
+		{ 1.000000e-31,	-8.333642060758597958e-48 },
+		{ 1.000000e-32,	-5.596730997624190224e-49 },
+		{ 1.000000e-33,	-5.596730997624190604e-50 },
+		{ 1.000000e-34,	7.232539610818348498e-51 },
+		{ 1.000000e-35,	-7.857545194582380514e-53 },
+		{ 1.000000e-36,	5.896157255772251528e-53 },
+		{ 1.000000e-37,	-6.632427322784915796e-54 },
+		{ 1.000000e-38,	3.808059826012723592e-55 },
+		{ 1.000000e-39,	7.070712060011985131e-56 },
+		{ 1.000000e-40,	7.070712060011985584e-57 },
+		{ 1.000000e-41,	-5.761291134237854167e-59 },
+		{ 1.000000e-42,	-3.762312935688689794e-59 },
+		{ 1.000000e-43,	-7.745042713519821150e-60 },
+		{ 1.000000e-44,	4.700987842202462817e-61 },
+		{ 1.000000e-45,	1.589480203271891964e-62 },
+		{ 1.000000e-46,	-2.299904345391321765e-63 },
+		{ 1.000000e-47,	2.561826340437695261e-64 },
+		{ 1.000000e-48,	2.561826340437695345e-65 },
+		{ 1.000000e-49,	6.360053438741614633e-66 },
+		{ 1.000000e-50,	-7.616223705782342295e-68 },
+		{ 1.000000e-51,	-7.616223705782343324e-69 },
+		{ 1.000000e-52,	-7.616223705782342295e-70 },
+		{ 1.000000e-53,	-3.079876214757872338e-70 },
+		{ 1.000000e-54,	-3.079876214757872821e-71 },
+		{ 1.000000e-55,	5.423954167728123147e-73 },
+		{ 1.000000e-56,	-3.985444122640543680e-73 },
+		{ 1.000000e-57,	4.504255013759498850e-74 },
+		{ 1.000000e-58,	-2.570494266573869991e-75 },
+		{ 1.000000e-59,	-2.570494266573869930e-76 },
+		{ 1.000000e-60,	2.956653608686574324e-77 },
+		{ 1.000000e-61,	-3.952281235388981376e-78 },
+		{ 1.000000e-62,	-3.952281235388981376e-79 },
+		{ 1.000000e-63,	-6.651083908855995172e-80 },
+		{ 1.000000e-64,	3.469426116645307030e-81 },
+		{ 1.000000e-65,	7.686305293937516319e-82 },
+		{ 1.000000e-66,	2.415206322322254927e-83 },
+		{ 1.000000e-67,	5.709643179581793251e-84 },
+		{ 1.000000e-68,	-6.644495035141475923e-85 },
+		{ 1.000000e-69,	3.650620143794581913e-86 },
+		{ 1.000000e-70,	4.333966503770636492e-88 },
+		{ 1.000000e-71,	8.476455383920859113e-88 },
+		{ 1.000000e-72,	3.449543675455986564e-89 },
+		{ 1.000000e-73,	3.077238576654418974e-91 },
+		{ 1.000000e-74,	4.234998629903623140e-91 },
+		{ 1.000000e-75,	4.234998629903623412e-92 },
+		{ 1.000000e-76,	7.303182045714702338e-93 },
+		{ 1.000000e-77,	7.303182045714701699e-94 },
+		{ 1.000000e-78,	1.121271649074855759e-96 },
+		{ 1.000000e-79,	1.121271649074855863e-97 },
+		{ 1.000000e-80,	3.857468248661243988e-97 },
+		{ 1.000000e-81,	3.857468248661244248e-98 },
+		{ 1.000000e-82,	3.857468248661244410e-99 },
+		{ 1.000000e-83,	-3.457651055545315679e-100 },
+		{ 1.000000e-84,	-3.457651055545315933e-101 },
+		{ 1.000000e-85,	2.257285900866059216e-102 },
+		{ 1.000000e-86,	-8.458220892405268345e-103 },
+		{ 1.000000e-87,	-1.761029146610688867e-104 },
+		{ 1.000000e-88,	6.610460535632536565e-105 },
+		{ 1.000000e-89,	-3.853901567171494935e-106 },
+		{ 1.000000e-90,	5.062493089968513723e-108 },
+		{ 1.000000e-91,	-2.218844988608365240e-108 },
+		{ 1.000000e-92,	1.187522883398155383e-109 },
+		{ 1.000000e-93,	9.703442563414457296e-110 },
+		{ 1.000000e-94,	4.380992763404268896e-111 },
+		{ 1.000000e-95,	1.054461638397900823e-112 },
+		{ 1.000000e-96,	9.370789450913819736e-113 },
+		{ 1.000000e-97,	-3.623472756142303998e-114 },
+		{ 1.000000e-98,	6.122223899149788839e-115 },
+		{ 1.000000e-99,	-1.999189980260288281e-116 },
+		{ 1.000000e-100,	-1.999189980260288281e-117 },
+		{ 1.000000e-101,	-5.171617276904849634e-118 },
+		{ 1.000000e-102,	6.724985085512256320e-119 },
+		{ 1.000000e-103,	4.246526260008692213e-120 },
+		{ 1.000000e-104,	7.344599791888147003e-121 },
+		{ 1.000000e-105,	3.472007877038828407e-122 },
+		{ 1.000000e-106,	5.892377823819652194e-123 },
+		{ 1.000000e-107,	-1.585470431324073925e-125 },
+		{ 1.000000e-108,	-3.940375084977444795e-125 },
+		{ 1.000000e-109,	7.869099673288519908e-127 },
+		{ 1.000000e-110,	-5.122196348054018581e-127 },
+		{ 1.000000e-111,	-8.815387795168313713e-128 },
+		{ 1.000000e-112,	5.034080131510290214e-129 },
+		{ 1.000000e-113,	2.148774313452247863e-130 },
+		{ 1.000000e-114,	-5.064490231692858416e-131 },
+		{ 1.000000e-115,	-5.064490231692858166e-132 },
+		{ 1.000000e-116,	5.708726942017560559e-134 },
+		{ 1.000000e-117,	-2.951229134482377772e-134 },
+		{ 1.000000e-118,	1.451398151372789513e-135 },
+		{ 1.000000e-119,	-1.300243902286690040e-136 },
+		{ 1.000000e-120,	2.139308664787659449e-137 },
+		{ 1.000000e-121,	2.139308664787659329e-138 },
+		{ 1.000000e-122,	-5.922142664292847471e-139 },
+		{ 1.000000e-123,	-5.922142664292846912e-140 },
+		{ 1.000000e-124,	6.673875037395443799e-141 },
+		{ 1.000000e-125,	-1.198636026159737932e-142 },
+		{ 1.000000e-126,	5.361789860136246995e-143 },
+		{ 1.000000e-127,	-2.838742497733733936e-144 },
+		{ 1.000000e-128,	-5.401408859568103261e-145 },
+		{ 1.000000e-129,	7.411922949603743011e-146 },
+		{ 1.000000e-130,	-8.604741811861064385e-147 },
+		{ 1.000000e-131,	1.405673664054439890e-148 },
+		{ 1.000000e-132,	1.405673664054439933e-149 },
+		{ 1.000000e-133,	-6.414963426504548053e-150 },
+		{ 1.000000e-134,	-3.971014335704864578e-151 },
+		{ 1.000000e-135,	-3.971014335704864748e-152 },
+		{ 1.000000e-136,	-1.523438813303585576e-154 },
+		{ 1.000000e-137,	2.234325152653707766e-154 },
+		{ 1.000000e-138,	-6.715683724786540160e-155 },
+		{ 1.000000e-139,	-2.986513359186437306e-156 },
+		{ 1.000000e-140,	1.674949597813692102e-157 },
+		{ 1.000000e-141,	-4.151879098436469092e-158 },
+		{ 1.000000e-142,	-4.151879098436469295e-159 },
+		{ 1.000000e-143,	4.952540739454407825e-160 },
+		{ 1.000000e-144,	4.952540739454407667e-161 },
+		{ 1.000000e-145,	8.508954738630531443e-162 },
+		{ 1.000000e-146,	-2.604839008794855481e-163 },
+		{ 1.000000e-147,	2.952057864917838382e-164 },
+		{ 1.000000e-148,	6.425118410988271757e-165 },
+		{ 1.000000e-149,	2.083792728400229858e-166 },
+		{ 1.000000e-150,	-6.295358232172964237e-168 },
+		{ 1.000000e-151,	6.153785555826519421e-168 },
+		{ 1.000000e-152,	-6.564942029880634994e-169 },
+		{ 1.000000e-153,	-3.915207116191644540e-170 },
+		{ 1.000000e-154,	2.709130168030831503e-171 },
+		{ 1.000000e-155,	-1.431080634608215966e-172 },
+		{ 1.000000e-156,	-4.018712386257620994e-173 },
+		{ 1.000000e-157,	5.684906682427646782e-174 },
+		{ 1.000000e-158,	-6.444617153428937489e-175 },
+		{ 1.000000e-159,	1.136335243981427681e-176 },
+		{ 1.000000e-160,	1.136335243981427725e-177 },
+		{ 1.000000e-161,	-2.812077463003137395e-178 },
+		{ 1.000000e-162,	4.591196362592922204e-179 },
+		{ 1.000000e-163,	7.675893789924613703e-180 },
+		{ 1.000000e-164,	3.820022005759999543e-181 },
+		{ 1.000000e-165,	-9.998177244457686588e-183 },
+		{ 1.000000e-166,	-4.012217555824373639e-183 },
+		{ 1.000000e-167,	-2.467177666011174334e-185 },
+		{ 1.000000e-168,	-4.953592503130188139e-185 },
+		{ 1.000000e-169,	-2.011795792799518887e-186 },
+		{ 1.000000e-170,	1.665450095113817423e-187 },
+		{ 1.000000e-171,	1.665450095113817487e-188 },
+		{ 1.000000e-172,	-4.080246604750770577e-189 },
+		{ 1.000000e-173,	-4.080246604750770677e-190 },
+		{ 1.000000e-174,	4.085789420184387951e-192 },
+		{ 1.000000e-175,	4.085789420184388146e-193 },
+		{ 1.000000e-176,	4.085789420184388146e-194 },
+		{ 1.000000e-177,	4.792197640035244894e-194 },
+		{ 1.000000e-178,	4.792197640035244742e-195 },
+		{ 1.000000e-179,	-2.057206575616014662e-196 },
+		{ 1.000000e-180,	-2.057206575616014662e-197 },
+		{ 1.000000e-181,	-4.732755097354788053e-198 },
+		{ 1.000000e-182,	-4.732755097354787867e-199 },
+		{ 1.000000e-183,	-5.522105321379546765e-201 },
+		{ 1.000000e-184,	-5.777891238658996019e-201 },
+		{ 1.000000e-185,	7.542096444923057046e-203 },
+		{ 1.000000e-186,	8.919335748431433483e-203 },
+		{ 1.000000e-187,	-1.287071881492476028e-204 },
+		{ 1.000000e-188,	5.091932887209967018e-205 },
+		{ 1.000000e-189,	-6.868701054107114024e-206 },
+		{ 1.000000e-190,	-1.885103578558330118e-207 },
+		{ 1.000000e-191,	-1.885103578558330205e-208 },
+		{ 1.000000e-192,	-9.671974634103305058e-209 },
+		{ 1.000000e-193,	-4.805180224387695640e-210 },
+		{ 1.000000e-194,	-1.763433718315439838e-211 },
+		{ 1.000000e-195,	-9.367799983496079132e-212 },
+		{ 1.000000e-196,	-4.615071067758179837e-213 },
+		{ 1.000000e-197,	1.325840076914194777e-214 },
+		{ 1.000000e-198,	8.751979007754662425e-215 },
+		{ 1.000000e-199,	1.789973760091724198e-216 },
+		{ 1.000000e-200,	1.789973760091724077e-217 },
+		{ 1.000000e-201,	5.416018159916171171e-218 },
+		{ 1.000000e-202,	-3.649092839644947067e-219 },
+		{ 1.000000e-203,	-3.649092839644947067e-220 },
+		{ 1.000000e-204,	-1.080338554413850956e-222 },
+		{ 1.000000e-205,	-1.080338554413850841e-223 },
+		{ 1.000000e-206,	-2.874486186850417807e-223 },
+		{ 1.000000e-207,	7.499710055933455072e-224 },
+		{ 1.000000e-208,	-9.790617015372999087e-225 },
+		{ 1.000000e-209,	-4.387389805589732612e-226 },
+		{ 1.000000e-210,	-4.387389805589732612e-227 },
+		{ 1.000000e-211,	-8.608661063232909897e-228 },
+		{ 1.000000e-212,	4.582811616902018972e-229 },
+		{ 1.000000e-213,	4.582811616902019155e-230 },
+		{ 1.000000e-214,	8.705146829444184930e-231 },
+		{ 1.000000e-215,	-4.177150709750081830e-232 },
+		{ 1.000000e-216,	-4.177150709750082366e-233 },
+		{ 1.000000e-217,	-8.202868690748290237e-234 },
+		{ 1.000000e-218,	-3.170721214500530119e-235 },
+		{ 1.000000e-219,	-3.170721214500529857e-236 },
+		{ 1.000000e-220,	7.606440013180328441e-238 },
+		{ 1.000000e-221,	-1.696459258568569049e-238 },
+		{ 1.000000e-222,	-4.767838333426821244e-239 },
+		{ 1.000000e-223,	2.910609353718809138e-240 },
+		{ 1.000000e-224,	-1.888420450747209784e-241 },
+		{ 1.000000e-225,	4.110366804835314035e-242 },
+		{ 1.000000e-226,	7.859608839574391006e-243 },
+		{ 1.000000e-227,	5.516332567862468419e-244 },
+		{ 1.000000e-228,	-3.270953451057244613e-245 },
+		{ 1.000000e-229,	-6.932322625607124670e-246 },
+		{ 1.000000e-230,	-4.643966891513449762e-247 },
+		{ 1.000000e-231,	1.076922443720738305e-248 },
+		{ 1.000000e-232,	-2.498633390800628939e-249 },
+		{ 1.000000e-233,	4.205533798926934891e-250 },
+		{ 1.000000e-234,	4.205533798926934891e-251 },
+		{ 1.000000e-235,	4.205533798926934697e-252 },
+		{ 1.000000e-236,	-4.523850562697497656e-253 },
+		{ 1.000000e-237,	9.320146633177728298e-255 },
+		{ 1.000000e-238,	9.320146633177728062e-256 },
+		{ 1.000000e-239,	-7.592774752331086440e-256 },
+		{ 1.000000e-240,	3.063212017229987840e-257 },
+		{ 1.000000e-241,	3.063212017229987562e-258 },
+		{ 1.000000e-242,	3.063212017229987562e-259 },
+		{ 1.000000e-243,	4.616527473176159842e-261 },
+		{ 1.000000e-244,	6.965550922098544975e-261 },
+		{ 1.000000e-245,	6.965550922098544749e-262 },
+		{ 1.000000e-246,	4.424965697574744679e-263 },
+		{ 1.000000e-247,	-1.926497363734756420e-264 },
+		{ 1.000000e-248,	2.043167049583681740e-265 },
+		{ 1.000000e-249,	-5.399953725388390154e-266 },
+		{ 1.000000e-250,	-5.399953725388389982e-267 },
+		{ 1.000000e-251,	-1.523328321757102663e-268 },
+		{ 1.000000e-252,	5.745344310051561161e-269 },
+		{ 1.000000e-253,	-6.369110076296211879e-270 },
+		{ 1.000000e-254,	8.773957906638504842e-271 },
+		{ 1.000000e-255,	-6.904595826956931908e-273 },
+		{ 1.000000e-256,	2.267170882721243669e-273 },
+		{ 1.000000e-257,	2.267170882721243669e-274 },
+		{ 1.000000e-258,	4.577819683828225398e-275 },
+		{ 1.000000e-259,	-6.975424321706684210e-276 },
+		{ 1.000000e-260,	3.855741933482293648e-277 },
+		{ 1.000000e-261,	1.599248963651256552e-278 },
+		{ 1.000000e-262,	-1.221367248637539543e-279 },
+		{ 1.000000e-263,	-1.221367248637539494e-280 },
+		{ 1.000000e-264,	-1.221367248637539647e-281 },
+		{ 1.000000e-265,	1.533140771175737943e-282 },
+		{ 1.000000e-266,	1.533140771175737895e-283 },
+		{ 1.000000e-267,	1.533140771175738074e-284 },
+		{ 1.000000e-268,	4.223090009274641634e-285 },
+		{ 1.000000e-269,	4.223090009274641634e-286 },
+		{ 1.000000e-270,	-4.183001359784432924e-287 },
+		{ 1.000000e-271,	3.697709298708449474e-288 },
+		{ 1.000000e-272,	6.981338739747150474e-289 },
+		{ 1.000000e-273,	-9.436808465446354751e-290 },
+		{ 1.000000e-274,	3.389869038611071740e-291 },
+		{ 1.000000e-275,	6.596538414625427829e-292 },
+		{ 1.000000e-276,	-9.436808465446354618e-293 },
+		{ 1.000000e-277,	3.089243784609725523e-294 },
+		{ 1.000000e-278,	6.220756847123745836e-295 },
+		{ 1.000000e-279,	-5.522417137303829470e-296 },
+		{ 1.000000e-280,	4.263561183052483059e-297 },
+		{ 1.000000e-281,	-1.852675267170212272e-298 },
+		{ 1.000000e-282,	-1.852675267170212378e-299 },
+		{ 1.000000e-283,	5.314789322934508480e-300 },
+		{ 1.000000e-284,	-3.644541414696392675e-301 },
+		{ 1.000000e-285,	-7.377595888709267777e-302 },
+		{ 1.000000e-286,	-5.044436842451220838e-303 },
+		{ 1.000000e-287,	-2.127988034628661760e-304 },
+		{ 1.000000e-288,	-5.773549044406860911e-305 },
+		{ 1.000000e-289,	-1.216597782184112068e-306 },
+		{ 1.000000e-290,	-6.912786859962547924e-307 },
+		{ 1.000000e-291,	3.767567660872018813e-308 },
+	};
+
+	static constexpr int16_t exp[2098] = {
+		-15, -15, -14, -14, -14, -13, -13, -13, -12, -12, -12, -11, -11, -11, -11, -10,
+		-10, -10, -9, -9, -9, -8, -8, -8, -8, -7, -7, -7, -6, -6, -6, -5,
+		-5, -5, -5, -4, -4, -4, -3, -3, -3, -2, -2, -2, -2, -1, -1, -1,
+		0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 3, 3, 3, 4, 4, 4,
+		4, 5, 5, 5, 6, 6, 6, 7, 7, 7, 7, 8, 8, 8, 9, 9,
+		9, 10, 10, 10, 10, 11, 11, 11, 12, 12, 12, 13, 13, 13, 13, 14,
+		14, 14, 15, 15, 15, 16, 16, 16, 17, 17, 17, 17, 18, 18, 18, 19,
+		19, 19, 20, 20, 20, 20, 21, 21, 21, 22, 22, 22, 23, 23, 23, 23,
+		24, 24, 24, 25, 25, 25, 26, 26, 26, 26, 27, 27, 27, 28, 28, 28,
+		29, 29, 29, 29, 30, 30, 30, 31, 31, 31, 32, 32, 32, 32, 33, 33,
+		33, 34, 34, 34, 35, 35, 35, 35, 36, 36, 36, 37, 37, 37, 38, 38,
+		38, 38, 39, 39, 39, 40, 40, 40, 41, 41, 41, 41, 42, 42, 42, 43,
+		43, 43, 44, 44, 44, 44, 45, 45, 45, 46, 46, 46, 47, 47, 47, 48,
+		48, 48, 48, 49, 49, 49, 50, 50, 50, 51, 51, 51, 51, 52, 52, 52,
+		53, 53, 53, 54, 54, 54, 54, 55, 55, 55, 56, 56, 56, 57, 57, 57,
+		57, 58, 58, 58, 59, 59, 59, 60, 60, 60, 60, 61, 61, 61, 62, 62,
+		62, 63, 63, 63, 63, 64, 64, 64, 65, 65, 65, 66, 66, 66, 66, 67,
+		67, 67, 68, 68, 68, 69, 69, 69, 69, 70, 70, 70, 71, 71, 71, 72,
+		72, 72, 72, 73, 73, 73, 74, 74, 74, 75, 75, 75, 76, 76, 76, 76,
+		77, 77, 77, 78, 78, 78, 79, 79, 79, 79, 80, 80, 80, 81, 81, 81,
+		82, 82, 82, 82, 83, 83, 83, 84, 84, 84, 85, 85, 85, 85, 86, 86,
+		86, 87, 87, 87, 88, 88, 88, 88, 89, 89, 89, 90, 90, 90, 91, 91,
+		91, 91, 92, 92, 92, 93, 93, 93, 94, 94, 94, 94, 95, 95, 95, 96,
+		96, 96, 97, 97, 97, 97, 98, 98, 98, 99, 99, 99, 100, 100, 100, 100,
+		101, 101, 101, 102, 102, 102, 103, 103, 103, 103, 104, 104, 104, 105, 105, 105,
+		106, 106, 106, 107, 107, 107, 107, 108, 108, 108, 109, 109, 109, 110, 110, 110,
+		110, 111, 111, 111, 112, 112, 112, 113, 113, 113, 113, 114, 114, 114, 115, 115,
+		115, 116, 116, 116, 116, 117, 117, 117, 118, 118, 118, 119, 119, 119, 119, 120,
+		120, 120, 121, 121, 121, 122, 122, 122, 122, 123, 123, 123, 124, 124, 124, 125,
+		125, 125, 125, 126, 126, 126, 127, 127, 127, 128, 128, 128, 128, 129, 129, 129,
+		130, 130, 130, 131, 131, 131, 131, 132, 132, 132, 133, 133, 133, 134, 134, 134,
+		135, 135, 135, 135, 136, 136, 136, 137, 137, 137, 138, 138, 138, 138, 139, 139,
+		139, 140, 140, 140, 141, 141, 141, 141, 142, 142, 142, 143, 143, 143, 144, 144,
+		144, 144, 145, 145, 145, 146, 146, 146, 147, 147, 147, 147, 148, 148, 148, 149,
+		149, 149, 150, 150, 150, 150, 151, 151, 151, 152, 152, 152, 153, 153, 153, 153,
+		154, 154, 154, 155, 155, 155, 156, 156, 156, 156, 157, 157, 157, 158, 158, 158,
+		159, 159, 159, 159, 160, 160, 160, 161, 161, 161, 162, 162, 162, 163, 163, 163,
+		163, 164, 164, 164, 165, 165, 165, 166, 166, 166, 166, 167, 167, 167, 168, 168,
+		168, 169, 169, 169, 169, 170, 170, 170, 171, 171, 171, 172, 172, 172, 172, 173,
+		173, 173, 174, 174, 174, 175, 175, 175, 175, 176, 176, 176, 177, 177, 177, 178,
+		178, 178, 178, 179, 179, 179, 180, 180, 180, 181, 181, 181, 181, 182, 182, 182,
+		183, 183, 183, 184, 184, 184, 184, 185, 185, 185, 186, 186, 186, 187, 187, 187,
+		187, 188, 188, 188, 189, 189, 189, 190, 190, 190, 190, 191, 191, 191, 192, 192,
+		192, 193, 193, 193, 194, 194, 194, 194, 195, 195, 195, 196, 196, 196, 197, 197,
+		197, 197, 198, 198, 198, 199, 199, 199, 200, 200, 200, 200, 201, 201, 201, 202,
+		202, 202, 203, 203, 203, 203, 204, 204, 204, 205, 205, 205, 206, 206, 206, 206,
+		207, 207, 207, 208, 208, 208, 209, 209, 209, 209, 210, 210, 210, 211, 211, 211,
+		212, 212, 212, 212, 213, 213, 213, 214, 214, 214, 215, 215, 215, 215, 216, 216,
+		216, 217, 217, 217, 218, 218, 218, 218, 219, 219, 219, 220, 220, 220, 221, 221,
+		221, 222, 222, 222, 222, 223, 223, 223, 224, 224, 224, 225, 225, 225, 225, 226,
+		226, 226, 227, 227, 227, 228, 228, 228, 228, 229, 229, 229, 230, 230, 230, 231,
+		231, 231, 231, 232, 232, 232, 233, 233, 233, 234, 234, 234, 234, 235, 235, 235,
+		236, 236, 236, 237, 237, 237, 237, 238, 238, 238, 239, 239, 239, 240, 240, 240,
+		240, 241, 241, 241, 242, 242, 242, 243, 243, 243, 243, 244, 244, 244, 245, 245,
+		245, 246, 246, 246, 246, 247, 247, 247, 248, 248, 248, 249, 249, 249, 249, 250,
+		250, 250, 251, 251, 251, 252, 252, 252, 253, 253, 253, 253, 254, 254, 254, 255,
+		255, 255, 256, 256, 256, 256, 257, 257, 257, 258, 258, 258, 259, 259, 259, 259,
+		260, 260, 260, 261, 261, 261, 262, 262, 262, 262, 263, 263, 263, 264, 264, 264,
+		265, 265, 265, 265, 266, 266, 266, 267, 267, 267, 268, 268, 268, 268, 269, 269,
+		269, 270, 270, 270, 271, 271, 271, 271, 272, 272, 272, 273, 273, 273, 274, 274,
+		274, 274, 275, 275, 275, 276, 276, 276, 277, 277, 277, 277, 278, 278, 278, 279,
+		279, 279, 280, 280, 280, 281, 281, 281, 281, 282, 282, 282, 283, 283, 283, 284,
+		284, 284, 284, 285, 285, 285, 286, 286, 286, 287, 287, 287, 287, 288, 288, 288,
+		289, 289, 289, 290, 290, 290, 290, 291, 291, 291, 292, 292, 292, 293, 293, 293,
+		293, 294, 294, 294, 295, 295, 295, 296, 296, 296, 296, 297, 297, 297, 298, 298,
+		298, 299, 299, 299, 299, 300, 300, 300, 301, 301, 301, 302, 302, 302, 302, 303,
+		303, 303, 304, 304, 304, 305, 305, 305, 305, 306, 306, 306, 307, 307, 307, 308,
+		308, 308, 309, 309, 309, 309, 310, 310, 310, 311, 311, 311, 312, 312, 312, 312,
+		313, 313, 313, 314, 314, 314, 315, 315, 315, 315, 316, 316, 316, 317, 317, 317,
+		318, 318, 318, 318, 319, 319, 319, 320, 320, 320, 321, 321, 321, 321, 322, 322,
+		322, 323, 323, 323, 324, 324, 324, 324, 325, 325, 325, 326, 326, 326, 327, 327,
+		327, 327, 328, 328, 328, 329, 329, 329, 330, 330, 330, 330, 331, 331, 331, 332,
+		332, 332, 333, 333, 333, 333, 334, 334, 334, 335, 335, 335, 336, 336, 336, 336,
+		337, 337, 337, 338, 338, 338, 339, 339, 339, 340, 340, 340, 340, 341, 341, 341,
+		342, 342, 342, 343, 343, 343, 343, 344, 344, 344, 345, 345, 345, 346, 346, 346,
+		346, 347, 347, 347, 348, 348, 348, 349, 349, 349, 349, 350, 350, 350, 351, 351,
+		351, 352, 352, 352, 352, 353, 353, 353, 354, 354, 354, 355, 355, 355, 355, 356,
+		356, 356, 357, 357, 357, 358, 358, 358, 358, 359, 359, 359, 360, 360, 360, 361,
+		361, 361, 361, 362, 362, 362, 363, 363, 363, 364, 364, 364, 364, 365, 365, 365,
+		366, 366, 366, 367, 367, 367, 368, 368, 368, 368, 369, 369, 369, 370, 370, 370,
+		371, 371, 371, 371, 372, 372, 372, 373, 373, 373, 374, 374, 374, 374, 375, 375,
+		375, 376, 376, 376, 377, 377, 377, 377, 378, 378, 378, 379, 379, 379, 380, 380,
+		380, 380, 381, 381, 381, 382, 382, 382, 383, 383, 383, 383, 384, 384, 384, 385,
+		385, 385, 386, 386, 386, 386, 387, 387, 387, 388, 388, 388, 389, 389, 389, 389,
+		390, 390, 390, 391, 391, 391, 392, 392, 392, 392, 393, 393, 393, 394, 394, 394,
+		395, 395, 395, 395, 396, 396, 396, 397, 397, 397, 398, 398, 398, 399, 399, 399,
+		399, 400, 400, 400, 401, 401, 401, 402, 402, 402, 402, 403, 403, 403, 404, 404,
+		404, 405, 405, 405, 405, 406, 406, 406, 407, 407, 407, 408, 408, 408, 408, 409,
+		409, 409, 410, 410, 410, 411, 411, 411, 411, 412, 412, 412, 413, 413, 413, 414,
+		414, 414, 414, 415, 415, 415, 416, 416, 416, 417, 417, 417, 417, 418, 418, 418,
+		419, 419, 419, 420, 420, 420, 420, 421, 421, 421, 422, 422, 422, 423, 423, 423,
+		423, 424, 424, 424, 425, 425, 425, 426, 426, 426, 427, 427, 427, 427, 428, 428,
+		428, 429, 429, 429, 430, 430, 430, 430, 431, 431, 431, 432, 432, 432, 433, 433,
+		433, 433, 434, 434, 434, 435, 435, 435, 436, 436, 436, 436, 437, 437, 437, 438,
+		438, 438, 439, 439, 439, 439, 440, 440, 440, 441, 441, 441, 442, 442, 442, 442,
+		443, 443, 443, 444, 444, 444, 445, 445, 445, 445, 446, 446, 446, 447, 447, 447,
+		448, 448, 448, 448, 449, 449, 449, 450, 450, 450, 451, 451, 451, 451, 452, 452,
+		452, 453, 453, 453, 454, 454, 454, 454, 455, 455, 455, 456, 456, 456, 457, 457,
+		457, 458, 458, 458, 458, 459, 459, 459, 460, 460, 460, 461, 461, 461, 461, 462,
+		462, 462, 463, 463, 463, 464, 464, 464, 464, 465, 465, 465, 466, 466, 466, 467,
+		467, 467, 467, 468, 468, 468, 469, 469, 469, 470, 470, 470, 470, 471, 471, 471,
+		472, 472, 472, 473, 473, 473, 473, 474, 474, 474, 475, 475, 475, 476, 476, 476,
+		476, 477, 477, 477, 478, 478, 478, 479, 479, 479, 479, 480, 480, 480, 481, 481,
+		481, 482, 482, 482, 482, 483, 483, 483, 484, 484, 484, 485, 485, 485, 486, 486,
+		486, 486, 487, 487, 487, 488, 488, 488, 489, 489, 489, 489, 490, 490, 490, 491,
+		491, 491, 492, 492, 492, 492, 493, 493, 493, 494, 494, 494, 495, 495, 495, 495,
+		496, 496, 496, 497, 497, 497, 498, 498, 498, 498, 499, 499, 499, 500, 500, 500,
+		501, 501, 501, 501, 502, 502, 502, 503, 503, 503, 504, 504, 504, 504, 505, 505,
+		505, 506, 506, 506, 507, 507, 507, 507, 508, 508, 508, 509, 509, 509, 510, 510,
+		510, 510, 511, 511, 511, 512, 512, 512, 513, 513, 513, 514, 514, 514, 514, 515,
+		515, 515, 516, 516, 516, 517, 517, 517, 517, 518, 518, 518, 519, 519, 519, 520,
+		520, 520, 520, 521, 521, 521, 522, 522, 522, 523, 523, 523, 523, 524, 524, 524,
+		525, 525, 525, 526, 526, 526, 526, 527, 527, 527, 528, 528, 528, 529, 529, 529,
+		529, 530, 530, 530, 531, 531, 531, 532, 532, 532, 532, 533, 533, 533, 534, 534,
+		534, 535, 535, 535, 535, 536, 536, 536, 537, 537, 537, 538, 538, 538, 538, 539,
+		539, 539, 540, 540, 540, 541, 541, 541, 541, 542, 542, 542, 543, 543, 543, 544,
+		544, 544, 545, 545, 545, 545, 546, 546, 546, 547, 547, 547, 548, 548, 548, 548,
+		549, 549, 549, 550, 550, 550, 551, 551, 551, 551, 552, 552, 552, 553, 553, 553,
+		554, 554, 554, 554, 555, 555, 555, 556, 556, 556, 557, 557, 557, 557, 558, 558,
+		558, 559, 559, 559, 560, 560, 560, 560, 561, 561, 561, 562, 562, 562, 563, 563,
+		563, 563, 564, 564, 564, 565, 565, 565, 566, 566, 566, 566, 567, 567, 567, 568,
+		568, 568, 569, 569, 569, 569, 570, 570, 570, 571, 571, 571, 572, 572, 572, 573,
+		573, 573, 573, 574, 574, 574, 575, 575, 575, 576, 576, 576, 576, 577, 577, 577,
+		578, 578, 578, 579, 579, 579, 579, 580, 580, 580, 581, 581, 581, 582, 582, 582,
+		582, 583, 583, 583, 584, 584, 584, 585, 585, 585, 585, 586, 586, 586, 587, 587,
+		587, 588, 588, 588, 588, 589, 589, 589, 590, 590, 590, 591, 591, 591, 591, 592,
+		592, 592, 593, 593, 593, 594, 594, 594, 594, 595, 595, 595, 596, 596, 596, 597,
+		597, 597, 597, 598, 598, 598, 599, 599, 599, 600, 600, 600, 600, 601, 601, 601,
+		602, 602, 602, 603, 603, 603, 604, 604, 604, 604, 605, 605, 605, 606, 606, 606,
+		607, 607, 607, 607, 608, 608, 608, 609, 609, 609, 610, 610, 610, 610, 611, 611,
+		611, 612, 612, 612, 613, 613, 613, 613, 614, 614, 614, 615, 615, 615, 616, 616,
+		616, 616,
+	};
+
+	static constexpr double thr[632] = {
+		1.5e-323,
+		1.04e-322,
+		1.003e-321,
+		1.0005e-320,
+		1.00004e-319,
+		1.000004e-318,
+		1e-317,
+		1.00000003e-316,
+		1.000000003e-315,
+		1.0000000005e-314,
+		1e-313,
+		1.000000000003e-312,
+		1.0000000000004e-311,
+		1.00000000000005e-310,
+		1e-309,
+		1.0000000000000004e-308,
+		1.0000000000000001e-307,
+		1e-306,
+		1.0000000000000001e-305,
+		1.0000000000000002e-304,
+		1.0000000000000001e-303,
+		1.0000000000000001e-302,
+		1e-301,
+		1e-300,
+		1.0000000000000001e-299,
+		1.0000000000000001e-298,
+		1e-297,
+		1e-296,
+		1e-295,
+		1e-294,
+		1e-293,
+		1e-292,
+		1.0000000000000001e-291,
+		1e-290,
+		1e-289,
+		1e-288,
+		1e-287,
+		1e-286,
+		1e-285,
+		1e-284,
+		1.0000000000000001e-283,
+		1e-282,
+		1e-281,
+		1.0000000000000001e-280,
+		1e-279,
+		1.0000000000000001e-278,
+		1.0000000000000001e-277,
+		1e-276,
+		1.0000000000000001e-275,
+		1.0000000000000001e-274,
+		1e-273,
+		1.0000000000000001e-272,
+		1.0000000000000001e-271,
+		1e-270,
+		1.0000000000000001e-269,
+		1.0000000000000001e-268,
+		1.0000000000000002e-267,
+		1.0000000000000002e-266,
+		1.0000000000000001e-265,
+		1e-264,
+		1e-263,
+		1e-262,
+		1.0000000000000001e-261,
+		1.0000000000000001e-260,
+		1e-259,
+		1.0000000000000001e-258,
+		1.0000000000000002e-257,
+		1.0000000000000001e-256,
+		1e-255,
+		1.0000000000000001e-254,
+		1e-253,
+		1.0000000000000001e-252,
+		1e-251,
+		1e-250,
+		1e-249,
+		1.0000000000000002e-248,
+		1e-247,
+		1.0000000000000001e-246,
+		1.0000000000000001e-245,
+		1.0000000000000001e-244,
+		1.0000000000000001e-243,
+		1.0000000000000002e-242,
+		1.0000000000000001e-241,
+		1.0000000000000001e-240,
+		1e-239,
+		1.0000000000000002e-238,
+		1.0000000000000001e-237,
+		1e-236,
+		1.0000000000000001e-235,
+		1.0000000000000001e-234,
+		1.0000000000000001e-233,
+		1e-232,
+		1.0000000000000001e-231,
+		1e-230,
+		1e-229,
+		1e-228,
+		1.0000000000000001e-227,
+		1.0000000000000001e-226,
+		1.0000000000000001e-225,
+		1e-224,
+		1.0000000000000002e-223,
+		1e-222,
+		1e-221,
+		1.0000000000000002e-220,
+		1e-219,
+		1e-218,
+		1e-217,
+		1e-216,
+		1e-215,
+		1.0000000000000001e-214,
+		1.0000000000000001e-213,
+		1.0000000000000001e-212,
+		1e-211,
+		1e-210,
+		1e-209,
+		1e-208,
+		1.0000000000000001e-207,
+		1e-206,
+		1e-205,
+		1e-204,
+		1e-203,
+		1e-202,
+		1.0000000000000001e-201,
+		1.0000000000000001e-200,
+		1.0000000000000001e-199,
+		1.0000000000000001e-198,
+		1.0000000000000001e-197,
+		1e-196,
+		1e-195,
+		1e-194,
+		1e-193,
+		1e-192,
+		1e-191,
+		1e-190,
+		1e-189,
+		1.0000000000000001e-188,
+		1e-187,
+		1.0000000000000001e-186,
+		1.0000000000000002e-185,
+		1e-184,
+		1e-183,
+		1e-182,
+		1e-181,
+		1e-180,
+		1e-179,
+		1.0000000000000001e-178,
+		1.0000000000000002e-177,
+		1.0000000000000002e-176,
+		1.0000000000000001e-175,
+		1.0000000000000001e-174,
+		1e-173,
+		1e-172,
+		1.0000000000000001e-171,
+		1.0000000000000002e-170,
+		1e-169,
+		1e-168,
+		1e-167,
+		1e-166,
+		1e-165,
+		1.0000000000000002e-164,
+		1.0000000000000001e-163,
+		1.0000000000000001e-162,
+		1e-161,
+		1.0000000000000001e-160,
+		1.0000000000000001e-159,
+		1e-158,
+		1.0000000000000001e-157,
+		1e-156,
+		1e-155,
+		1.0000000000000001e-154,
+		1e-153,
+		1e-152,
+		1.0000000000000001e-151,
+		1e-150,
+		1.0000000000000002e-149,
+		1.0000000000000001e-148,
+		1.0000000000000001e-147,
+		1e-146,
+		1.0000000000000001e-145,
+		1.0000000000000001e-144,
+		1.0000000000000001e-143,
+		1e-142,
+		1e-141,
+		1.0000000000000001e-140,
+		1e-139,
+		1e-138,
+		1.0000000000000001e-137,
+		1e-136,
+		1e-135,
+		1e-134,
+		1e-133,
+		1.0000000000000001e-132,
+		1.0000000000000001e-131,
+		1e-130,
+		1.0000000000000001e-129,
+		1e-128,
+		1e-127,
+		1.0000000000000001e-126,
+		1e-125,
+		1.0000000000000001e-124,
+		1e-123,
+		1e-122,
+		1.0000000000000002e-121,
+		1.0000000000000002e-120,
+		1e-119,
+		1.0000000000000002e-118,
+		1e-117,
+		1.0000000000000001e-116,
+		1e-115,
+		1e-114,
+		1.0000000000000001e-113,
+		1.0000000000000001e-112,
+		1e-111,
+		1e-110,
+		1.0000000000000001e-109,
+		1e-108,
+		1e-107,
+		1.0000000000000001e-106,
+		1.0000000000000002e-105,
+		1.0000000000000001e-104,
+		1.0000000000000001e-103,
+		1.0000000000000001e-102,
+		1e-101,
+		1e-100,
+		1e-99,
+		1.0000000000000001e-98,
+		1e-97,
+		1.0000000000000001e-96,
+		1.0000000000000002e-95,
+		1.0000000000000001e-94,
+		1.0000000000000001e-93,
+		1.0000000000000002e-92,
+		1e-91,
+		1.0000000000000002e-90,
+		1e-89,
+		1.0000000000000001e-88,
+		1e-87,
+		1e-86,
+		1.0000000000000001e-85,
+		1e-84,
+		1e-83,
+		1.0000000000000001e-82,
+		1.0000000000000001e-81,
+		1.0000000000000001e-80,
+		1.0000000000000001e-79,
+		1.0000000000000001e-78,
+		1.0000000000000001e-77,
+		1.0000000000000001e-76,
+		1.0000000000000001e-75,
+		1.0000000000000002e-74,
+		1.0000000000000002e-73,
+		1.0000000000000001e-72,
+		1.0000000000000001e-71,
+		1.0000000000000002e-70,
+		1.0000000000000001e-69,
+		1e-68,
+		1.0000000000000001e-67,
+		1.0000000000000001e-66,
+		1.0000000000000001e-65,
+		1.0000000000000001e-64,
+		1e-63,
+		1e-62,
+		1e-61,
+		1.0000000000000001e-60,
+		1e-59,
+		1e-58,
+		1.0000000000000001e-57,
+		1e-56,
+		1.0000000000000002e-55,
+		1e-54,
+		1e-53,
+		1e-52,
+		1e-51,
+		1e-50,
+		1.0000000000000001e-49,
+		1.0000000000000001e-48,
+		1.0000000000000001e-47,
+		1e-46,
+		1.0000000000000001e-45,
+		1.0000000000000001e-44,
+		1e-43,
+		1e-42,
+		1e-41,
+		1.0000000000000001e-40,
+		1.0000000000000001e-39,
+		1.0000000000000001e-38,
+		1e-37,
+		1.0000000000000001e-36,
+		1e-35,
+		1.0000000000000001e-34,
+		1e-33,
+		1e-32,
+		1e-31,
+		1e-30,
+		1.0000000000000001e-29,
+		1.0000000000000001e-28,
+		1e-27,
+		1e-26,
+		1e-25,
+		1.0000000000000001e-24,
+		1.0000000000000001e-23,
+		1e-22,
+		1.0000000000000001e-21,
+		1.0000000000000001e-20,
+		1.0000000000000001e-19,
+		1e-18,
+		1e-17,
+		1.0000000000000001e-16,
+		1e-15,
+		1.0000000000000002e-14,
+		1e-13,
+		1.0000000000000002e-12,
+		1.0000000000000001e-11,
+		1e-10,
+		1e-09,
+		1e-08,
+		1.0000000000000001e-07,
+		1.0000000000000002e-06,
+		1e-05,
+		0.0001,
+		0.001,
+		0.01,
+		0.1,
+		1.0,
+		10.0,
+		100.0,
+		1000.0,
+		10000.0,
+		100000.0,
+		1000000.0,
+		10000000.0,
+		100000000.0,
+		1000000000.0,
+		10000000000.0,
+		100000000000.0,
+		1000000000000.0,
+		10000000000000.0,
+		100000000000000.0,
+		1000000000000000.0,
+		1e+16,
+		1e+17,
+		1e+18,
+		1e+19,
+		1e+20,
+		1e+21,
+		1e+22,
+		1.0000000000000001e+23,
+		1.0000000000000001e+24,
+		1e+25,
+		1e+26,
+		1e+27,
+		1.0000000000000002e+28,
+		1.0000000000000001e+29,
+		1e+30,
+		1.0000000000000001e+31,
+		1e+32,
+		1.0000000000000001e+33,
+		1.0000000000000001e+34,
+		1.0000000000000002e+35,
+		1e+36,
+		1.0000000000000001e+37,
+		1.0000000000000002e+38,
+		1.0000000000000001e+39,
+		1e+40,
+		1e+41,
+		1e+42,
+		1e+43,
+		1e+44,
+		1.0000000000000001e+45,
+		1.0000000000000001e+46,
+		1e+47,
+		1e+48,
+		1.0000000000000001e+49,
+		1e+50,
+		1.0000000000000002e+51,
+		1.0000000000000001e+52,
+		1.0000000000000002e+53,
+		1e+54,
+		1e+55,
+		1e+56,
+		1e+57,
+		1.0000000000000001e+58,
+		1.0000000000000001e+59,
+		1.0000000000000001e+60,
+		1.0000000000000001e+61,
+		1e+62,
+		1e+63,
+		1e+64,
+		1.0000000000000001e+65,
+		1.0000000000000001e+66,
+		1.0000000000000001e+67,
+		1.0000000000000001e+68,
+		1e+69,
+		1e+70,
+		1e+71,
+		1.0000000000000001e+72,
+		1.0000000000000001e+73,
+		1.0000000000000001e+74,
+		1.0000000000000001e+75,
+		1e+76,
+		1.0000000000000001e+77,
+		1e+78,
+		1.0000000000000001e+79,
+		1e+80,
+		1.0000000000000001e+81,
+		1.0000000000000001e+82,
+		1e+83,
+		1e+84,
+		1e+85,
+		1e+86,
+		1.0000000000000002e+87,
+		1.0000000000000001e+88,
+		1.0000000000000001e+89,
+		1.0000000000000001e+90,
+		1e+91,
+		1e+92,
+		1e+93,
+		1e+94,
+		1e+95,
+		1e+96,
+		1e+97,
+		1.0000000000000001e+98,
+		1.0000000000000001e+99,
+		1e+100,
+		1.0000000000000001e+101,
+		1.0000000000000001e+102,
+		1e+103,
+		1e+104,
+		1.0000000000000001e+105,
+		1e+106,
+		1.0000000000000001e+107,
+		1e+108,
+		1.0000000000000002e+109,
+		1e+110,
+		1.0000000000000001e+111,
+		1.0000000000000001e+112,
+		1e+113,
+		1e+114,
+		1e+115,
+		1e+116,
+		1e+117,
+		1.0000000000000001e+118,
+		1.0000000000000001e+119,
+		1.0000000000000001e+120,
+		1e+121,
+		1e+122,
+		1.0000000000000001e+123,
+		1.0000000000000001e+124,
+		1.0000000000000001e+125,
+		1.0000000000000001e+126,
+		1.0000000000000001e+127,
+		1e+128,
+		1.0000000000000002e+129,
+		1e+130,
+		1.0000000000000001e+131,
+		1.0000000000000001e+132,
+		1e+133,
+		1.0000000000000001e+134,
+		1.0000000000000001e+135,
+		1e+136,
+		1e+137,
+		1e+138,
+		1e+139,
+		1e+140,
+		1e+141,
+		1e+142,
+		1e+143,
+		1e+144,
+		1.0000000000000001e+145,
+		1.0000000000000002e+146,
+		1.0000000000000002e+147,
+		1e+148,
+		1e+149,
+		1.0000000000000002e+150,
+		1e+151,
+		1e+152,
+		1.0000000000000002e+153,
+		1e+154,
+		1e+155,
+		1.0000000000000002e+156,
+		1.0000000000000001e+157,
+		1.0000000000000001e+158,
+		1.0000000000000001e+159,
+		1e+160,
+		1e+161,
+		1.0000000000000001e+162,
+		1.0000000000000001e+163,
+		1e+164,
+		1.0000000000000001e+165,
+		1.0000000000000001e+166,
+		1e+167,
+		1.0000000000000001e+168,
+		1.0000000000000001e+169,
+		1e+170,
+		1.0000000000000002e+171,
+		1e+172,
+		1e+173,
+		1e+174,
+		1.0000000000000001e+175,
+		1e+176,
+		1e+177,
+		1e+178,
+		1.0000000000000001e+179,
+		1e+180,
+		1.0000000000000001e+181,
+		1e+182,
+		1.0000000000000001e+183,
+		1e+184,
+		1.0000000000000001e+185,
+		1.0000000000000001e+186,
+		1.0000000000000001e+187,
+		1e+188,
+		1e+189,
+		1e+190,
+		1e+191,
+		1e+192,
+		1e+193,
+		1.0000000000000001e+194,
+		1.0000000000000001e+195,
+		1.0000000000000002e+196,
+		1.0000000000000001e+197,
+		1e+198,
+		1e+199,
+		1.0000000000000001e+200,
+		1e+201,
+		1.0000000000000001e+202,
+		1.0000000000000002e+203,
+		1.0000000000000001e+204,
+		1e+205,
+		1e+206,
+		1e+207,
+		1.0000000000000001e+208,
+		1e+209,
+		1.0000000000000001e+210,
+		1.0000000000000001e+211,
+		1.0000000000000001e+212,
+		1.0000000000000001e+213,
+		1.0000000000000001e+214,
+		1.0000000000000001e+215,
+		1e+216,
+		1.0000000000000001e+217,
+		1e+218,
+		1.0000000000000001e+219,
+		1.0000000000000001e+220,
+		1e+221,
+		1e+222,
+		1e+223,
+		1.0000000000000002e+224,
+		1.0000000000000001e+225,
+		1.0000000000000001e+226,
+		1e+227,
+		1.0000000000000001e+228,
+		1.0000000000000001e+229,
+		1e+230,
+		1e+231,
+		1e+232,
+		1.0000000000000002e+233,
+		1e+234,
+		1e+235,
+		1e+236,
+		1.0000000000000001e+237,
+		1e+238,
+		1.0000000000000001e+239,
+		1e+240,
+		1e+241,
+		1e+242,
+		1e+243,
+		1e+244,
+		1e+245,
+		1e+246,
+		1.0000000000000001e+247,
+		1e+248,
+		1.0000000000000001e+249,
+		1.0000000000000001e+250,
+		1e+251,
+		1e+252,
+		1.0000000000000001e+253,
+		1.0000000000000001e+254,
+		1.0000000000000002e+255,
+		1e+256,
+		1e+257,
+		1e+258,
+		1.0000000000000001e+259,
+		1e+260,
+		1.0000000000000001e+261,
+		1e+262,
+		1e+263,
+		1e+264,
+		1e+265,
+		1e+266,
+		1.0000000000000001e+267,
+		1.0000000000000002e+268,
+		1e+269,
+		1e+270,
+		1.0000000000000001e+271,
+		1e+272,
+		1.0000000000000001e+273,
+		1.0000000000000001e+274,
+		1.0000000000000001e+275,
+		1e+276,
+		1e+277,
+		1.0000000000000001e+278,
+		1e+279,
+		1e+280,
+		1e+281,
+		1e+282,
+		1.0000000000000002e+283,
+		1e+284,
+		1.0000000000000001e+285,
+		1e+286,
+		1e+287,
+		1e+288,
+		1e+289,
+		1e+290,
+		1.0000000000000001e+291,
+		1e+292,
+		1.0000000000000001e+293,
+		1e+294,
+		1.0000000000000001e+295,
+		1.0000000000000002e+296,
+		1e+297,
+		1.0000000000000001e+298,
+		1e+299,
+		1e+300,
+		1e+301,
+		1e+302,
+		1e+303,
+		1.0000000000000001e+304,
+		1.0000000000000001e+305,
+		1e+306,
+		1.0000000000000001e+307,
+		1e+308,
+	};
+};
+
+template<class T> constexpr int32_t lookup<T>::table_len;
+template<class T> constexpr int32_t lookup<T>::exp_off;
+template<class T> constexpr int32_t lookup<T>::thr_off;
+template<class T> constexpr hp_t lookup<T>::table[600];
+template<class T> constexpr int16_t lookup<T>::exp[2098];
+template<class T> constexpr double lookup<T>::thr[632];
+
+}
+
+}
@@ -0,0 +1,201 @@
+#ifndef ERROL_SHORTEST_H
+#define ERROL_SHORTEST_H
+
+/*
+ * Scaling prologue and digit loop of 'errol_short', shared by 'errol.c' and
+ * the header-only 'errol.hpp' so the two cannot drift apart. The includer
+ * provides 'hp.h' and 'wide.h', and the power table as 'errol_decade' and
+ * 'errol_row'; 'errol.hpp' includes this file inside its detail namespace.
+ */
+
+/*
+ * number of power table rows, holding 10^308 down to 10^-291
+ */
+
+#define ERROL_ROWS	600
+
+
+/**
+ * Retrieve the previous double.
+ *   @val: The value.
+ *   &returns: The next lower double.
+ */
+
+static inline double getprev(double val)
+{
+	return fp_from_bits(fp_bits(val) - 1);
+}
+
+/**
+ * Retrieve the next double.
+ *   @val: The value.
+ *   &returns: The next higher double.
+ */
+
+static inline double getnext(double val)
+{
+	return fp_from_bits(fp_bits(val) + 1);
+}
+
+/**
+ * Find the lookup table row that scales a value closest to the range
+ * [0.1, 1). The table is indexed by the binary exponent, found from the bit
+ * length for subnormals, and 'errol_decade' maps it to a row.
+ *   @val: The value.
+ *   @idx: Out. The row, clamped to the table.
+ *   &returns: The unclamped row.
+ */
+
+static inline int32_t errol_index(double val, int32_t *idx)
+{
+	uint64_t u = fp_bits(val);
+	int32_t e, i;
+
+	e = u >> 52;
+	e = (e != 0) ? (e - 1022) : (63 - __builtin_clzl(u) - 1073);
+
+	i = errol_decade(val, e);
+
+	*idx = i;
+	if(*idx < 0)
+		*idx = 0;
+	else if(*idx >= ERROL_ROWS)
+		*idx = ERROL_ROWS - 1;
+
+	return i;
+}
+
+/**
+ * Scale a value into the range [0.1, 1) and compute the high and low bounds
+ * of its rounding interval. The binary exponent selects the decade through
+ * the exponent table, so at most one adjustment remains for a high bound
+ * that crosses into the next decade.
+ *   @val: The value.
+ *   @div: The divisor applied to the gaps.
+ *   @high: Out. The high bound.
+ *   @low: Out. The low bound.
+ *   &returns: The decimal exponent.
+ */
+
+static inline int32_t errol_scale(double val, double div, struct hp_t *high, struct hp_t *low)
+{
+	int32_t i, idx;
+	struct hp_t mid, row;
+
+	i = errol_index(val, &idx);
+	row = errol_row(idx);
+	mid = fp_prod(row, val);
+
+	high->val = low->val = mid.val;
+	high->err = mid.err + (getnext(val) - val) * row.val / div;
+	low->err = mid.err + (getprev(val) - val) * row.val / div;
+	fp_normalize(high);
+	fp_normalize(low);
+
+	/* past the ends of the lookup table, apply the remaining powers of ten */
+
+	for(; idx > i; idx--)
+		fp_mul(high), fp_mul(low);
+
+	for(; idx < i; idx++)
+		fp_div(high), fp_div(low);
+
+	if((high->val > 1.0) || ((high->val == 1.0) && (high->err >= 0.0)))
+		i++, fp_div(high), fp_div(low);
+
+	return i - 308;
+}
+
+/**
+ * Convert a positive finite value that is not an integer below 2^64. Values
+ * whose digits fit the double-double precision scale into [0.1, 1) and
+ * generate four digits per step until the bounds differ; the rest take the
+ * exact wide path.
+ *   @val: The value.
+ *   @buf: The output buffer, not terminated.
+ *   @exp: Out. The exponent.
+ *   &returns: The number of digits.
+ */
+
+static inline int32_t errol_frac_conv(double val, char *buf, int32_t *exp)
+{
+	char *ptr = buf;
+
+	if(val == 4.503599627370496e+38) {
+		memcpy(buf, "4503599627370496", 16);
+		*exp = 39;
+
+		return 16;
+	}
+	else if((val < 1.80143985094820e+16) || (val >= 3.40282366920938e+38)) {
+		uint32_t hdig, ldig;
+		struct hp_t high, low;
+
+		*exp = errol_scale(val, 2.0, &high, &low);
+
+		while(1) {
+			high = hp_mul10000(high);
+			low = hp_mul10000(low);
+
+			uint16_t h = (uint16_t)high.val;
+			high.val -= h;
+			if(high.val == 0.0 && high.err < 0)
+				h -= 1, high.val += 1.0;
+
+			uint16_t l = (uint16_t)low.val;
+			low.val -= l;
+			if(low.val == 0.0 && low.err < 0)
+				l -= 1, low.val += 1.0;
+
+			hdig = h / 1000;
+			ldig = l / 1000;
+			*ptr++ = hdig + '0';
+			if(ldig != hdig)
+				break;
+
+			h -= hdig * 1000;
+			l -= ldig * 1000;
+			hdig = h / 100;
+			ldig = l / 100;
+			*ptr++ = hdig + '0';
+			if(ldig != hdig)
+				break;
+
+			h -= hdig * 100;
+			l -= ldig * 100;
+			hdig = h / 10;
+			ldig = l / 10;
+			*ptr++ = hdig + '0';
+			if(ldig != hdig)
+				break;
+
+			hdig = h % 10;
+			ldig = l % 10;
+			*ptr++ = hdig + '0';
+			if(ldig != hdig)
+				break;
+		}
+
+		return ptr - buf;
+	}
+	else
+		return errol_wide_conv(val, buf, exp);
+}
+
+/**
+ * Convert a positive finite value to its shortest digits, as 'errol_short'.
+ *   @val: The value.
+ *   @buf: The output buffer, not terminated.
+ *   @exp: Out. The exponent.
+ *   &returns: The number of digits.
+ */
+
+static inline int32_t errol_short_conv(double val, char *buf, int32_t *exp)
+{
+	if(errol_isint(val))
+		return errol_int_conv(val, buf, exp);
+	else
+		return errol_frac_conv(val, buf, exp);
+}
+
+#endif
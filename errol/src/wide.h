@@ -0,0 +1,323 @@
+#ifndef ERROL_WIDE_H
+#define ERROL_WIDE_H
+
+/*
+ * Exact integer paths of 'errol_short', shared by 'errol.c' and the
+ * header-only 'errol.hpp' so the two cannot drift apart. The includer
+ * provides <stdint.h> and <string.h>; 'errol.hpp' includes this file inside
+ * its detail namespace.
+ */
+
+/*
+ * two-digit decimal table
+ */
+
+static const char errol_digits[201] =
+	"00010203040506070809101112131415161718192021222324"
+	"25262728293031323334353637383940414243444546474849"
+	"50515253545556575859606162636465666768697071727374"
+	"75767778798081828384858687888990919293949596979899";
+
+/*
+ * powers of ten below 2^64
+ */
+
+static const uint64_t u64_pow10[20] = {
+	1ul, 10ul, 100ul, 1000ul, 10000ul, 100000ul, 1000000ul, 10000000ul, 100000000ul, 1000000000ul,
+	10000000000ul, 100000000000ul, 1000000000000ul, 10000000000000ul, 100000000000000ul,
+	1000000000000000ul, 10000000000000000ul, 100000000000000000ul, 1000000000000000000ul,
+	10000000000000000000ul
+};
+
+/**
+ * Divide a 128-bit integer by 10^19 using a precomputed reciprocal. The
+ * divisor is normalized, so a single multiply and at most two corrections
+ * yield the quotient and remainder.
+ *   @n1: The high word, less than 10^19.
+ *   @n0: The low word.
+ *   @rem: Out. The remainder.
+ *   &returns: The quotient.
+ */
+
+static inline uint64_t u128_div19(uint64_t n1, uint64_t n0, uint64_t *rem)
+{
+	static const uint64_t d = 10000000000000000000ul, inv = 15581492618384294730ul;
+	__uint128_t q;
+	uint64_t q1, q0, r;
+
+	q = (__uint128_t)inv * n1 + (((__uint128_t)n1 << 64) | n0);
+	q1 = (uint64_t)(q >> 64) + 1;
+	q0 = (uint64_t)q;
+
+	r = n0 - q1 * d;
+	if(r > q0)
+		q1--, r += d;
+
+	if(r >= d)
+		q1++, r -= d;
+
+	*rem = r;
+
+	return q1;
+}
+
+/**
+ * Split a 128-bit integer into base 10^19 chunks.
+ *   @val: The value.
+ *   @chunk: Out. The three chunks, least significant first.
+ */
+
+static inline void u128_split(__uint128_t val, uint64_t *chunk)
+{
+	static const uint64_t d = 10000000000000000000ul;
+	uint64_t n1 = val >> 64, carry = 0;
+	__uint128_t q;
+
+	if(n1 >= d)
+		n1 -= d, carry = 1;
+
+	q = u128_div19(n1, (uint64_t)val, &chunk[0]);
+	if(carry)
+		q += (__uint128_t)1 << 64;
+
+	chunk[2] = 0;
+	while(q >= d)
+		q -= d, chunk[2]++;
+
+	chunk[1] = q;
+}
+
+/**
+ * Count the decimal digits of a nonzero 64-bit integer.
+ *   @val: The value.
+ *   &returns: The number of digits.
+ */
+
+static inline int32_t u64_digits(uint64_t val)
+{
+	int32_t n = ((64 - __builtin_clzl(val)) * 1233) >> 12;
+
+	return n + (val >= u64_pow10[n]);
+}
+
+/**
+ * Write the low digits of a 64-bit integer.
+ *   @val: The value.
+ *   @n: The number of digits to write.
+ *   @buf: The output buffer.
+ */
+
+static inline void u64_write(uint64_t val, int32_t n, char *buf)
+{
+	for(; n >= 2; n -= 2) {
+		memcpy(buf + n - 2, errol_digits + 2 * (val % 100), 2);
+		val /= 100;
+	}
+
+	if(n == 1)
+		buf[0] = '0' + val % 10;
+}
+
+/**
+ * Write the digits of a high bound chunk, and locate the first digit where
+ * it differs from the low bound chunk.
+ *   @h, l: The high and low chunks.
+ *   @w: The number of digits in the chunk.
+ *   @first: The first position where a difference counts.
+ *   @buf: The output buffer, receiving the 'w' digits of the high chunk.
+ *   @hz, lz: Out. The number of trailing zero digits of each chunk.
+ *   &returns: The position of the first difference, or 'w' if none.
+ */
+
+static inline int32_t wide_chunk(uint64_t h, uint64_t l, int32_t w, int32_t first, char *buf, int32_t *hz, int32_t *lz)
+{
+	int32_t i, diff = w;
+	uint32_t hv, lv;
+	const char *hp, *lp;
+
+	*hz = *lz = 0;
+
+	for(i = w; i >= 2; i -= 2) {
+		hv = h % 100;
+		lv = l % 100;
+		h /= 100;
+		l /= 100;
+
+		hp = errol_digits + 2 * hv;
+		lp = errol_digits + 2 * lv;
+		buf[i - 2] = hp[0];
+		buf[i - 1] = hp[1];
+
+		if(hv != lv) {
+			if((hp[0] != lp[0]) && (i - 2 >= first))
+				diff = i - 2;
+			else if(hp[1] != lp[1])
+				diff = i - 1;
+		}
+
+		if(*hz == w - i)
+			*hz += (hv == 0) ? 2 : (hv % 10 == 0);
+
+		if(*lz == w - i)
+			*lz += (lv == 0) ? 2 : (lv % 10 == 0);
+	}
+
+	if(i == 1) {
+		buf[0] = '0' + h;
+		if((h != l) && (first == 0))
+			diff = 0;
+
+		if(*hz == w - 1)
+			*hz += (h == 0);
+
+		if(*lz == w - 1)
+			*lz += (l == 0);
+	}
+
+	return diff;
+}
+
+/**
+ * Check if a value is an integer below 2^64, from its exponent and mantissa.
+ *   @val: The value.
+ *   &returns: True if integral and below 2^64, false otherwise.
+ */
+
+static inline char errol_isint(double val)
+{
+	union { double d; uint64_t i; } bits;
+	int32_t e;
+
+	bits.d = val;
+	e = (int32_t)(bits.i >> 52) - 1023;
+	if((e < 0) || (e >= 64))
+		return 0;
+
+	return (e >= 52) || ((bits.i & ((((uint64_t)1 << 52) - 1) >> e)) == 0);
+}
+
+/**
+ * Convert an integer below 2^64. The bounds of the rounding interval are
+ * integers past 2^53 and the value itself below, so the shortest form is
+ * the multiple of the largest power of ten within the bounds, choosing the
+ * one nearest the value.
+ *   @val: The value.
+ *   @buf: The output buffer.
+ *   @exp: Out. The exponent.
+ *   &returns: The number of digits, without trailing zeros.
+ */
+
+static inline int32_t errol_int_conv(double val, char *buf, int32_t *exp)
+{
+	union { double d; uint64_t i; } bits;
+	int32_t t, k, n;
+	uint64_t m, v, lo, hi, lq, hq, vq, up;
+	uint32_t dig = 0, sticky = 0;
+
+	bits.d = val;
+	m = (bits.i & (((uint64_t)1 << 52) - 1)) | ((uint64_t)1 << 52);
+	t = (int32_t)(bits.i >> 52) - 1075;
+	v = (t >= 0) ? (m << t) : (m >> -t);
+
+	lo = hi = v;
+	if((t > 1) || ((t == 1) && (m != ((uint64_t)1 << 52)))) {
+		hi = v + ((uint64_t)1 << (t - 1)) - (m & 0x1);
+		lo = v - ((uint64_t)1 << (t - ((m == ((uint64_t)1 << 52)) ? 2 : 1))) + (m & 0x1);
+	}
+
+	/* strip digits while a multiple of the next power of ten stays within bounds */
+
+	hq = hi, lq = lo, vq = v;
+	for(k = 0; (hq / 10) >= ((lq + 9) / 10); k++) {
+		sticky |= dig;
+		dig = vq % 10;
+		vq /= 10;
+		hq /= 10;
+		lq = (lq + 9) / 10;
+	}
+
+	up = (dig > 5) || ((dig == 5) && (sticky || (vq & 0x1)));
+	vq += up;
+	if(vq > hq)
+		vq = hq;
+	else if(vq < lq)
+		vq = lq;
+
+	n = u64_digits(vq);
+	u64_write(vq, n, buf);
+	*exp = n + k;
+
+	for(t = n; buf[t - 1] == '0'; t--);
+
+	return t;
+}
+
+/**
+ * Convert a value in the 128-bit range that is not an integer below 2^64.
+ * The value and the bounds of its rounding interval are exact 128-bit
+ * integers, split into base 10^19 chunks and compared digit by digit.
+ *   @val: The value.
+ *   @buf: The output buffer.
+ *   @exp: Out. The exponent.
+ *   &returns: The number of digits.
+ */
+
+static inline int32_t errol_wide_conv(double val, char *buf, int32_t *exp)
+{
+	int32_t n, c, t, w, first, diff, hz, lz;
+	char hzero, lzero, *ptr = buf;
+	union { double d; uint64_t i; } bits;
+	uint64_t m, hchunk[3], lchunk[3];
+	__uint128_t v, low, high;
+
+	/* the bounds lie half a gap from the value, exactly as integers */
+
+	bits.d = val;
+	m = (bits.i & (((uint64_t)1 << 52) - 1)) | ((uint64_t)1 << 52);
+	t = (bits.i >> 52) - 1075;
+
+	v = (__uint128_t)m << t;
+	low = v - ((__uint128_t)1 << (t - ((m == ((uint64_t)1 << 52)) ? 2 : 1)));
+	high = v + ((__uint128_t)1 << (t - 1));
+
+	if(m & 0x1)
+		low++, high--;
+
+	u128_split(low, lchunk);
+	u128_split(high, hchunk);
+
+	/* walk the chunks down to the first digit, past the leading digit, where the bounds differ */
+
+	c = (hchunk[2] != 0) ? 2 : ((hchunk[1] != 0) ? 1 : 0);
+	w = u64_digits(hchunk[c]);
+	n = 19 * c + w;
+
+	for(first = 1; ; first = 0, c--, ptr += w, w = 19) {
+		diff = wide_chunk(hchunk[c], lchunk[c], w, first, ptr, &hz, &lz);
+		if(diff < w)
+			break;
+	}
+
+	/* a bound ends at the difference when its remaining digits are zero */
+
+	hzero = (hz >= w - diff);
+	lzero = (lz >= w - diff);
+	for(t = 0; t < c; t++)
+		hzero &= (hchunk[t] == 0), lzero &= (lchunk[t] == 0);
+
+	/* keep the common prefix, and the next high digit unless a bound ends there */
+
+	if(hzero || lzero) {
+		ptr += diff;
+		while(ptr[-1] == '0')
+			ptr--;
+	}
+	else
+		ptr += diff + 1;
+
+	*exp = n;
+
+	return ptr - buf;
+}
+
+#endif
@@ -34,6 +34,15 @@
 
 namespace double_conversion {
 
+// The digit generation divides by the denominator once for every
+// kDigitBlock digits. 10^kDigitBlock must fit into the 30 bits that
+// Bignum::DivideModuloBignum supports.
+static const int kDigitBlock = 9;
+static const uint32_t kPowersOfTen[] = {
+  1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000, 1000000000
+};
+
+
 static int NormalizedExponent(uint64_t significand, int exponent) {
   ASSERT(significand != 0);
   while ((significand & Double::kHiddenBit) == 0) {
@@ -186,90 +195,123 @@ static void GenerateShortestDigits(Bignum* numerator, Bignum* denominator,
                                    Bignum* delta_minus, Bignum* delta_plus,
                                    bool is_even,
                                    Vector<char> buffer, int* length) {
-  // Small optimization: if delta_minus and delta_plus are the same just reuse
-  // one of the two bignums.
-  if (Bignum::Equal(*delta_minus, *delta_plus)) {
-    delta_plus = delta_minus;
-  }
+  // Digits are produced kDigitBlock at a time. Next to v we also divide the
+  // boundaries m- and m+, so that the stopping test for every digit of a
+  // block becomes a comparison of integer prefixes:
+  // with t_j = floor(v * 10^j) (the first j digits), the remainder is within
+  // delta_minus iff t_j > m- * 10^j (>= if is_even), and the remainder plus
+  // delta_plus exceeds the denominator iff t_j + 1 < m+ * 10^j (<= if
+  // is_even).
+  Bignum low;
+  low.AssignBignum(*numerator);
+  low.SubtractBignum(*delta_minus);
+  Bignum* high = delta_plus;
+  high->AddBignum(*numerator);
   *length = 0;
+  // Until we stop, the digits of m- equal the ones of v, and the digits of m+
+  // exceed them by high_excess (0 or 1).
+  int high_excess = 0;
+  // The first block includes the digit in front of the decimal point.
+  int scale = kDigitBlock - 1;
   for (;;) {
-    uint16_t digit;
-    digit = numerator->DivideModuloIntBignum(*denominator);
-    ASSERT(digit <= 9);  // digit is a uint16_t and therefore always positive.
-    // digit = numerator / denominator (integer division).
-    // numerator = numerator % denominator.
-    buffer[(*length)++] = static_cast<char>(digit + '0');
-
-    // Can we stop already?
-    // If the remainder of the division is less than the distance to the lower
-    // boundary we can stop. In this case we simply round down (discarding the
-    // remainder).
-    // Similarly we test if we can round up (using the upper boundary).
-    bool in_delta_room_minus;
-    bool in_delta_room_plus;
-    if (is_even) {
-      in_delta_room_minus = Bignum::LessEqual(*numerator, *delta_minus);
-    } else {
-      in_delta_room_minus = Bignum::Less(*numerator, *delta_minus);
-    }
-    if (is_even) {
-      in_delta_room_plus =
-          Bignum::PlusCompare(*numerator, *delta_plus, *denominator) >= 0;
-    } else {
-      in_delta_room_plus =
-          Bignum::PlusCompare(*numerator, *delta_plus, *denominator) > 0;
-    }
-    if (!in_delta_room_minus && !in_delta_room_plus) {
-      // Prepare for next iteration.
-      numerator->Times10();
-      delta_minus->Times10();
-      // We optimized delta_plus to be equal to delta_minus (if they share the
-      // same value). So don't multiply delta_plus if they point to the same
-      // object.
-      if (delta_minus != delta_plus) {
-        delta_plus->Times10();
+    numerator->MultiplyByUInt32(kPowersOfTen[scale]);
+    low.MultiplyByUInt32(kPowersOfTen[scale]);
+    high->MultiplyByUInt32(kPowersOfTen[scale]);
+    uint32_t digits = numerator->DivideModuloBignum(*denominator);
+    uint32_t low_digits = low.DivideModuloBignum(*denominator);
+    uint32_t high_digits = high->DivideModuloBignum(*denominator);
+    ASSERT(digits < kPowersOfTen[kDigitBlock]);
+    int64_t high_distance = 0;
+    for (int i = 1; i <= kDigitBlock; ++i) {
+      uint32_t power = kPowersOfTen[kDigitBlock - i];
+      uint32_t prefix = digits / power;
+      uint32_t low_prefix = low_digits / power;
+      high_distance = static_cast<int64_t>(high_excess) * kPowersOfTen[i] +
+          (high_digits / power) - prefix;
+      // Can we stop already?
+      // If the remainder of the division is less than the distance to the
+      // lower boundary we can stop. In this case we simply round down
+      // (discarding the remainder).
+      // Similarly we test if we can round up (using the upper boundary).
+      bool in_delta_room_minus = low_prefix < prefix;
+      if (is_even && low_prefix == prefix) {
+        in_delta_room_minus = low_digits % power == 0 && low.IsZero();
       }
-    } else if (in_delta_room_minus && in_delta_room_plus) {
-      // Let's see if 2*numerator < denominator.
-      // If yes, then the next digit would be < 5 and we can round down.
-      int compare = Bignum::PlusCompare(*numerator, *numerator, *denominator);
-      if (compare < 0) {
-        // Remaining digits are less than .5. -> Round down (== do nothing).
-      } else if (compare > 0) {
-        // Remaining digits are more than .5 of denominator. -> Round up.
-        // Note that the last digit could not be a '9' as otherwise the whole
-        // loop would have stopped earlier.
-        // We still have an assert here in case the preconditions were not
-        // satisfied.
-        ASSERT(buffer[(*length) - 1] != '9');
-        buffer[(*length) - 1]++;
-      } else {
-        // Halfway case.
-        // TODO(floitsch): need a way to solve half-way cases.
-        //   For now let's round towards even (since this is what Gay seems to
-        //   do).
-
-        if ((buffer[(*length) - 1] - '0') % 2 == 0) {
-          // Round down => Do nothing.
+      bool in_delta_room_plus = high_distance > 1;
+      if (high_distance == 1) {
+        in_delta_room_plus =
+            is_even || high_digits % power != 0 || !high->IsZero();
+      }
+      if (!in_delta_room_minus && !in_delta_room_plus) continue;
+
+      for (int j = i - 1; j >= 0; --j) {
+        buffer[*length + j] = static_cast<char>('0' + prefix % 10);
+        prefix /= 10;
+      }
+      *length += i;
+      if (in_delta_room_minus && in_delta_room_plus) {
+        // Let's see if 2*remainder < denominator.
+        // If yes, then the next digit would be < 5 and we can round down.
+        int compare;
+        if (power == 1) {
+          compare = Bignum::PlusCompare(*numerator, *numerator, *denominator);
         } else {
+          // The remainder still starts with the remaining digits of the
+          // block.
+          uint32_t rest = digits % power;
+          uint32_t half = power / 2;
+          if (rest != half) {
+            compare = rest < half ? -1 : 1;
+          } else {
+            compare = numerator->IsZero() ? 0 : 1;
+          }
+        }
+        if (compare < 0) {
+          // Remaining digits are less than .5. -> Round down (== do nothing).
+        } else if (compare > 0) {
+          // Remaining digits are more than .5 of denominator. -> Round up.
+          // Note that the last digit could not be a '9' as otherwise the whole
+          // loop would have stopped earlier.
+          // We still have an assert here in case the preconditions were not
+          // satisfied.
           ASSERT(buffer[(*length) - 1] != '9');
           buffer[(*length) - 1]++;
+        } else {
+          // Halfway case.
+          // TODO(floitsch): need a way to solve half-way cases.
+          //   For now let's round towards even (since this is what Gay seems to
+          //   do).
+
+          if ((buffer[(*length) - 1] - '0') % 2 == 0) {
+            // Round down => Do nothing.
+          } else {
+            ASSERT(buffer[(*length) - 1] != '9');
+            buffer[(*length) - 1]++;
+          }
         }
+      } else if (in_delta_room_plus) {
+        // Round up.
+        // Note again that the last digit could not be '9' since this would
+        // have stopped the loop earlier.
+        // We still have an ASSERT here, in case the preconditions were not
+        // satisfied.
+        ASSERT(buffer[(*length) -1] != '9');
+        buffer[(*length) - 1]++;
       }
+      // Otherwise round down (== do nothing).
       return;
-    } else if (in_delta_room_minus) {
-      // Round down (== do nothing).
-      return;
-    } else {  // in_delta_room_plus
-      // Round up.
-      // Note again that the last digit could not be '9' since this would have
-      // stopped the loop earlier.
-      // We still have an ASSERT here, in case the preconditions were not
-      // satisfied.
-      ASSERT(buffer[(*length) -1] != '9');
-      buffer[(*length) - 1]++;
-      return;
     }
+    // Nothing in this block allows us to stop. Emit it and prepare for the
+    // next one.
+    ASSERT(low_digits == digits);
+    ASSERT(0 <= high_distance && high_distance <= 1);
+    high_excess = static_cast<int>(high_distance);
+    for (int j = kDigitBlock - 1; j >= 0; --j) {
+      buffer[*length + j] = static_cast<char>('0' + digits % 10);
+      digits /= 10;
+    }
+    *length += kDigitBlock;
+    scale = kDigitBlock;
   }
 }
 
@@ -284,24 +326,30 @@ static void GenerateCountedDigits(int count, int* decimal_point,
                                   Bignum* numerator, Bignum* denominator,
                                   Vector<char> buffer, int* length) {
   ASSERT(count >= 0);
-  for (int i = 0; i < count - 1; ++i) {
-    uint16_t digit;
-    digit = numerator->DivideModuloIntBignum(*denominator);
-    ASSERT(digit <= 9);  // digit is a uint16_t and therefore always positive.
-    // digit = numerator / denominator (integer division).
+  // The digits are produced in blocks of up to kDigitBlock, the last block
+  // ending exactly after 'count' digits. The first block includes the digit
+  // in front of the decimal point.
+  int generated = 0;
+  bool first = true;
+  while (generated < count) {
+    int block = Min(count - generated, kDigitBlock);
+    numerator->MultiplyByUInt32(kPowersOfTen[first ? block - 1 : block]);
+    first = false;
+    uint32_t digits = numerator->DivideModuloBignum(*denominator);
+    ASSERT(digits < kPowersOfTen[block]);
+    // digits = numerator / denominator (integer division).
     // numerator = numerator % denominator.
-    buffer[i] = static_cast<char>(digit + '0');
-    // Prepare for next iteration.
-    numerator->Times10();
+    for (int i = block - 1; i >= 0; --i) {
+      buffer[generated + i] = static_cast<char>('0' + digits % 10);
+      digits /= 10;
+    }
+    generated += block;
   }
-  // Generate the last digit.
-  uint16_t digit;
-  digit = numerator->DivideModuloIntBignum(*denominator);
-  if (Bignum::PlusCompare(*numerator, *numerator, *denominator) >= 0) {
-    digit++;
+  // Round the last digit.
+  if (count > 0 &&
+      Bignum::PlusCompare(*numerator, *numerator, *denominator) >= 0) {
+    buffer[count - 1]++;
   }
-  ASSERT(digit <= 10);
-  buffer[count - 1] = static_cast<char>(digit + '0');
   // Correct bad digits (in case we had a sequence of '9's). Propagate the
   // carry until we hat a non-'9' or til we reach the first digit.
   for (int i = count - 1; i > 0; --i) {
@@ -277,6 +277,16 @@ void Bignum::MultiplyByUInt64(uint64_t factor) {
     return;
   }
   ASSERT(kBigitSize < 32);
+#if defined(DOUBLE_CONVERSION_HAS_UINT128)
+  // The product of a bigit with the factor is of size kBigitSize + 64, and the
+  // carry stays below 2^65, so one native multiply-add per bigit suffices.
+  uint128_t carry = 0;
+  for (int i = 0; i < used_digits_; ++i) {
+    uint128_t product = static_cast<uint128_t>(factor) * bigits_[i] + carry;
+    bigits_[i] = static_cast<Chunk>(product) & kBigitMask;
+    carry = product >> kBigitSize;
+  }
+#else
   uint64_t carry = 0;
   uint64_t low = factor & 0xFFFFFFFF;
   uint64_t high = factor >> 32;
@@ -288,6 +298,7 @@ void Bignum::MultiplyByUInt64(uint64_t factor) {
     carry = (carry >> kBigitSize) + (tmp >> kBigitSize) +
         (product_high << (32 - kBigitSize));
   }
+#endif
   while (carry != 0) {
     EnsureCapacity(used_digits_ + 1);
     bigits_[used_digits_] = carry & kBigitMask;
@@ -549,6 +560,55 @@ uint16_t Bignum::DivideModuloIntBignum(const Bignum& other) {
 }
 
 
+uint32_t Bignum::DivideModuloBignum(const Bignum& other) {
+  ASSERT(IsClamped());
+  ASSERT(other.IsClamped());
+  ASSERT(other.used_digits_ > 0);
+
+  if (BigitLength() < other.BigitLength()) {
+    return 0;
+  }
+
+  Align(other);
+
+  // A 30 bit quotient spans at most two more bigits than the divisor.
+  int top = other.BigitLength() - 1;
+  ASSERT(BigitLength() - 1 <= top + 2);
+  // The leading bigits of both numbers, down to bigit 'top' - 2. Each
+  // approximation has at least 57 significant bits, and the estimate of the
+  // quotient is thus off by much less than 2^-18.
+  double this_approximation = 0.0;
+  for (int i = top + 2; i >= top - 2; --i) {
+    this_approximation =
+        this_approximation * (1 << kBigitSize) + BigitAt(i);
+  }
+  double other_approximation = 0.0;
+  for (int i = top; i >= top - 2; --i) {
+    other_approximation =
+        other_approximation * (1 << kBigitSize) + other.BigitAt(i);
+  }
+  double estimate = this_approximation / other_approximation;
+  ASSERT(estimate < (1 << 30) + 1.0);
+  uint32_t result = static_cast<uint32_t>(estimate);
+  const double kMargin = 1.0 / (1 << 18);
+  if (estimate - result > kMargin && (result + 1) - estimate > kMargin) {
+    // The estimate is safely away from an integer. Its integral part is the
+    // quotient.
+    SubtractTimes(other, static_cast<int>(result));
+    ASSERT(Less(*this, other));
+    return result;
+  }
+  // The quotient is close to an integer: stay below it and fix it up.
+  if (result > 0) result--;
+  SubtractTimes(other, static_cast<int>(result));
+  while (LessEqual(other, *this)) {
+    SubtractBignum(other);
+    result++;
+  }
+  return result;
+}
+
+
 template<typename S>
 static int SizeInHexChars(S number) {
   ASSERT(number > 0);
@@ -755,9 +815,10 @@ void Bignum::SubtractTimes(const Bignum& other, int factor) {
   }
   for (int i = other.used_digits_ + exponent_diff; i < used_digits_; ++i) {
     if (borrow == 0) return;
-    Chunk difference = bigits_[i] - borrow;
+    // For large factors the borrow can exceed a bigit.
+    Chunk difference = bigits_[i] - (borrow & kBigitMask);
     bigits_[i] = difference & kBigitMask;
-    borrow = difference >> (kChunkSize - 1);
+    borrow = (difference >> (kChunkSize - 1)) + (borrow >> kBigitSize);
   }
   Clamp();
 }
@@ -66,6 +66,11 @@ class Bignum {
   //  this = this % other;
   // In the worst case this function is in O(this/other).
   uint16_t DivideModuloIntBignum(const Bignum& other);
+  // Same as DivideModuloIntBignum, but for quotients of up to 30 bits. The
+  // quotient is estimated from the leading bigits, so that in general only
+  // one multiple of 'other' has to be subtracted.
+  uint32_t DivideModuloBignum(const Bignum& other);
+  bool IsZero() const { return used_digits_ == 0; }
 
   bool ToHexString(char* buffer, int buffer_size) const;
 
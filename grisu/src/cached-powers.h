@@ -35,8 +35,9 @@ namespace double_conversion {
 class PowersOfTenCache {
  public:
 
-  // Not all powers of ten are cached. The decimal exponent of two neighboring
-  // cached numbers will differ by kDecimalExponentDistance.
+  // Unless built with DOUBLE_CONVERSION_DENSE_CACHED_POWERS, not all powers of
+  // ten are cached. The decimal exponent of two neighboring cached numbers
+  // will differ by kDecimalExponentDistance.
   static const int kDecimalExponentDistance;
 
   static const int kMinDecimalExponent;
@@ -65,7 +65,15 @@ class DiyFp {
 
 
   // this = this * other.
-  void Multiply(const DiyFp& other);
+  // The result only contains the most significant 64 bits of the 128-bit
+  // product. The least significant 64 bits are only used for rounding, with
+  // halfway cases rounded up.
+  void Multiply(const DiyFp& other) {
+    uint64_t high;
+    uint64_t low = Multiply64(f_, other.f_, &high);
+    f_ = high + (low >> 63);
+    e_ += other.e_ + 64;
+  }
 
   // returns a * b;
   static DiyFp Times(const DiyFp& a, const DiyFp& b) {
@@ -76,22 +84,9 @@ class DiyFp {
 
   void Normalize() {
     ASSERT(f_ != 0);
-    uint64_t f = f_;
-    int e = e_;
-
-    // This method is mainly called for normalizing boundaries. In general
-    // boundaries need to be shifted by 10 bits. We thus optimize for this case.
-    const uint64_t k10MSBits = UINT64_2PART_C(0xFFC00000, 00000000);
-    while ((f & k10MSBits) == 0) {
-      f <<= 10;
-      e -= 10;
-    }
-    while ((f & kUint64MSB) == 0) {
-      f <<= 1;
-      e--;
-    }
-    f_ = f;
-    e_ = e;
+    int shift = CountLeadingZeros64(f_);
+    f_ <<= shift;
+    e_ -= shift;
   }
 
   static DiyFp Normalize(const DiyFp& a) {
@@ -107,8 +102,6 @@ class DiyFp {
   void set_e(int new_value) { e_ = new_value; }
 
  private:
-  static const uint64_t kUint64MSB = UINT64_2PART_C(0x80000000, 00000000);
-
   uint64_t f_;
   int e_;
 };
@@ -37,58 +37,112 @@
 #include "strtod.h"
 #include "utils.h"
 
+// SSE2 is available on every x86-64 processor. Define
+// DOUBLE_CONVERSION_NO_SSE2 to use the scalar code only, for instance to test
+// it.
+#if !defined(DOUBLE_CONVERSION_NO_SSE2) && \
+    (defined(__SSE2__) || defined(_M_X64) || \
+     (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#include <emmintrin.h>
+#define DOUBLE_CONVERSION_HAS_SSE2 1
+#endif
+
 namespace double_conversion {
 
 const DoubleToStringConverter& DoubleToStringConverter::EcmaScriptConverter() {
-  int flags = UNIQUE_ZERO | EMIT_POSITIVE_EXPONENT_SIGN;
-  static DoubleToStringConverter converter(flags,
-                                           "Infinity",
-                                           "NaN",
-                                           'e',
-                                           -6, 21,
-                                           6, 0);
+  static DoubleToStringConverter converter(
+      EcmaScriptFormat::flags(),
+      EcmaScriptFormat::infinity_symbol(),
+      EcmaScriptFormat::nan_symbol(),
+      EcmaScriptFormat::exponent_character(),
+      EcmaScriptFormat::decimal_in_shortest_low(),
+      EcmaScriptFormat::decimal_in_shortest_high(),
+      EcmaScriptFormat::max_leading_padding_zeroes_in_precision_mode(),
+      EcmaScriptFormat::max_trailing_padding_zeroes_in_precision_mode());
   return converter;
 }
 
 
+// Writes characters to a slot of known size. Unlike StringBuilder it does not
+// reserve room for a terminating null character.
+class SlotWriter {
+ public:
+  SlotWriter(char* buffer, int size) : buffer_(buffer, size), position_(0) {}
+
+  int position() const { return position_; }
+
+  void AddCharacter(char c) {
+    ASSERT(position_ < buffer_.length());
+    buffer_[position_++] = c;
+  }
+
+  void AddString(const char* s) {
+    AddSubstring(s, StrLength(s));
+  }
+
+  void AddSubstring(const char* s, int n) {
+    ASSERT(position_ + n <= buffer_.length());
+    memmove(buffer_.start() + position_, s, n);
+    position_ += n;
+  }
+
+  void AddPadding(char c, int count) {
+    for (int i = 0; i < count; i++) {
+      AddCharacter(c);
+    }
+  }
+
+ private:
+  Vector<char> buffer_;
+  int position_;
+
+  DISALLOW_IMPLICIT_CONSTRUCTORS(SlotWriter);
+};
+
+
+template <class Format>
 bool DoubleToStringConverter::HandleSpecialValues(
+    const Format& format,
     double value,
-    StringBuilder* result_builder) const {
+    PreparedNumber* prepared) {
   Double double_inspect(value);
   if (double_inspect.IsInfinite()) {
-    if (infinity_symbol_ == NULL) return false;
-    if (value < 0) {
-      result_builder->AddCharacter('-');
-    }
-    result_builder->AddString(infinity_symbol_);
+    if (format.infinity_symbol() == NULL) return false;
+    prepared->layout_ = PreparedNumber::SPECIAL;
+    prepared->negative_ = (value < 0);
+    prepared->symbol_ = format.infinity_symbol();
     return true;
   }
   if (double_inspect.IsNan()) {
-    if (nan_symbol_ == NULL) return false;
-    result_builder->AddString(nan_symbol_);
+    if (format.nan_symbol() == NULL) return false;
+    prepared->layout_ = PreparedNumber::SPECIAL;
+    prepared->negative_ = false;
+    prepared->symbol_ = format.nan_symbol();
     return true;
   }
   return false;
 }
 
 
+template <class Format, class Builder>
 void DoubleToStringConverter::CreateExponentialRepresentation(
+    const Format& format,
     const char* decimal_digits,
     int length,
     int exponent,
-    StringBuilder* result_builder) const {
+    Builder* result_builder) {
   ASSERT(length != 0);
   result_builder->AddCharacter(decimal_digits[0]);
   if (length != 1) {
     result_builder->AddCharacter('.');
     result_builder->AddSubstring(&decimal_digits[1], length-1);
   }
-  result_builder->AddCharacter(exponent_character_);
+  result_builder->AddCharacter(format.exponent_character());
   if (exponent < 0) {
     result_builder->AddCharacter('-');
     exponent = -exponent;
   } else {
-    if ((flags_ & EMIT_POSITIVE_EXPONENT_SIGN) != 0) {
+    if ((format.flags() & EMIT_POSITIVE_EXPONENT_SIGN) != 0) {
       result_builder->AddCharacter('+');
     }
   }
@@ -110,12 +164,14 @@ void DoubleToStringConverter::CreateExponentialRepresentation(
 }
 
 
+template <class Format, class Builder>
 void DoubleToStringConverter::CreateDecimalRepresentation(
+    const Format& format,
     const char* decimal_digits,
     int length,
     int decimal_point,
     int digits_after_point,
-    StringBuilder* result_builder) const {
+    Builder* result_builder) {
   // Create a representation that is padded with zeros if needed.
   if (decimal_point <= 0) {
       // "0.00000decimal_rep".
@@ -148,62 +204,66 @@ void DoubleToStringConverter::CreateDecimalRepresentation(
     result_builder->AddPadding('0', remaining_digits);
   }
   if (digits_after_point == 0) {
-    if ((flags_ & EMIT_TRAILING_DECIMAL_POINT) != 0) {
+    if ((format.flags() & EMIT_TRAILING_DECIMAL_POINT) != 0) {
       result_builder->AddCharacter('.');
     }
-    if ((flags_ & EMIT_TRAILING_ZERO_AFTER_POINT) != 0) {
+    if ((format.flags() & EMIT_TRAILING_ZERO_AFTER_POINT) != 0) {
       result_builder->AddCharacter('0');
     }
   }
 }
 
 
+template <class Format>
 bool DoubleToStringConverter::ToShortestIeeeNumber(
+    const Format& format,
     double value,
-    StringBuilder* result_builder,
-    DoubleToStringConverter::DtoaMode mode) const {
+    PreparedNumber* prepared,
+    DoubleToStringConverter::DtoaMode mode) {
   ASSERT(mode == SHORTEST || mode == SHORTEST_SINGLE);
   if (Double(value).IsSpecial()) {
-    return HandleSpecialValues(value, result_builder);
+    return HandleSpecialValues(format, value, prepared);
   }
 
   int decimal_point;
   bool sign;
   const int kDecimalRepCapacity = kBase10MaximalLength + 1;
-  char decimal_rep[kDecimalRepCapacity];
+  ASSERT(kDecimalRepCapacity <= PreparedNumber::kMaxDigits);
+  char* decimal_rep = prepared->digits_;
   int decimal_rep_length;
 
   DoubleToAscii(value, mode, 0, decimal_rep, kDecimalRepCapacity,
                 &sign, &decimal_rep_length, &decimal_point);
 
-  bool unique_zero = (flags_ & UNIQUE_ZERO) != 0;
-  if (sign && (value != 0.0 || !unique_zero)) {
-    result_builder->AddCharacter('-');
-  }
+  bool unique_zero = (format.flags() & UNIQUE_ZERO) != 0;
+  prepared->negative_ = sign && (value != 0.0 || !unique_zero);
+  prepared->digits_length_ = decimal_rep_length;
 
   int exponent = decimal_point - 1;
-  if ((decimal_in_shortest_low_ <= exponent) &&
-      (exponent < decimal_in_shortest_high_)) {
-    CreateDecimalRepresentation(decimal_rep, decimal_rep_length,
-                                decimal_point,
-                                Max(0, decimal_rep_length - decimal_point),
-                                result_builder);
+  if ((format.decimal_in_shortest_low() <= exponent) &&
+      (exponent < format.decimal_in_shortest_high())) {
+    prepared->layout_ = PreparedNumber::DECIMAL;
+    prepared->decimal_point_ = decimal_point;
+    prepared->digits_after_point_ = Max(0, decimal_rep_length - decimal_point);
   } else {
-    CreateExponentialRepresentation(decimal_rep, decimal_rep_length, exponent,
-                                    result_builder);
+    prepared->layout_ = PreparedNumber::EXPONENTIAL;
+    prepared->exponent_ = exponent;
   }
   return true;
 }
 
 
-bool DoubleToStringConverter::ToFixed(double value,
-                                      int requested_digits,
-                                      StringBuilder* result_builder) const {
+template <class Format>
+bool DoubleToStringConverter::ToFixedWithFormat(
+    const Format& format,
+    double value,
+    int requested_digits,
+    PreparedNumber* prepared) {
   ASSERT(kMaxFixedDigitsBeforePoint == 60);
   const double kFirstNonFixed = 1e60;
 
   if (Double(value).IsSpecial()) {
-    return HandleSpecialValues(value, result_builder);
+    return HandleSpecialValues(format, value, prepared);
   }
 
   if (requested_digits > kMaxFixedDigitsAfterPoint) return false;
@@ -215,29 +275,32 @@ bool DoubleToStringConverter::ToFixed(double value,
   // Add space for the '\0' byte.
   const int kDecimalRepCapacity =
       kMaxFixedDigitsBeforePoint + kMaxFixedDigitsAfterPoint + 1;
-  char decimal_rep[kDecimalRepCapacity];
+  ASSERT(kDecimalRepCapacity <= PreparedNumber::kMaxDigits);
+  char* decimal_rep = prepared->digits_;
   int decimal_rep_length;
   DoubleToAscii(value, FIXED, requested_digits,
                 decimal_rep, kDecimalRepCapacity,
                 &sign, &decimal_rep_length, &decimal_point);
 
-  bool unique_zero = ((flags_ & UNIQUE_ZERO) != 0);
-  if (sign && (value != 0.0 || !unique_zero)) {
-    result_builder->AddCharacter('-');
-  }
+  bool unique_zero = ((format.flags() & UNIQUE_ZERO) != 0);
+  prepared->negative_ = sign && (value != 0.0 || !unique_zero);
 
-  CreateDecimalRepresentation(decimal_rep, decimal_rep_length, decimal_point,
-                              requested_digits, result_builder);
+  prepared->layout_ = PreparedNumber::DECIMAL;
+  prepared->digits_length_ = decimal_rep_length;
+  prepared->decimal_point_ = decimal_point;
+  prepared->digits_after_point_ = requested_digits;
   return true;
 }
 
 
-bool DoubleToStringConverter::ToExponential(
+template <class Format>
+bool DoubleToStringConverter::ToExponentialWithFormat(
+    const Format& format,
     double value,
     int requested_digits,
-    StringBuilder* result_builder) const {
+    PreparedNumber* prepared) {
   if (Double(value).IsSpecial()) {
-    return HandleSpecialValues(value, result_builder);
+    return HandleSpecialValues(format, value, prepared);
   }
 
   if (requested_digits < -1) return false;
@@ -248,7 +311,8 @@ bool DoubleToStringConverter::ToExponential(
   // Add space for digit before the decimal point and the '\0' character.
   const int kDecimalRepCapacity = kMaxExponentialDigits + 2;
   ASSERT(kDecimalRepCapacity > kBase10MaximalLength);
-  char decimal_rep[kDecimalRepCapacity];
+  ASSERT(kDecimalRepCapacity <= PreparedNumber::kMaxDigits);
+  char* decimal_rep = prepared->digits_;
   int decimal_rep_length;
 
   if (requested_digits == -1) {
@@ -267,25 +331,24 @@ bool DoubleToStringConverter::ToExponential(
     decimal_rep_length = requested_digits + 1;
   }
 
-  bool unique_zero = ((flags_ & UNIQUE_ZERO) != 0);
-  if (sign && (value != 0.0 || !unique_zero)) {
-    result_builder->AddCharacter('-');
-  }
+  bool unique_zero = ((format.flags() & UNIQUE_ZERO) != 0);
+  prepared->negative_ = sign && (value != 0.0 || !unique_zero);
 
-  int exponent = decimal_point - 1;
-  CreateExponentialRepresentation(decimal_rep,
-                                  decimal_rep_length,
-                                  exponent,
-                                  result_builder);
+  prepared->layout_ = PreparedNumber::EXPONENTIAL;
+  prepared->digits_length_ = decimal_rep_length;
+  prepared->exponent_ = decimal_point - 1;
   return true;
 }
 
 
-bool DoubleToStringConverter::ToPrecision(double value,
-                                          int precision,
-                                          StringBuilder* result_builder) const {
+template <class Format>
+bool DoubleToStringConverter::ToPrecisionWithFormat(
+    const Format& format,
+    double value,
+    int precision,
+    PreparedNumber* prepared) {
   if (Double(value).IsSpecial()) {
-    return HandleSpecialValues(value, result_builder);
+    return HandleSpecialValues(format, value, prepared);
   }
 
   if (precision < kMinPrecisionDigits || precision > kMaxPrecisionDigits) {
@@ -297,7 +360,8 @@ bool DoubleToStringConverter::ToPrecision(double value,
   bool sign;
   // Add one for the terminating null character.
   const int kDecimalRepCapacity = kMaxPrecisionDigits + 1;
-  char decimal_rep[kDecimalRepCapacity];
+  ASSERT(kDecimalRepCapacity <= PreparedNumber::kMaxDigits);
+  char* decimal_rep = prepared->digits_;
   int decimal_rep_length;
 
   DoubleToAscii(value, PRECISION, precision,
@@ -305,19 +369,19 @@ bool DoubleToStringConverter::ToPrecision(double value,
                 &sign, &decimal_rep_length, &decimal_point);
   ASSERT(decimal_rep_length <= precision);
 
-  bool unique_zero = ((flags_ & UNIQUE_ZERO) != 0);
-  if (sign && (value != 0.0 || !unique_zero)) {
-    result_builder->AddCharacter('-');
-  }
+  bool unique_zero = ((format.flags() & UNIQUE_ZERO) != 0);
+  prepared->negative_ = sign && (value != 0.0 || !unique_zero);
 
   // The exponent if we print the number as x.xxeyyy. That is with the
   // decimal point after the first digit.
   int exponent = decimal_point - 1;
 
-  int extra_zero = ((flags_ & EMIT_TRAILING_ZERO_AFTER_POINT) != 0) ? 1 : 0;
-  if ((-decimal_point + 1 > max_leading_padding_zeroes_in_precision_mode_) ||
+  int extra_zero =
+      ((format.flags() & EMIT_TRAILING_ZERO_AFTER_POINT) != 0) ? 1 : 0;
+  if ((-decimal_point + 1 >
+       format.max_leading_padding_zeroes_in_precision_mode()) ||
       (decimal_point - precision + extra_zero >
-       max_trailing_padding_zeroes_in_precision_mode_)) {
+       format.max_trailing_padding_zeroes_in_precision_mode())) {
     // Fill buffer to contain 'precision' digits.
     // Usually the buffer is already at the correct length, but 'DoubleToAscii'
     // is allowed to return less characters.
@@ -325,19 +389,376 @@ bool DoubleToStringConverter::ToPrecision(double value,
       decimal_rep[i] = '0';
     }
 
-    CreateExponentialRepresentation(decimal_rep,
-                                    precision,
-                                    exponent,
-                                    result_builder);
+    prepared->layout_ = PreparedNumber::EXPONENTIAL;
+    prepared->digits_length_ = precision;
+    prepared->exponent_ = exponent;
   } else {
-    CreateDecimalRepresentation(decimal_rep, decimal_rep_length, decimal_point,
-                                Max(0, precision - decimal_point),
-                                result_builder);
+    prepared->layout_ = PreparedNumber::DECIMAL;
+    prepared->digits_length_ = decimal_rep_length;
+    prepared->decimal_point_ = decimal_point;
+    prepared->digits_after_point_ = Max(0, precision - decimal_point);
+  }
+  return true;
+}
+
+
+// Mirrors CreateDecimalRepresentation and CreateExponentialRepresentation.
+template <class Format>
+void DoubleToStringConverter::ComputeFormattedLength(
+    const Format& format,
+    PreparedNumber* prepared) {
+  int length = prepared->negative_ ? 1 : 0;
+  switch (prepared->layout_) {
+    case PreparedNumber::SPECIAL:
+      length += StrLength(prepared->symbol_);
+      break;
+    case PreparedNumber::DECIMAL:
+      // "0" or the digits before the point, padded with zeros.
+      length += Max(1, prepared->decimal_point_);
+      if (prepared->digits_after_point_ > 0) {
+        length += 1 + prepared->digits_after_point_;
+      } else {
+        if ((format.flags() & EMIT_TRAILING_DECIMAL_POINT) != 0) length++;
+        if ((format.flags() & EMIT_TRAILING_ZERO_AFTER_POINT) != 0) length++;
+      }
+      break;
+    case PreparedNumber::EXPONENTIAL: {
+      length += prepared->digits_length_;
+      if (prepared->digits_length_ != 1) length++;  // The decimal point.
+      length++;  // The exponent character.
+      int exponent = prepared->exponent_;
+      if (exponent < 0) {
+        length++;
+        exponent = -exponent;
+      } else if ((format.flags() & EMIT_POSITIVE_EXPONENT_SIGN) != 0) {
+        length++;
+      }
+      do {
+        length++;
+        exponent /= 10;
+      } while (exponent > 0);
+      break;
+    }
+    default:
+      UNREACHABLE();
+  }
+  prepared->length_ = length;
+}
+
+
+template <class Format, class Builder>
+void DoubleToStringConverter::EmitWithFormat(
+    const Format& format,
+    const PreparedNumber& prepared,
+    Builder* result_builder) {
+  if (prepared.negative_) {
+    result_builder->AddCharacter('-');
+  }
+  switch (prepared.layout_) {
+    case PreparedNumber::SPECIAL:
+      result_builder->AddString(prepared.symbol_);
+      break;
+    case PreparedNumber::DECIMAL:
+      CreateDecimalRepresentation(format, prepared.digits_,
+                                  prepared.digits_length_,
+                                  prepared.decimal_point_,
+                                  prepared.digits_after_point_,
+                                  result_builder);
+      break;
+    case PreparedNumber::EXPONENTIAL:
+      CreateExponentialRepresentation(format, prepared.digits_,
+                                      prepared.digits_length_,
+                                      prepared.exponent_,
+                                      result_builder);
+      break;
+    default:
+      UNREACHABLE();
+  }
+}
+
+
+template <class Format>
+void DoubleToStringConverter::EmitToSlot(const Format& format,
+                                         const PreparedNumber& prepared,
+                                         char* buffer) {
+  SlotWriter writer(buffer, prepared.length_);
+  EmitWithFormat(format, prepared, &writer);
+  ASSERT(writer.position() == prepared.length_);
+}
+
+
+bool DoubleToStringConverter::ToShortest(double value,
+                                         StringBuilder* result_builder) const {
+  PreparedNumber prepared;
+  if (!ToShortestIeeeNumber(*this, value, &prepared, SHORTEST)) return false;
+  EmitWithFormat(*this, prepared, result_builder);
+  return true;
+}
+
+
+bool DoubleToStringConverter::ToShortestSingle(
+    float value,
+    StringBuilder* result_builder) const {
+  PreparedNumber prepared;
+  if (!ToShortestIeeeNumber(*this, value, &prepared, SHORTEST_SINGLE)) {
+    return false;
+  }
+  EmitWithFormat(*this, prepared, result_builder);
+  return true;
+}
+
+
+bool DoubleToStringConverter::ToFixed(double value,
+                                      int requested_digits,
+                                      StringBuilder* result_builder) const {
+  PreparedNumber prepared;
+  if (!ToFixedWithFormat(*this, value, requested_digits, &prepared)) {
+    return false;
+  }
+  EmitWithFormat(*this, prepared, result_builder);
+  return true;
+}
+
+
+bool DoubleToStringConverter::ToExponential(
+    double value,
+    int requested_digits,
+    StringBuilder* result_builder) const {
+  PreparedNumber prepared;
+  if (!ToExponentialWithFormat(*this, value, requested_digits, &prepared)) {
+    return false;
+  }
+  EmitWithFormat(*this, prepared, result_builder);
+  return true;
+}
+
+
+bool DoubleToStringConverter::ToPrecision(double value,
+                                          int precision,
+                                          StringBuilder* result_builder) const {
+  PreparedNumber prepared;
+  if (!ToPrecisionWithFormat(*this, value, precision, &prepared)) {
+    return false;
+  }
+  EmitWithFormat(*this, prepared, result_builder);
+  return true;
+}
+
+
+bool DoubleToStringConverter::PrepareShortest(double value,
+                                              PreparedNumber* prepared) const {
+  if (!ToShortestIeeeNumber(*this, value, prepared, SHORTEST)) return false;
+  ComputeFormattedLength(*this, prepared);
+  return true;
+}
+
+
+bool DoubleToStringConverter::PrepareShortestSingle(
+    float value,
+    PreparedNumber* prepared) const {
+  if (!ToShortestIeeeNumber(*this, value, prepared, SHORTEST_SINGLE)) {
+    return false;
+  }
+  ComputeFormattedLength(*this, prepared);
+  return true;
+}
+
+
+bool DoubleToStringConverter::PrepareFixed(double value,
+                                           int requested_digits,
+                                           PreparedNumber* prepared) const {
+  if (!ToFixedWithFormat(*this, value, requested_digits, prepared)) {
+    return false;
+  }
+  ComputeFormattedLength(*this, prepared);
+  return true;
+}
+
+
+bool DoubleToStringConverter::PrepareExponential(
+    double value,
+    int requested_digits,
+    PreparedNumber* prepared) const {
+  if (!ToExponentialWithFormat(*this, value, requested_digits, prepared)) {
+    return false;
+  }
+  ComputeFormattedLength(*this, prepared);
+  return true;
+}
+
+
+bool DoubleToStringConverter::PreparePrecision(double value,
+                                               int precision,
+                                               PreparedNumber* prepared) const {
+  if (!ToPrecisionWithFormat(*this, value, precision, prepared)) {
+    return false;
+  }
+  ComputeFormattedLength(*this, prepared);
+  return true;
+}
+
+
+void DoubleToStringConverter::Emit(const PreparedNumber& prepared,
+                                   char* buffer) const {
+  EmitToSlot(*this, prepared, buffer);
+}
+
+
+template <class Format>
+bool StaticDoubleToStringConverter<Format>::ToShortest(
+    double value,
+    StringBuilder* result_builder) {
+  DoubleToStringConverter::PreparedNumber prepared;
+  if (!DoubleToStringConverter::ToShortestIeeeNumber(
+          Format(), value, &prepared, DoubleToStringConverter::SHORTEST)) {
+    return false;
+  }
+  DoubleToStringConverter::EmitWithFormat(Format(), prepared, result_builder);
+  return true;
+}
+
+
+template <class Format>
+bool StaticDoubleToStringConverter<Format>::ToShortestSingle(
+    float value,
+    StringBuilder* result_builder) {
+  DoubleToStringConverter::PreparedNumber prepared;
+  if (!DoubleToStringConverter::ToShortestIeeeNumber(
+          Format(), value, &prepared,
+          DoubleToStringConverter::SHORTEST_SINGLE)) {
+    return false;
+  }
+  DoubleToStringConverter::EmitWithFormat(Format(), prepared, result_builder);
+  return true;
+}
+
+
+template <class Format>
+bool StaticDoubleToStringConverter<Format>::ToFixed(
+    double value,
+    int requested_digits,
+    StringBuilder* result_builder) {
+  DoubleToStringConverter::PreparedNumber prepared;
+  if (!DoubleToStringConverter::ToFixedWithFormat(
+          Format(), value, requested_digits, &prepared)) {
+    return false;
+  }
+  DoubleToStringConverter::EmitWithFormat(Format(), prepared, result_builder);
+  return true;
+}
+
+
+template <class Format>
+bool StaticDoubleToStringConverter<Format>::ToExponential(
+    double value,
+    int requested_digits,
+    StringBuilder* result_builder) {
+  DoubleToStringConverter::PreparedNumber prepared;
+  if (!DoubleToStringConverter::ToExponentialWithFormat(
+          Format(), value, requested_digits, &prepared)) {
+    return false;
+  }
+  DoubleToStringConverter::EmitWithFormat(Format(), prepared, result_builder);
+  return true;
+}
+
+
+template <class Format>
+bool StaticDoubleToStringConverter<Format>::ToPrecision(
+    double value,
+    int precision,
+    StringBuilder* result_builder) {
+  DoubleToStringConverter::PreparedNumber prepared;
+  if (!DoubleToStringConverter::ToPrecisionWithFormat(
+          Format(), value, precision, &prepared)) {
+    return false;
+  }
+  DoubleToStringConverter::EmitWithFormat(Format(), prepared, result_builder);
+  return true;
+}
+
+
+template <class Format>
+bool StaticDoubleToStringConverter<Format>::PrepareShortest(
+    double value,
+    DoubleToStringConverter::PreparedNumber* prepared) {
+  if (!DoubleToStringConverter::ToShortestIeeeNumber(
+          Format(), value, prepared, DoubleToStringConverter::SHORTEST)) {
+    return false;
+  }
+  DoubleToStringConverter::ComputeFormattedLength(Format(), prepared);
+  return true;
+}
+
+
+template <class Format>
+bool StaticDoubleToStringConverter<Format>::PrepareShortestSingle(
+    float value,
+    DoubleToStringConverter::PreparedNumber* prepared) {
+  if (!DoubleToStringConverter::ToShortestIeeeNumber(
+          Format(), value, prepared,
+          DoubleToStringConverter::SHORTEST_SINGLE)) {
+    return false;
   }
+  DoubleToStringConverter::ComputeFormattedLength(Format(), prepared);
   return true;
 }
 
 
+template <class Format>
+bool StaticDoubleToStringConverter<Format>::PrepareFixed(
+    double value,
+    int requested_digits,
+    DoubleToStringConverter::PreparedNumber* prepared) {
+  if (!DoubleToStringConverter::ToFixedWithFormat(
+          Format(), value, requested_digits, prepared)) {
+    return false;
+  }
+  DoubleToStringConverter::ComputeFormattedLength(Format(), prepared);
+  return true;
+}
+
+
+template <class Format>
+bool StaticDoubleToStringConverter<Format>::PrepareExponential(
+    double value,
+    int requested_digits,
+    DoubleToStringConverter::PreparedNumber* prepared) {
+  if (!DoubleToStringConverter::ToExponentialWithFormat(
+          Format(), value, requested_digits, prepared)) {
+    return false;
+  }
+  DoubleToStringConverter::ComputeFormattedLength(Format(), prepared);
+  return true;
+}
+
+
+template <class Format>
+bool StaticDoubleToStringConverter<Format>::PreparePrecision(
+    double value,
+    int precision,
+    DoubleToStringConverter::PreparedNumber* prepared) {
+  if (!DoubleToStringConverter::ToPrecisionWithFormat(
+          Format(), value, precision, prepared)) {
+    return false;
+  }
+  DoubleToStringConverter::ComputeFormattedLength(Format(), prepared);
+  return true;
+}
+
+
+template <class Format>
+void StaticDoubleToStringConverter<Format>::Emit(
+    const DoubleToStringConverter::PreparedNumber& prepared,
+    char* buffer) {
+  DoubleToStringConverter::EmitToSlot(Format(), prepared, buffer);
+}
+
+
+template class StaticDoubleToStringConverter<EcmaScriptFormat>;
+template class StaticDoubleToStringConverter<JsonFormat>;
+
+
 static BignumDtoaMode DtoaToBignumDtoaMode(
     DoubleToStringConverter::DtoaMode dtoa_mode) {
   switch (dtoa_mode) {
@@ -510,6 +931,91 @@ static bool IsCharacterDigitForRadix(int c, int radix, char a_character) {
 }
 
 
+// Number of characters CopyDigitBlocks checks at once. Runs that are not
+// longer than one block are cheaper to copy one character at a time.
+static const int kDigitBlockSize = 16;
+
+
+// Copies whole blocks of decimal digits at '*current' to 'buffer' and
+// advances '*current' past them. Stops at the first block that contains a
+// non-digit, when fewer than a block of characters remain, or when
+// 'capacity' has no room for another block; the callers finish the run one
+// character at a time. Sets '*non_octal' if one of the copied digits is '8'
+// or '9'. Returns the number of copied digits.
+template <class Iterator>
+static int CopyDigitBlocks(Iterator* /* current */,
+                           Iterator /* end */,
+                           char* /* buffer */,
+                           int /* capacity */,
+                           bool* /* non_octal */) {
+  return 0;
+}
+
+
+#if defined(DOUBLE_CONVERSION_HAS_SSE2)
+// Sources of 16 bit characters are mostly ASCII digits. Sixteen characters are
+// narrowed to bytes and checked at once. Characters outside of the 0..255
+// range saturate to 0 or 255 when narrowed, so they fail the digit check like
+// any other non-digit.
+static int CopyDigitBlocks(const uc16** current,
+                           const uc16* end,
+                           char* buffer,
+                           int capacity,
+                           bool* non_octal) {
+  const __m128i kZeros = _mm_set1_epi8('0');
+  const __m128i kNines = _mm_set1_epi8(9);
+  const __m128i kSevens = _mm_set1_epi8(7);
+  int copied = 0;
+  while (end - *current >= kDigitBlockSize &&
+         capacity - copied >= kDigitBlockSize) {
+    __m128i low = _mm_loadu_si128(reinterpret_cast<const __m128i*>(*current));
+    __m128i high =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(*current + 8));
+    __m128i chars = _mm_packus_epi16(low, high);
+    __m128i values = _mm_sub_epi8(chars, kZeros);
+    int digits = _mm_movemask_epi8(
+        _mm_cmpeq_epi8(_mm_min_epu8(values, kNines), values));
+    if (digits != 0xFFFF) break;
+    int octals = _mm_movemask_epi8(
+        _mm_cmpeq_epi8(_mm_min_epu8(values, kSevens), values));
+    if (octals != 0xFFFF) *non_octal = true;
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(buffer + copied), chars);
+    *current += kDigitBlockSize;
+    copied += kDigitBlockSize;
+  }
+  return copied;
+}
+#endif
+
+
+// Rounds 'number' after its 'overflow_bits_count' least significant bits
+// ('dropped_bits') have been shifted out. 'zero_tail' tells whether all
+// digits following the dropped bits are zero.
+static void RoundDroppedBits(int dropped_bits,
+                             int overflow_bits_count,
+                             bool zero_tail,
+                             int significand_size,
+                             int64_t* number,
+                             int* exponent) {
+  int middle_value = (1 << (overflow_bits_count - 1));
+  if (dropped_bits > middle_value) {
+    (*number)++;  // Rounding up.
+  } else if (dropped_bits == middle_value) {
+    // Rounding to even to consistency with decimals: half-way case rounds
+    // up if significant part is odd and down otherwise.
+    if ((*number & 1) != 0 || !zero_tail) {
+      (*number)++;  // Rounding up.
+    }
+  }
+
+  // Rounding up may cause overflow.
+  if ((*number & ((int64_t)1 << significand_size)) != 0) {
+    (*exponent)++;
+    *number >>= 1;
+  }
+}
+
+
 // Parsing integers with radix 2, 4, 8, 16, 32. Assumes current != end.
 template <int radix_log_2, class Iterator>
 static double RadixStringToIeee(Iterator* current,
@@ -584,22 +1090,8 @@ static double RadixStringToIeee(Iterator* current,
         return junk_string_value;
       }
 
-      int middle_value = (1 << (overflow_bits_count - 1));
-      if (dropped_bits > middle_value) {
-        number++;  // Rounding up.
-      } else if (dropped_bits == middle_value) {
-        // Rounding to even to consistency with decimals: half-way case rounds
-        // up if significant part is odd and down otherwise.
-        if ((number & 1) != 0 || !zero_tail) {
-          number++;  // Rounding up.
-        }
-      }
-
-      // Rounding up may cause overflow.
-      if ((number & ((int64_t)1 << kSignificandSize)) != 0) {
-        exponent++;
-        number >>= 1;
-      }
+      RoundDroppedBits(dropped_bits, overflow_bits_count, zero_tail,
+                       kSignificandSize, &number, &exponent);
       break;
     }
     ++(*current);
@@ -769,6 +1261,16 @@ double StringToDoubleConverter::StringToIeee(
   bool octal = leading_zero && (flags_ & ALLOW_OCTALS) != 0;
 
   // Copy significant digits of the integer part (if any) to the buffer.
+  if (end - current > kDigitBlockSize) {
+    bool non_octal = false;
+    int copied = CopyDigitBlocks(&current, end, buffer + buffer_pos,
+                                 kMaxSignificantDigits - significant_digits,
+                                 &non_octal);
+    buffer_pos += copied;
+    significant_digits += copied;
+    octal = octal && !non_octal;
+    if (current == end) goto parsing_done;
+  }
   while (*current >= '0' && *current <= '9') {
     if (significant_digits < kMaxSignificantDigits) {
       ASSERT(buffer_pos < kBufferSize);
@@ -817,6 +1319,16 @@ double StringToDoubleConverter::StringToIeee(
 
     // There is a fractional part.
     // We don't emit a '.', but adjust the exponent instead.
+    if (end - current > kDigitBlockSize) {
+      bool non_octal = false;
+      int copied = CopyDigitBlocks(&current, end, buffer + buffer_pos,
+                                   kMaxSignificantDigits - significant_digits,
+                                   &non_octal);
+      buffer_pos += copied;
+      significant_digits += copied;
+      exponent -= copied;
+      if (current == end) goto parsing_done;
+    }
     while (*current >= '0' && *current <= '9') {
       if (significant_digits < kMaxSignificantDigits) {
         ASSERT(buffer_pos < kBufferSize);
@@ -972,4 +1484,507 @@ float StringToDoubleConverter::StringToFloat(
                                          processed_characters_count));
 }
 
+
+StringToDoubleStream::StringToDoubleStream(
+    const StringToDoubleConverter& converter,
+    char delimiter)
+    : converter_(converter),
+      delimiter_(delimiter) {
+  ASSERT(kMaxSignificantDigits == double_conversion::kMaxSignificantDigits);
+  Reset();
+}
+
+
+void StringToDoubleStream::Reset() {
+  state_ = kStart;
+  kind_ = kDecimal;
+  sign_ = false;
+  leading_zero_ = false;
+  octal_ = false;
+  symbol_ = NULL;
+  symbol_position_ = 0;
+  significant_digits_ = 0;
+  insignificant_digits_ = 0;
+  nonzero_digit_dropped_ = false;
+  exponent_ = 0;
+  exponent_negative_ = false;
+  exponent_value_ = 0;
+  number_ = 0;
+  dropped_bits_ = 0;
+  overflow_bits_count_ = 0;
+  zero_tail_ = true;
+}
+
+
+int StringToDoubleStream::Feed(const char* buffer,
+                               int length,
+                               double* values,
+                               int values_size,
+                               int* values_count) {
+  return FeedCharacters(buffer, length, values, values_size, values_count);
+}
+
+
+int StringToDoubleStream::Feed(const uc16* buffer,
+                               int length,
+                               double* values,
+                               int values_size,
+                               int* values_count) {
+  return FeedCharacters(buffer, length, values, values_size, values_count);
+}
+
+
+bool StringToDoubleStream::Finish(double* value) {
+  bool pending = (state_ != kStart);
+  if (pending) *value = Value();
+  Reset();
+  return pending;
+}
+
+
+template <class Char>
+int StringToDoubleStream::FeedCharacters(const Char* buffer,
+                                         int length,
+                                         double* values,
+                                         int values_size,
+                                         int* values_count) {
+  int position = 0;
+  int count = 0;
+  while (position < length && count < values_size) {
+    int c = buffer[position++];
+    if (c == delimiter_) {
+      values[count++] = Value();
+      Reset();
+    } else {
+      Advance(c);
+    }
+  }
+  *values_count = count;
+  return position;
+}
+
+
+// The states mirror the control flow of StringToDoubleConverter::StringToIeee.
+// Every state has to answer two questions: what happens with the next
+// character (Advance), and what the number is if the input ends here (Value).
+void StringToDoubleStream::Advance(int c) {
+  const int flags = converter_.flags_;
+  const bool allow_trailing_junk =
+      (flags & StringToDoubleConverter::ALLOW_TRAILING_JUNK) != 0;
+
+  switch (state_) {
+    case kStart:
+      if ((flags & (StringToDoubleConverter::ALLOW_LEADING_SPACES |
+                    StringToDoubleConverter::ALLOW_TRAILING_SPACES)) != 0 &&
+          isWhitespace(c)) {
+        state_ = kLeadingSpaces;
+      } else {
+        AdvanceFromSign(c);
+      }
+      break;
+
+    case kLeadingSpaces:
+      if (isWhitespace(c)) break;
+      if ((flags & StringToDoubleConverter::ALLOW_LEADING_SPACES) == 0) {
+        state_ = kJunk;
+      } else {
+        AdvanceFromSign(c);
+      }
+      break;
+
+    case kSign:
+      if (isWhitespace(c)) {
+        if ((flags & StringToDoubleConverter::ALLOW_SPACES_AFTER_SIGN) == 0) {
+          state_ = kJunk;
+        }
+      } else {
+        AdvanceFromBody(c);
+      }
+      break;
+
+    case kSymbol:
+      if (c != symbol_[symbol_position_]) {
+        state_ = kJunk;
+      } else if (symbol_[++symbol_position_] == '\0') {
+        state_ = TrailingState();
+      }
+      break;
+
+    case kFirstZero:
+      if ((flags & StringToDoubleConverter::ALLOW_HEX) != 0 &&
+          (c == 'x' || c == 'X')) {
+        kind_ = kHex;
+        state_ = kHexPrefix;
+        break;
+      }
+      state_ = kLeadingZeros;
+      Advance(c);
+      break;
+
+    case kLeadingZeros:
+      if (c == '0') break;
+      octal_ = (flags & StringToDoubleConverter::ALLOW_OCTALS) != 0;
+      AdvanceFromInteger(c);
+      break;
+
+    case kInteger:
+      AdvanceFromInteger(c);
+      break;
+
+    case kPoint:
+      state_ = (significant_digits_ == 0) ? kFractionZeros : kFraction;
+      Advance(c);
+      break;
+
+    case kFractionZeros:
+      if (c == '0') {
+        exponent_--;  // Move this 0 into the exponent.
+        break;
+      }
+      state_ = kFraction;
+      Advance(c);
+      break;
+
+    case kFraction:
+      if (c >= '0' && c <= '9') {
+        if (significant_digits_ < kMaxSignificantDigits) {
+          buffer_[significant_digits_++] = static_cast<char>(c);
+          exponent_--;
+        } else {
+          nonzero_digit_dropped_ = nonzero_digit_dropped_ || c != '0';
+        }
+      } else {
+        AdvanceFromFraction(c);
+      }
+      break;
+
+    case kExponent:
+      if (c == '+' || c == '-') {
+        exponent_negative_ = (c == '-');
+        state_ = kExponentSign;
+        break;
+      }
+      state_ = kExponentSign;
+      Advance(c);
+      break;
+
+    case kExponentSign:
+      if (c < '0' || c > '9') {
+        state_ = allow_trailing_junk ? kTrailingJunk : kJunk;
+        break;
+      }
+      state_ = kExponentDigits;
+      Advance(c);
+      break;
+
+    case kExponentDigits:
+      if (c >= '0' && c <= '9') {
+        const int max_exponent = INT_MAX / 2;
+        int digit = c - '0';
+        if (exponent_value_ >= max_exponent / 10
+            && !(exponent_value_ == max_exponent / 10 &&
+                 digit <= max_exponent % 10)) {
+          exponent_value_ = max_exponent;
+        } else {
+          exponent_value_ = exponent_value_ * 10 + digit;
+        }
+      } else {
+        exponent_ += exponent_negative_ ? -exponent_value_ : exponent_value_;
+        exponent_value_ = 0;
+        AdvanceToTrailing(c);
+      }
+      break;
+
+    case kHexPrefix:
+      if (!isDigit(c, 16)) {
+        state_ = kJunk;
+        break;
+      }
+      state_ = kHexZeros;
+      Advance(c);
+      break;
+
+    case kHexZeros:
+      if (c == '0') break;
+      state_ = kHexDigits;
+      AdvanceHexDigit(c);
+      break;
+
+    case kHexDigits:
+      AdvanceHexDigit(c);
+      break;
+
+    case kHexTail:
+      if (isDigit(c, 16)) {
+        zero_tail_ = zero_tail_ && c == '0';
+        exponent_ += 4;
+        break;
+      }
+      // Only spaces may follow a hex number, unless junk is allowed.
+      state_ = allow_trailing_junk ? kTrailingJunk : kTrailingSpaces;
+      Advance(c);
+      break;
+
+    case kTrailingSpaces:
+      if (!isWhitespace(c)) state_ = kJunk;
+      break;
+
+    case kEnd:
+      state_ = kJunk;
+      break;
+
+    case kTrailingJunk:
+    case kJunk:
+      break;
+  }
+}
+
+
+void StringToDoubleStream::AdvanceFromSign(int c) {
+  if (c == '+' || c == '-') {
+    sign_ = (c == '-');
+    state_ = kSign;
+  } else {
+    AdvanceFromBody(c);
+  }
+}
+
+
+void StringToDoubleStream::AdvanceFromBody(int c) {
+  const char* infinity_symbol = converter_.infinity_symbol_;
+  const char* nan_symbol = converter_.nan_symbol_;
+  if (infinity_symbol != NULL && c == infinity_symbol[0]) {
+    symbol_ = infinity_symbol;
+  } else if (nan_symbol != NULL && c == nan_symbol[0]) {
+    symbol_ = nan_symbol;
+  }
+  if (symbol_ != NULL) {
+    kind_ = kSpecial;
+    symbol_position_ = 1;
+    state_ = (symbol_[1] == '\0') ? TrailingState() : kSymbol;
+    return;
+  }
+
+  if (c == '0') {
+    leading_zero_ = true;
+    state_ = kFirstZero;
+    return;
+  }
+  AdvanceFromInteger(c);
+}
+
+
+void StringToDoubleStream::AdvanceFromInteger(int c) {
+  if (c >= '0' && c <= '9') {
+    if (significant_digits_ < kMaxSignificantDigits) {
+      buffer_[significant_digits_++] = static_cast<char>(c);
+    } else {
+      insignificant_digits_++;  // Move the digit into the exponential part.
+      nonzero_digit_dropped_ = nonzero_digit_dropped_ || c != '0';
+    }
+    octal_ = octal_ && c < '8';
+    state_ = kInteger;
+    return;
+  }
+
+  if (significant_digits_ == 0) {
+    octal_ = false;
+  }
+
+  if (c == '.') {
+    if (octal_) {
+      // Octal numbers may only be integers.
+      state_ = ((converter_.flags_ &
+                 StringToDoubleConverter::ALLOW_TRAILING_JUNK) != 0)
+          ? kTrailingJunk : kJunk;
+    } else {
+      state_ = kPoint;
+    }
+    return;
+  }
+  AdvanceFromFraction(c);
+}
+
+
+void StringToDoubleStream::AdvanceFromFraction(int c) {
+  if (!leading_zero_ && exponent_ == 0 && significant_digits_ == 0) {
+    // There are no digits in the number.
+    state_ = kJunk;
+    return;
+  }
+
+  if (c == 'e' || c == 'E') {
+    if (octal_) {
+      state_ = ((converter_.flags_ &
+                 StringToDoubleConverter::ALLOW_TRAILING_JUNK) != 0)
+          ? kTrailingJunk : kJunk;
+    } else {
+      state_ = kExponent;
+    }
+    return;
+  }
+  AdvanceToTrailing(c);
+}
+
+
+void StringToDoubleStream::AdvanceToTrailing(int c) {
+  state_ = TrailingState();
+  Advance(c);
+}
+
+
+void StringToDoubleStream::AdvanceHexDigit(int c) {
+  int digit;
+  if (IsDecimalDigitForRadix(c, 16)) {
+    digit = c - '0';
+  } else if (IsCharacterDigitForRadix(c, 16, 'a')) {
+    digit = c - 'a' + 10;
+  } else if (IsCharacterDigitForRadix(c, 16, 'A')) {
+    digit = c - 'A' + 10;
+  } else {
+    // Only spaces may follow a hex number, unless junk is allowed.
+    state_ = ((converter_.flags_ &
+               StringToDoubleConverter::ALLOW_TRAILING_JUNK) != 0)
+        ? kTrailingJunk : kTrailingSpaces;
+    Advance(c);
+    return;
+  }
+
+  number_ = number_ * 16 + digit;
+  int overflow = static_cast<int>(number_ >> Double::kSignificandSize);
+  if (overflow != 0) {
+    // Drop the overflowing bits. The remaining digits only decide the
+    // rounding direction, see RadixStringToIeee.
+    overflow_bits_count_ = 1;
+    while (overflow > 1) {
+      overflow_bits_count_++;
+      overflow >>= 1;
+    }
+    int dropped_bits_mask = ((1 << overflow_bits_count_) - 1);
+    dropped_bits_ = static_cast<int>(number_) & dropped_bits_mask;
+    number_ >>= overflow_bits_count_;
+    exponent_ = overflow_bits_count_;
+    zero_tail_ = true;
+    state_ = kHexTail;
+  }
+}
+
+
+StringToDoubleStream::State StringToDoubleStream::TrailingState() const {
+  const int flags = converter_.flags_;
+  if ((flags & StringToDoubleConverter::ALLOW_TRAILING_JUNK) != 0) {
+    return kTrailingJunk;
+  }
+  if ((flags & StringToDoubleConverter::ALLOW_TRAILING_SPACES) != 0) {
+    return kTrailingSpaces;
+  }
+  return kEnd;
+}
+
+
+double StringToDoubleStream::Value() {
+  const bool allow_trailing_junk =
+      (converter_.flags_ & StringToDoubleConverter::ALLOW_TRAILING_JUNK) != 0;
+
+  switch (state_) {
+    case kStart:
+    case kLeadingSpaces:
+      return converter_.empty_string_value_;
+
+    case kSign:
+    case kSymbol:
+    case kHexPrefix:
+    case kJunk:
+      return converter_.junk_string_value_;
+
+    case kFirstZero:
+    case kLeadingZeros:
+    case kFractionZeros:
+    case kHexZeros:
+      return SignedZero(sign_);
+
+    case kPoint:
+      if (significant_digits_ == 0 && !leading_zero_) {
+        return converter_.junk_string_value_;
+      }
+      break;
+
+    case kExponent:
+    case kExponentSign:
+      if (!allow_trailing_junk) return converter_.junk_string_value_;
+      break;
+
+    default:
+      break;
+  }
+
+  switch (kind_) {
+    case kSpecial:
+      if (symbol_ == converter_.infinity_symbol_) {
+        return sign_ ? -Double::Infinity() : Double::Infinity();
+      }
+      return sign_ ? -Double::NaN() : Double::NaN();
+    case kHex:
+      return HexValue();
+    default:
+      return DecimalValue();
+  }
+}
+
+
+double StringToDoubleStream::DecimalValue() {
+  int exponent = exponent_ + insignificant_digits_;
+  if (state_ == kExponentDigits) {
+    exponent += exponent_negative_ ? -exponent_value_ : exponent_value_;
+  }
+
+  if (octal_) {
+    double result;
+    bool result_is_junk;
+    char* start = buffer_;
+    result = RadixStringToIeee<3>(&start,
+                                  buffer_ + significant_digits_,
+                                  sign_,
+                                  false,
+                                  converter_.junk_string_value_,
+                                  true,
+                                  &result_is_junk);
+    ASSERT(!result_is_junk);
+    return result;
+  }
+
+  int buffer_pos = significant_digits_;
+  if (nonzero_digit_dropped_) {
+    buffer_[buffer_pos++] = '1';
+    exponent--;
+  }
+
+  ASSERT(buffer_pos < kBufferSize);
+  buffer_[buffer_pos] = '\0';
+
+  double converted = Strtod(Vector<const char>(buffer_, buffer_pos), exponent);
+  return sign_? -converted: converted;
+}
+
+
+double StringToDoubleStream::HexValue() {
+  int64_t number = number_;
+  int exponent = exponent_;
+  if (overflow_bits_count_ != 0) {
+    RoundDroppedBits(dropped_bits_, overflow_bits_count_, zero_tail_,
+                     Double::kSignificandSize, &number, &exponent);
+  }
+
+  if (exponent == 0) {
+    if (sign_) {
+      if (number == 0) return -0.0;
+      number = -number;
+    }
+    return static_cast<double>(number);
+  }
+
+  ASSERT(number != 0);
+  return Double(DiyFp(number, exponent)).value();
+}
+
 }  // namespace double_conversion
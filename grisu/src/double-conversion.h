@@ -154,14 +154,10 @@ class DoubleToStringConverter {
   // Returns true if the conversion succeeds. The conversion always succeeds
   // except when the input value is special and no infinity_symbol or
   // nan_symbol has been given to the constructor.
-  bool ToShortest(double value, StringBuilder* result_builder) const {
-    return ToShortestIeeeNumber(value, result_builder, SHORTEST);
-  }
+  bool ToShortest(double value, StringBuilder* result_builder) const;
 
   // Same as ToShortest, but for single-precision floats.
-  bool ToShortestSingle(float value, StringBuilder* result_builder) const {
-    return ToShortestIeeeNumber(value, result_builder, SHORTEST_SINGLE);
-  }
+  bool ToShortestSingle(float value, StringBuilder* result_builder) const;
 
 
   // Computes a decimal representation with a fixed number of digits after the
@@ -271,6 +267,78 @@ class DoubleToStringConverter {
                    int precision,
                    StringBuilder* result_builder) const;
 
+  // The first phase of a two-phase conversion: the digits of a number and
+  // how they are laid out. The handle is opaque; only the exact length of the
+  // formatted number is exposed.
+  class PreparedNumber {
+   public:
+    PreparedNumber() : length_(0) {}
+
+    // The number of characters Emit writes for this number.
+    int length() const { return length_; }
+
+   private:
+    friend class DoubleToStringConverter;
+
+    enum Layout {
+      SPECIAL,
+      DECIMAL,
+      EXPONENTIAL
+    };
+
+    // The largest digit buffer any of the conversions uses (ToExponential
+    // with the digit before the point and the '\0' character).
+    static const int kMaxDigits = kMaxExponentialDigits + 2;
+
+    Layout layout_;
+    bool negative_;
+    const char* symbol_;
+    char digits_[kMaxDigits];
+    int digits_length_;
+    // DECIMAL: the position of the decimal point and the number of digits
+    // after it. EXPONENTIAL: the exponent.
+    int decimal_point_;
+    int digits_after_point_;
+    int exponent_;
+    int length_;
+  };
+
+  // Two-phase conversion. The Prepare functions compute the digits of
+  // 'value' exactly as the corresponding To* function does and store them in
+  // 'prepared'. prepared->length() is then the exact number of characters of
+  // the result. Emit writes these characters to 'buffer', which must hold
+  // prepared.length() characters, without generating the digits again. Emit
+  // does not append a null character.
+  // This lets callers size their output exactly, for instance to compute the
+  // offsets of many numbers before writing them in parallel.
+  //
+  // The Prepare functions fail in the same cases as the To* functions. A
+  // number must be emitted by the converter that prepared it.
+  //
+  // Example with the EcmaScriptConverter:
+  //   DoubleToStringConverter::PreparedNumber prepared;
+  //   if (converter.PrepareShortest(1.5e-7, &prepared)) {
+  //     char* slot = Allocate(prepared.length());  // 6 characters.
+  //     converter.Emit(prepared, slot);            // "1.5e-7"
+  //   }
+  bool PrepareShortest(double value, PreparedNumber* prepared) const;
+
+  bool PrepareShortestSingle(float value, PreparedNumber* prepared) const;
+
+  bool PrepareFixed(double value,
+                    int requested_digits,
+                    PreparedNumber* prepared) const;
+
+  bool PrepareExponential(double value,
+                          int requested_digits,
+                          PreparedNumber* prepared) const;
+
+  bool PreparePrecision(double value,
+                        int precision,
+                        PreparedNumber* prepared) const;
+
+  void Emit(const PreparedNumber& prepared, char* buffer) const;
+
   enum DtoaMode {
     // Produce the shortest correct representation.
     // For example the output of 0.299999999999999988897 is (the less accurate
@@ -342,28 +410,95 @@ class DoubleToStringConverter {
                             int* point);
 
  private:
-  // Implementation for ToShortest and ToShortestSingle.
-  bool ToShortestIeeeNumber(double value,
-                            StringBuilder* result_builder,
-                            DtoaMode mode) const;
-
-  // If the value is a special value (NaN or Infinity) constructs the
+  template <class Format> friend class StaticDoubleToStringConverter;
+
+  // The formatting code is shared with StaticDoubleToStringConverter. It reads
+  // its configuration from a 'format' that is either a converter instance or a
+  // compile-time format (see EcmaScriptFormat below). With the latter the
+  // configuration tests are resolved at compile time.
+
+  // Implementations of the Prepare functions, also used by the To*
+  // functions. ToShortestIeeeNumber handles ToShortest and ToShortestSingle.
+  template <class Format>
+  static bool ToShortestIeeeNumber(const Format& format,
+                                   double value,
+                                   PreparedNumber* prepared,
+                                   DtoaMode mode);
+
+  template <class Format>
+  static bool ToFixedWithFormat(const Format& format,
+                                double value,
+                                int requested_digits,
+                                PreparedNumber* prepared);
+
+  template <class Format>
+  static bool ToExponentialWithFormat(const Format& format,
+                                      double value,
+                                      int requested_digits,
+                                      PreparedNumber* prepared);
+
+  template <class Format>
+  static bool ToPrecisionWithFormat(const Format& format,
+                                    double value,
+                                    int precision,
+                                    PreparedNumber* prepared);
+
+  // If the value is a special value (NaN or Infinity) prepares the
   // corresponding string using the configured infinity/nan-symbol.
   // If either of them is NULL or the value is not special then the
   // function returns false.
-  bool HandleSpecialValues(double value, StringBuilder* result_builder) const;
+  template <class Format>
+  static bool HandleSpecialValues(const Format& format,
+                                  double value,
+                                  PreparedNumber* prepared);
+
+  // Stores the number of characters EmitWithFormat writes for 'prepared'.
+  template <class Format>
+  static void ComputeFormattedLength(const Format& format,
+                                     PreparedNumber* prepared);
+
+  // Writes the prepared number to a StringBuilder or to an exact slot.
+  template <class Format, class Builder>
+  static void EmitWithFormat(const Format& format,
+                             const PreparedNumber& prepared,
+                             Builder* result_builder);
+
+  // Writes the prepared number to a buffer of prepared.length() characters.
+  template <class Format>
+  static void EmitToSlot(const Format& format,
+                         const PreparedNumber& prepared,
+                         char* buffer);
+
   // Constructs an exponential representation (i.e. 1.234e56).
   // The given exponent assumes a decimal point after the first decimal digit.
-  void CreateExponentialRepresentation(const char* decimal_digits,
-                                       int length,
-                                       int exponent,
-                                       StringBuilder* result_builder) const;
+  template <class Format, class Builder>
+  static void CreateExponentialRepresentation(const Format& format,
+                                              const char* decimal_digits,
+                                              int length,
+                                              int exponent,
+                                              Builder* result_builder);
   // Creates a decimal representation (i.e 1234.5678).
-  void CreateDecimalRepresentation(const char* decimal_digits,
-                                   int length,
-                                   int decimal_point,
-                                   int digits_after_point,
-                                   StringBuilder* result_builder) const;
+  template <class Format, class Builder>
+  static void CreateDecimalRepresentation(const Format& format,
+                                          const char* decimal_digits,
+                                          int length,
+                                          int decimal_point,
+                                          int digits_after_point,
+                                          Builder* result_builder);
+
+  // Accessors with the same names as the ones of the compile-time formats.
+  int flags() const { return flags_; }
+  const char* infinity_symbol() const { return infinity_symbol_; }
+  const char* nan_symbol() const { return nan_symbol_; }
+  char exponent_character() const { return exponent_character_; }
+  int decimal_in_shortest_low() const { return decimal_in_shortest_low_; }
+  int decimal_in_shortest_high() const { return decimal_in_shortest_high_; }
+  int max_leading_padding_zeroes_in_precision_mode() const {
+    return max_leading_padding_zeroes_in_precision_mode_;
+  }
+  int max_trailing_padding_zeroes_in_precision_mode() const {
+    return max_trailing_padding_zeroes_in_precision_mode_;
+  }
 
   const int flags_;
   const char* const infinity_symbol_;
@@ -378,6 +513,106 @@ class DoubleToStringConverter {
 };
 
 
+// Compile-time configurations for StaticDoubleToStringConverter. A format
+// provides the parameters of the DoubleToStringConverter constructor as static
+// functions of the same names.
+
+// The configuration of DoubleToStringConverter::EcmaScriptConverter().
+struct EcmaScriptFormat {
+  static int flags() {
+    return DoubleToStringConverter::UNIQUE_ZERO |
+        DoubleToStringConverter::EMIT_POSITIVE_EXPONENT_SIGN;
+  }
+  static const char* infinity_symbol() { return "Infinity"; }
+  static const char* nan_symbol() { return "NaN"; }
+  static char exponent_character() { return 'e'; }
+  static int decimal_in_shortest_low() { return -6; }
+  static int decimal_in_shortest_high() { return 21; }
+  static int max_leading_padding_zeroes_in_precision_mode() { return 6; }
+  static int max_trailing_padding_zeroes_in_precision_mode() { return 0; }
+};
+
+
+// Same as EcmaScriptFormat, but JSON has no representation for NaN and
+// Infinity: the conversion of special values fails.
+// Ex: ToShortest(1e21) -> "1e+21"
+//     ToShortest(-0.0) -> "0"
+//     ToShortest(NaN)  -> false
+struct JsonFormat {
+  static int flags() { return EcmaScriptFormat::flags(); }
+  static const char* infinity_symbol() { return NULL; }
+  static const char* nan_symbol() { return NULL; }
+  static char exponent_character() { return 'e'; }
+  static int decimal_in_shortest_low() { return -6; }
+  static int decimal_in_shortest_high() { return 21; }
+  static int max_leading_padding_zeroes_in_precision_mode() { return 6; }
+  static int max_trailing_padding_zeroes_in_precision_mode() { return 0; }
+};
+
+
+// A DoubleToStringConverter whose configuration is fixed at compile time.
+// The conversions behave exactly like the ones of a DoubleToStringConverter
+// constructed with the parameters of the 'Format', but the compiler resolves
+// the flag and symbol tests, so the formatting code is reduced to the stores
+// the configuration needs.
+// The conversion functions are instantiated in double-conversion.cc for
+// EcmaScriptFormat and JsonFormat. Add an explicit instantiation there for
+// other formats.
+template <class Format>
+class StaticDoubleToStringConverter {
+ public:
+  // See DoubleToStringConverter::ToShortest.
+  static bool ToShortest(double value, StringBuilder* result_builder);
+
+  // See DoubleToStringConverter::ToShortestSingle.
+  static bool ToShortestSingle(float value, StringBuilder* result_builder);
+
+  // See DoubleToStringConverter::ToFixed.
+  static bool ToFixed(double value,
+                      int requested_digits,
+                      StringBuilder* result_builder);
+
+  // See DoubleToStringConverter::ToExponential.
+  static bool ToExponential(double value,
+                            int requested_digits,
+                            StringBuilder* result_builder);
+
+  // See DoubleToStringConverter::ToPrecision.
+  static bool ToPrecision(double value,
+                          int precision,
+                          StringBuilder* result_builder);
+
+  // See DoubleToStringConverter::PrepareShortest and the following functions.
+  static bool PrepareShortest(
+      double value,
+      DoubleToStringConverter::PreparedNumber* prepared);
+  static bool PrepareShortestSingle(
+      float value,
+      DoubleToStringConverter::PreparedNumber* prepared);
+  static bool PrepareFixed(
+      double value,
+      int requested_digits,
+      DoubleToStringConverter::PreparedNumber* prepared);
+  static bool PrepareExponential(
+      double value,
+      int requested_digits,
+      DoubleToStringConverter::PreparedNumber* prepared);
+  static bool PreparePrecision(
+      double value,
+      int precision,
+      DoubleToStringConverter::PreparedNumber* prepared);
+  static void Emit(const DoubleToStringConverter::PreparedNumber& prepared,
+                   char* buffer);
+
+ private:
+  DISALLOW_IMPLICIT_CONSTRUCTORS(StaticDoubleToStringConverter);
+};
+
+typedef StaticDoubleToStringConverter<EcmaScriptFormat>
+    EcmaScriptDoubleToStringConverter;
+typedef StaticDoubleToStringConverter<JsonFormat> JsonDoubleToStringConverter;
+
+
 class StringToDoubleConverter {
  public:
   // Enumeration for allowing octals and ignoring junk when converting
@@ -535,9 +770,153 @@ class StringToDoubleConverter {
                       bool read_as_double,
                       int* processed_characters_count) const;
 
+  friend class StringToDoubleStream;
+
   DISALLOW_IMPLICIT_CONSTRUCTORS(StringToDoubleConverter);
 };
 
+
+// Converts a sequence of delimited numbers that arrives in chunks of
+// arbitrary size, for example from a socket or a file read piecewise.
+// Every number (the characters between two delimiters) is converted exactly
+// as StringToDoubleConverter::StringToDouble would convert it, using the
+// flags and special values of the given converter. The stream keeps the
+// partially parsed number (sign, significant digits, exponent) between
+// calls, so a number may be split at any position. It never allocates.
+//
+// Ex: converter flags = ALLOW_LEADING_SPACES | ALLOW_TRAILING_SPACES,
+//     delimiter = ',':
+//       Feed("1.5, 2", ...)   -> emits 1.5.
+//       Feed("5e1 ,", ...)    -> emits 250.0.
+//       Feed(" -0.125", ...)  -> emits nothing.
+//       Finish(&value)        -> true, value == -0.125.
+//
+// An empty number (two consecutive delimiters) is converted to the
+// converter's empty_string_value.
+class StringToDoubleStream {
+ public:
+  // The converter must outlive the stream.
+  StringToDoubleStream(const StringToDoubleConverter& converter,
+                       char delimiter);
+
+  // Consumes characters of the buffer until either 'length' characters have
+  // been consumed or 'values_size' numbers have been emitted. Emitted numbers
+  // are written to 'values' and their count to 'values_count'.
+  // Returns the number of consumed characters. The remaining characters
+  // should be fed again once the values have been processed.
+  int Feed(const char* buffer,
+           int length,
+           double* values,
+           int values_size,
+           int* values_count);
+
+  // Same as Feed above but for 16 bit characters.
+  int Feed(const uc16* buffer,
+           int length,
+           double* values,
+           int values_size,
+           int* values_count);
+
+  // Signals the end of the input. If characters have been fed since the last
+  // delimiter, converts them, stores the result in 'value' and returns true.
+  // Returns false otherwise. In both cases the stream is ready for a new
+  // sequence afterwards.
+  bool Finish(double* value);
+
+  // Discards the partially parsed number, if any.
+  void Reset();
+
+ private:
+  // Same limit as the one used by StringToDoubleConverter.
+  static const int kMaxSignificantDigits = 772;
+  static const int kBufferSize = kMaxSignificantDigits + 10;
+
+  enum State {
+    kStart,
+    kLeadingSpaces,
+    kSign,
+    kSymbol,
+    kFirstZero,
+    kLeadingZeros,
+    kInteger,
+    kPoint,
+    kFractionZeros,
+    kFraction,
+    kExponent,
+    kExponentSign,
+    kExponentDigits,
+    kHexPrefix,
+    kHexZeros,
+    kHexDigits,
+    kHexTail,
+    kTrailingSpaces,
+    kTrailingJunk,
+    kEnd,
+    kJunk
+  };
+
+  // The kind of number that has been read before trailing characters.
+  enum Kind {
+    kDecimal,
+    kHex,
+    kSpecial
+  };
+
+  template <class Char>
+  int FeedCharacters(const Char* buffer,
+                     int length,
+                     double* values,
+                     int values_size,
+                     int* values_count);
+
+  // Advances the state machine by one character of the current number.
+  void Advance(int c);
+  void AdvanceFromSign(int c);
+  void AdvanceFromBody(int c);
+  void AdvanceFromInteger(int c);
+  void AdvanceFromFraction(int c);
+  void AdvanceToTrailing(int c);
+  void AdvanceHexDigit(int c);
+
+  // Returns the state for characters that follow a complete number.
+  State TrailingState() const;
+
+  // Returns the value of the current number as if its end has been reached.
+  double Value();
+  double DecimalValue();
+  double HexValue();
+
+  const StringToDoubleConverter& converter_;
+  const char delimiter_;
+
+  State state_;
+  Kind kind_;
+  bool sign_;
+  bool leading_zero_;
+  bool octal_;
+
+  // Special values.
+  const char* symbol_;
+  int symbol_position_;
+
+  // Decimal numbers.
+  char buffer_[kBufferSize];
+  int significant_digits_;
+  int insignificant_digits_;
+  bool nonzero_digit_dropped_;
+  int exponent_;
+  bool exponent_negative_;
+  int exponent_value_;
+
+  // Hexadecimal numbers.
+  int64_t number_;
+  int dropped_bits_;
+  int overflow_bits_count_;
+  bool zero_tail_;
+
+  DISALLOW_IMPLICIT_CONSTRUCTORS(StringToDoubleStream);
+};
+
 }  // namespace double_conversion
 
 #endif  // DOUBLE_CONVERSION_DOUBLE_CONVERSION_H_
@@ -255,6 +255,101 @@ static void BiggestPowerTen(uint32_t number,
   *exponent_plus_one = exponent_plus_one_guess;
 }
 
+// The largest number of digits DigitGen extracts from the fractionals with a
+// single multiplication. 10^8 still fits into 27 bits, so the digits of a
+// block fit into a uint32_t.
+static const int kMaxDigitBlock = 8;
+
+// kDigitBlockLimits[k] is the largest value that can be multiplied by 10^k
+// without overflowing a uint64_t.
+static const uint64_t kDigitBlockLimits[] = {
+    UINT64_2PART_C(0xFFFFFFFF, FFFFFFFF),
+    UINT64_2PART_C(0xFFFFFFFF, FFFFFFFF) / 10,
+    UINT64_2PART_C(0xFFFFFFFF, FFFFFFFF) / 100,
+    UINT64_2PART_C(0xFFFFFFFF, FFFFFFFF) / 1000,
+    UINT64_2PART_C(0xFFFFFFFF, FFFFFFFF) / 10000,
+    UINT64_2PART_C(0xFFFFFFFF, FFFFFFFF) / 100000,
+    UINT64_2PART_C(0xFFFFFFFF, FFFFFFFF) / 1000000,
+    UINT64_2PART_C(0xFFFFFFFF, FFFFFFFF) / 10000000,
+    UINT64_2PART_C(0xFFFFFFFF, FFFFFFFF) / 100000000};
+
+static const char kDigitPairs[] =
+    "00010203040506070809"
+    "10111213141516171819"
+    "20212223242526272829"
+    "30313233343536373839"
+    "40414243444546474849"
+    "50515253545556575859"
+    "60616263646566676869"
+    "70717273747576777879"
+    "80818283848586878889"
+    "90919293949596979899";
+
+// Writes the 'count' lowest decimal digits of 'number' (padded with leading
+// '0's) into 'buffer', most significant digit first. The digits are produced
+// two at a time; the divisions by constants compile to multiplications.
+static void WriteDigitBlock(uint32_t number, int count, char* buffer) {
+  ASSERT(0 <= count && count <= 10);
+  if (count > 4) {
+    // Split off the lowest four digits so that both halves can be written
+    // independently.
+    uint32_t low = number % 10000;
+    WriteDigitBlock(number / 10000, count - 4, buffer);
+    buffer += count - 4;
+    number = low;
+    count = 4;
+  }
+  while (count >= 2) {
+    uint32_t pair = number % 100;
+    number /= 100;
+    count -= 2;
+    buffer[count] = kDigitPairs[2 * pair];
+    buffer[count + 1] = kDigitPairs[2 * pair + 1];
+  }
+  if (count == 1) buffer[0] = static_cast<char>('0' + number % 10);
+}
+
+// 'digits' holds the next 'count' digits of a number (padded with leading
+// '0's), followed by 'fractionals' which are scaled by 2^shift. Emitting only
+// the first j of these digits leaves a rest of
+//   ((digits % 10^(count - j)) << shift) + fractionals.
+// Returns true if some j in [1; count] gives a rest below 'unsafe_interval'.
+// In that case 'remaining' is set to count - j for the smallest such j,
+// 'emitted' to digits / 10^remaining and 'skipped' to digits % 10^remaining.
+// This is the point at which a loop emitting one digit at a time would have
+// stopped. The digits are never shifted, so (digits << shift) may exceed 64
+// bits.
+static bool FindBlockCut(uint32_t digits,
+                         int count,
+                         uint64_t fractionals,
+                         uint64_t unsafe_interval,
+                         int shift,
+                         int* remaining,
+                         uint32_t* emitted,
+                         uint32_t* skipped) {
+  if (count == 0 || unsafe_interval <= fractionals) return false;
+  // The rest is below the unsafe interval iff the skipped digits, as a
+  // number, are below this bound. Since the skipped digits only grow with the
+  // number of skipped digits the cut is found by skipping digits from the
+  // right for as long as they stay below the bound.
+  uint64_t bound = ((unsafe_interval - fractionals - 1) >> shift) + 1;
+  uint32_t low_digits = 0;
+  uint32_t power = 1;
+  int r = 0;
+  while (r < count - 1) {
+    uint32_t next = low_digits + (digits % 10) * power;
+    if (next >= bound) break;
+    low_digits = next;
+    digits /= 10;
+    power *= 10;
+    r++;
+  }
+  *remaining = r;
+  *emitted = digits;
+  *skipped = low_digits;
+  return true;
+}
+
 // Generates the digits of input number w.
 // w is a floating-point number (DiyFp), consisting of a significand and an
 // exponent. Its exponent is bounded by kMinimalTargetExponent and
@@ -341,42 +436,71 @@ static bool DigitGen(DiyFp low,
                   &divisor, &divisor_exponent_plus_one);
   *kappa = divisor_exponent_plus_one;
   *length = 0;
-  // Loop invariant: buffer = too_high / 10^kappa  (integer division)
-  // The invariant holds for the first iteration: kappa has been initialized
-  // with the divisor exponent + 1. And the divisor is the biggest power of ten
-  // that is smaller than integrals.
-  while (*kappa > 0) {
-    int digit = integrals / divisor;
-    ASSERT(digit <= 9);
-    buffer[*length] = static_cast<char>('0' + digit);
-    (*length)++;
-    integrals %= divisor;
-    (*kappa)--;
-    // Note that kappa now equals the exponent of the divisor and that the
-    // invariant thus holds again.
-    uint64_t rest =
-        (static_cast<uint64_t>(integrals) << -one.e()) + fractionals;
-    // Invariant: too_high = buffer * 10^kappa + DiyFp(rest, one.e())
-    // Reminder: unsafe_interval.e() == one.e()
-    if (rest < unsafe_interval.f()) {
-      // Rounding down (by not emitting the remaining digits) yields a number
-      // that lies within the unsafe interval.
-      return RoundWeed(buffer, *length, DiyFp::Minus(too_high, w).f(),
-                       unsafe_interval.f(), rest,
-                       static_cast<uint64_t>(divisor) << -one.e(), unit);
-    }
-    divisor /= 10;
+  // Invariant: too_high = buffer * 10^kappa + DiyFp(rest, one.e()), where
+  // rest = (integrals << -one.e()) + fractionals.
+  // Instead of emitting one digit at a time we find, in one go, how many of
+  // the integral digits are needed before rest drops below the unsafe
+  // interval. Only then are the digits written, two at a time.
+  int remaining;
+  uint32_t emitted;
+  uint32_t skipped;
+  if (FindBlockCut(integrals, divisor_exponent_plus_one, fractionals,
+                   unsafe_interval.f(), -one.e(),
+                   &remaining, &emitted, &skipped)) {
+    int count = divisor_exponent_plus_one - remaining;
+    WriteDigitBlock(emitted, count, buffer.start() + *length);
+    *length += count;
+    *kappa = remaining;
+    uint64_t rest = (static_cast<uint64_t>(skipped) << -one.e()) + fractionals;
+    // Rounding down (by not emitting the remaining digits) yields a number
+    // that lies within the unsafe interval.
+    return RoundWeed(buffer, *length, DiyFp::Minus(too_high, w).f(),
+                     unsafe_interval.f(), rest,
+                     static_cast<uint64_t>(kSmallPowersOfTen[remaining + 1])
+                         << -one.e(),
+                     unit);
   }
+  WriteDigitBlock(integrals, divisor_exponent_plus_one,
+                  buffer.start() + *length);
+  *length += divisor_exponent_plus_one;
+  *kappa = 0;
 
   // The integrals have been generated. We are at the point of the decimal
-  // separator. In the following loop we simply multiply the remaining digits by
-  // 10 and divide by one. We just need to pay attention to multiply associated
-  // data (like the interval or 'unit'), too.
-  // Note that the multiplication by 10 does not overflow, because w.e >= -60
-  // and thus one.e >= -60.
+  // separator. Multiplying the fractionals by 10^k yields the next k digits
+  // above one and the new fractionals below it. The product needs more than
+  // 64 bits, but the interval and 'unit' are scaled by the same factor and
+  // must not overflow; k is chosen accordingly. Since the unsafe interval is
+  // below one (otherwise we would have stopped) k is at least 1.
+  // As long as the new fractionals are not below the scaled unsafe interval
+  // none of the k digits would have stopped the generation (see
+  // FindBlockCut), and the whole block is emitted at once.
   ASSERT(one.e() >= -60);
   ASSERT(fractionals < one.f());
   ASSERT(UINT64_2PART_C(0xFFFFFFFF, FFFFFFFF) / 10 >= one.f());
+  for (;;) {
+    ASSERT(unsafe_interval.f() <= fractionals);
+    int block = kMaxDigitBlock;
+    while (unsafe_interval.f() > kDigitBlockLimits[block]) block--;
+    ASSERT(block >= 1);
+    uint64_t scale = kSmallPowersOfTen[block + 1];
+    uint64_t high;
+    uint64_t low = Multiply64(fractionals, scale, &high);
+    uint64_t block_fractionals = low & (one.f() - 1);
+    if (block_fractionals < unsafe_interval.f() * scale) break;
+    uint32_t digits = static_cast<uint32_t>(
+        (high << (64 + one.e())) | (low >> -one.e()));
+    WriteDigitBlock(digits, block, buffer.start() + *length);
+    *length += block;
+    *kappa -= block;
+    fractionals = block_fractionals;
+    unit *= scale;
+    unsafe_interval.set_f(unsafe_interval.f() * scale);
+  }
+  // The generation stops within the next block. Its digits are produced one
+  // at a time: the stopping point is usually close to the end of the block,
+  // and for the last few digits the multiplication by 10 is cheapest.
+  // Note that the multiplication by 10 does not overflow, because w.e >= -60
+  // and thus one.e >= -60.
   for (;;) {
     fractionals *= 10;
     unit *= 10;
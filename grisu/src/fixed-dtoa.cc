@@ -32,10 +32,49 @@
 
 namespace double_conversion {
 
-// Represents a 128bit type. This class should be replaced by a native type on
-// platforms that support 128bit integers.
+// Represents a 128bit type. Uses the native unsigned 128-bit integer where the
+// compiler offers one, and a pair of 64-bit words otherwise.
 class UInt128 {
  public:
+#if defined(DOUBLE_CONVERSION_HAS_UINT128)
+  UInt128() : value_(0) { }
+  UInt128(uint64_t high, uint64_t low)
+      : value_((static_cast<uint128_t>(high) << 64) | low) { }
+
+  void Multiply(uint32_t multiplicand) {
+    ASSERT(multiplicand == 0 ||
+           value_ <= ~static_cast<uint128_t>(0) / multiplicand);
+    value_ *= multiplicand;
+  }
+
+  void Shift(int shift_amount) {
+    ASSERT(-64 <= shift_amount && shift_amount <= 64);
+    if (shift_amount <= 0) {
+      value_ <<= -shift_amount;
+    } else {
+      value_ >>= shift_amount;
+    }
+  }
+
+  // Modifies *this to *this MOD (2^power).
+  // Returns *this DIV (2^power).
+  int DivModPowerOf2(int power) {
+    int result = static_cast<int>(value_ >> power);
+    value_ &= (static_cast<uint128_t>(1) << power) - 1;
+    return result;
+  }
+
+  bool IsZero() const {
+    return value_ == 0;
+  }
+
+  int BitAt(int position) {
+    return static_cast<int>(value_ >> position) & 1;
+  }
+
+ private:
+  uint128_t value_;
+#else
   UInt128() : high_bits_(0), low_bits_(0) { }
   UInt128(uint64_t high, uint64_t low) : high_bits_(high), low_bits_(low) { }
 
@@ -111,6 +150,7 @@ class UInt128 {
   // Value == (high_bits_ << 64) + low_bits_
   uint64_t high_bits_;
   uint64_t low_bits_;
+#endif
 };
 
 
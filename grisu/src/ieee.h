@@ -272,6 +272,8 @@ class Single {
   Single() : d32_(0) {}
   explicit Single(float f) : d32_(float_to_uint32(f)) {}
   explicit Single(uint32_t d32) : d32_(d32) {}
+  explicit Single(DiyFp diy_fp)
+    : d32_(DiyFpToUint32(diy_fp)) {}
 
   // The value encoded by this Single must be greater or equal to +0.0.
   // It must not be special (infinity, or NaN).
@@ -286,6 +288,15 @@ class Single {
     return d32_;
   }
 
+  // Returns the next greater single. Returns +infinity on input +infinity.
+  // Precondition: the value encoded by this Single must be greater or equal
+  // than +0.0.
+  float NextSingle() const {
+    ASSERT(Sign() > 0);
+    if (d32_ == kInfinity) return Single(kInfinity).value();
+    return Single(d32_ + 1).value();
+  }
+
   int Exponent() const {
     if (IsDenormal()) return kDenormalExponent;
 
@@ -377,6 +388,16 @@ class Single {
 
   float value() const { return uint32_to_float(d32_); }
 
+  // Returns the significand size for a given order of magnitude. See
+  // Double::SignificandSizeForOrderOfMagnitude.
+  static int SignificandSizeForOrderOfMagnitude(int order) {
+    if (order >= (kDenormalExponent + kSignificandSize)) {
+      return kSignificandSize;
+    }
+    if (order <= kDenormalExponent) return 0;
+    return order - kDenormalExponent;
+  }
+
   static float Infinity() {
     return Single(kInfinity).value();
   }
@@ -394,6 +415,33 @@ class Single {
 
   const uint32_t d32_;
 
+  static uint32_t DiyFpToUint32(DiyFp diy_fp) {
+    uint64_t significand = diy_fp.f();
+    int exponent = diy_fp.e();
+    while (significand > kHiddenBit + kSignificandMask) {
+      significand >>= 1;
+      exponent++;
+    }
+    if (exponent >= kMaxExponent) {
+      return kInfinity;
+    }
+    if (exponent < kDenormalExponent) {
+      return 0;
+    }
+    while (exponent > kDenormalExponent && (significand & kHiddenBit) == 0) {
+      significand <<= 1;
+      exponent--;
+    }
+    uint32_t biased_exponent;
+    if (exponent == kDenormalExponent && (significand & kHiddenBit) == 0) {
+      biased_exponent = 0;
+    } else {
+      biased_exponent = static_cast<uint32_t>(exponent + kExponentBias);
+    }
+    return (static_cast<uint32_t>(significand) & kSignificandMask) |
+        (biased_exponent << kPhysicalSignificandSize);
+  }
+
   DISALLOW_COPY_AND_ASSIGN(Single);
 };
 
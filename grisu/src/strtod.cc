@@ -88,6 +88,156 @@ static const int kExactPowersOfTenSize = ARRAY_SIZE(exact_powers_of_ten);
 // we round up to 780.
 static const int kMaxSignificantDecimalDigits = 780;
 
+// Strtof works with its own, smaller limits.
+// 2^24 = 16777216 > 10^7: integers of up to 7 digits fit into a float.
+static const int kMaxExactFloatIntegerDecimalDigits = 7;
+// Values >= 10^39 overflow, values < 10^-46 round to 0.
+static const int kMaxFloatDecimalPower = 39;
+static const int kMinFloatDecimalPower = -46;
+
+static const float exact_float_powers_of_ten[] = {
+  1.0f,  // 10^0
+  10.0f,
+  100.0f,
+  1000.0f,
+  10000.0f,
+  100000.0f,
+  1000000.0f,
+  10000000.0f,
+  100000000.0f,
+  1000000000.0f,
+  10000000000.0f  // 10^10
+};
+static const int kExactFloatPowersOfTenSize =
+    ARRAY_SIZE(exact_float_powers_of_ten);
+
+// The powers of ten that DiyFpStrtof needs: 10^k for
+// kMinFloatPowerOfTen <= k <= kMaxFloatPowerOfTen, as normalized DiyFps
+// rounded to nearest. Up to 10^kMaxExactFloatPowerOfTen they are exact.
+// With at most 19 significant digits read, the range follows from
+// kMinFloatDecimalPower and kMaxFloatDecimalPower.
+struct FloatPowerOfTen {
+  uint64_t significand;
+  int16_t binary_exponent;
+};
+
+static const FloatPowerOfTen kFloatPowersOfTen[] = {
+  {UINT64_2PART_C(0x86ccbb52, ea94baeb), -279},  // 10^-65
+  {UINT64_2PART_C(0xa87fea27, a539e9a5), -276},  // 10^-64
+  {UINT64_2PART_C(0xd29fe4b1, 8e88640f), -273},  // 10^-63
+  {UINT64_2PART_C(0x83a3eeee, f9153e89), -269},  // 10^-62
+  {UINT64_2PART_C(0xa48ceaaa, b75a8e2b), -266},  // 10^-61
+  {UINT64_2PART_C(0xcdb02555, 653131b6), -263},  // 10^-60
+  {UINT64_2PART_C(0x808e1755, 5f3ebf12), -259},  // 10^-59
+  {UINT64_2PART_C(0xa0b19d2a, b70e6ed6), -256},  // 10^-58
+  {UINT64_2PART_C(0xc8de0475, 64d20a8c), -253},  // 10^-57
+  {UINT64_2PART_C(0xfb158592, be068d2f), -250},  // 10^-56
+  {UINT64_2PART_C(0x9ced737b, b6c4183d), -246},  // 10^-55
+  {UINT64_2PART_C(0xc428d05a, a4751e4d), -243},  // 10^-54
+  {UINT64_2PART_C(0xf5330471, 4d9265e0), -240},  // 10^-53
+  {UINT64_2PART_C(0x993fe2c6, d07b7fac), -236},  // 10^-52
+  {UINT64_2PART_C(0xbf8fdb78, 849a5f97), -233},  // 10^-51
+  {UINT64_2PART_C(0xef73d256, a5c0f77d), -230},  // 10^-50
+  {UINT64_2PART_C(0x95a86376, 27989aae), -226},  // 10^-49
+  {UINT64_2PART_C(0xbb127c53, b17ec159), -223},  // 10^-48
+  {UINT64_2PART_C(0xe9d71b68, 9dde71b0), -220},  // 10^-47
+  {UINT64_2PART_C(0x92267121, 62ab070e), -216},  // 10^-46
+  {UINT64_2PART_C(0xb6b00d69, bb55c8d1), -213},  // 10^-45
+  {UINT64_2PART_C(0xe45c10c4, 2a2b3b06), -210},  // 10^-44
+  {UINT64_2PART_C(0x8eb98a7a, 9a5b04e3), -206},  // 10^-43
+  {UINT64_2PART_C(0xb267ed19, 40f1c61c), -203},  // 10^-42
+  {UINT64_2PART_C(0xdf01e85f, 912e37a3), -200},  // 10^-41
+  {UINT64_2PART_C(0x8b61313b, babce2c6), -196},  // 10^-40
+  {UINT64_2PART_C(0xae397d8a, a96c1b78), -193},  // 10^-39
+  {UINT64_2PART_C(0xd9c7dced, 53c72256), -190},  // 10^-38
+  {UINT64_2PART_C(0x881cea14, 545c7575), -186},  // 10^-37
+  {UINT64_2PART_C(0xaa242499, 697392d3), -183},  // 10^-36
+  {UINT64_2PART_C(0xd4ad2dbf, c3d07788), -180},  // 10^-35
+  {UINT64_2PART_C(0x84ec3c97, da624ab5), -176},  // 10^-34
+  {UINT64_2PART_C(0xa6274bbd, d0fadd62), -173},  // 10^-33
+  {UINT64_2PART_C(0xcfb11ead, 453994ba), -170},  // 10^-32
+  {UINT64_2PART_C(0x81ceb32c, 4b43fcf5), -166},  // 10^-31
+  {UINT64_2PART_C(0xa2425ff7, 5e14fc32), -163},  // 10^-30
+  {UINT64_2PART_C(0xcad2f7f5, 359a3b3e), -160},  // 10^-29
+  {UINT64_2PART_C(0xfd87b5f2, 8300ca0e), -157},  // 10^-28
+  {UINT64_2PART_C(0x9e74d1b7, 91e07e48), -153},  // 10^-27
+  {UINT64_2PART_C(0xc6120625, 76589ddb), -150},  // 10^-26
+  {UINT64_2PART_C(0xf79687ae, d3eec551), -147},  // 10^-25
+  {UINT64_2PART_C(0x9abe14cd, 44753b53), -143},  // 10^-24
+  {UINT64_2PART_C(0xc16d9a00, 95928a27), -140},  // 10^-23
+  {UINT64_2PART_C(0xf1c90080, baf72cb1), -137},  // 10^-22
+  {UINT64_2PART_C(0x971da050, 74da7bef), -133},  // 10^-21
+  {UINT64_2PART_C(0xbce50864, 92111aeb), -130},  // 10^-20
+  {UINT64_2PART_C(0xec1e4a7d, b69561a5), -127},  // 10^-19
+  {UINT64_2PART_C(0x9392ee8e, 921d5d07), -123},  // 10^-18
+  {UINT64_2PART_C(0xb877aa32, 36a4b449), -120},  // 10^-17
+  {UINT64_2PART_C(0xe69594be, c44de15b), -117},  // 10^-16
+  {UINT64_2PART_C(0x901d7cf7, 3ab0acd9), -113},  // 10^-15
+  {UINT64_2PART_C(0xb424dc35, 095cd80f), -110},  // 10^-14
+  {UINT64_2PART_C(0xe12e1342, 4bb40e13), -107},  // 10^-13
+  {UINT64_2PART_C(0x8cbccc09, 6f5088cc), -103},  // 10^-12
+  {UINT64_2PART_C(0xafebff0b, cb24aaff), -100},  // 10^-11
+  {UINT64_2PART_C(0xdbe6fece, bdedd5bf), -97},  // 10^-10
+  {UINT64_2PART_C(0x89705f41, 36b4a597), -93},  // 10^-9
+  {UINT64_2PART_C(0xabcc7711, 8461cefd), -90},  // 10^-8
+  {UINT64_2PART_C(0xd6bf94d5, e57a42bc), -87},  // 10^-7
+  {UINT64_2PART_C(0x8637bd05, af6c69b6), -83},  // 10^-6
+  {UINT64_2PART_C(0xa7c5ac47, 1b478423), -80},  // 10^-5
+  {UINT64_2PART_C(0xd1b71758, e219652c), -77},  // 10^-4
+  {UINT64_2PART_C(0x83126e97, 8d4fdf3b), -73},  // 10^-3
+  {UINT64_2PART_C(0xa3d70a3d, 70a3d70a), -70},  // 10^-2
+  {UINT64_2PART_C(0xcccccccc, cccccccd), -67},  // 10^-1
+  {UINT64_2PART_C(0x80000000, 00000000), -63},  // 10^0
+  {UINT64_2PART_C(0xa0000000, 00000000), -60},  // 10^1
+  {UINT64_2PART_C(0xc8000000, 00000000), -57},  // 10^2
+  {UINT64_2PART_C(0xfa000000, 00000000), -54},  // 10^3
+  {UINT64_2PART_C(0x9c400000, 00000000), -50},  // 10^4
+  {UINT64_2PART_C(0xc3500000, 00000000), -47},  // 10^5
+  {UINT64_2PART_C(0xf4240000, 00000000), -44},  // 10^6
+  {UINT64_2PART_C(0x98968000, 00000000), -40},  // 10^7
+  {UINT64_2PART_C(0xbebc2000, 00000000), -37},  // 10^8
+  {UINT64_2PART_C(0xee6b2800, 00000000), -34},  // 10^9
+  {UINT64_2PART_C(0x9502f900, 00000000), -30},  // 10^10
+  {UINT64_2PART_C(0xba43b740, 00000000), -27},  // 10^11
+  {UINT64_2PART_C(0xe8d4a510, 00000000), -24},  // 10^12
+  {UINT64_2PART_C(0x9184e72a, 00000000), -20},  // 10^13
+  {UINT64_2PART_C(0xb5e620f4, 80000000), -17},  // 10^14
+  {UINT64_2PART_C(0xe35fa931, a0000000), -14},  // 10^15
+  {UINT64_2PART_C(0x8e1bc9bf, 04000000), -10},  // 10^16
+  {UINT64_2PART_C(0xb1a2bc2e, c5000000), -7},  // 10^17
+  {UINT64_2PART_C(0xde0b6b3a, 76400000), -4},  // 10^18
+  {UINT64_2PART_C(0x8ac72304, 89e80000), 0},  // 10^19
+  {UINT64_2PART_C(0xad78ebc5, ac620000), 3},  // 10^20
+  {UINT64_2PART_C(0xd8d726b7, 177a8000), 6},  // 10^21
+  {UINT64_2PART_C(0x87867832, 6eac9000), 10},  // 10^22
+  {UINT64_2PART_C(0xa968163f, 0a57b400), 13},  // 10^23
+  {UINT64_2PART_C(0xd3c21bce, cceda100), 16},  // 10^24
+  {UINT64_2PART_C(0x84595161, 401484a0), 20},  // 10^25
+  {UINT64_2PART_C(0xa56fa5b9, 9019a5c8), 23},  // 10^26
+  {UINT64_2PART_C(0xcecb8f27, f4200f3a), 26},  // 10^27
+  {UINT64_2PART_C(0x813f3978, f8940984), 30},  // 10^28
+  {UINT64_2PART_C(0xa18f07d7, 36b90be5), 33},  // 10^29
+  {UINT64_2PART_C(0xc9f2c9cd, 04674edf), 36},  // 10^30
+  {UINT64_2PART_C(0xfc6f7c40, 45812296), 39},  // 10^31
+  {UINT64_2PART_C(0x9dc5ada8, 2b70b59e), 43},  // 10^32
+  {UINT64_2PART_C(0xc5371912, 364ce305), 46},  // 10^33
+  {UINT64_2PART_C(0xf684df56, c3e01bc7), 49},  // 10^34
+  {UINT64_2PART_C(0x9a130b96, 3a6c115c), 53},  // 10^35
+  {UINT64_2PART_C(0xc097ce7b, c90715b3), 56},  // 10^36
+  {UINT64_2PART_C(0xf0bdc21a, bb48db20), 59},  // 10^37
+  {UINT64_2PART_C(0x96769950, b50d88f4), 63},  // 10^38
+};
+static const int kMinFloatPowerOfTen = -65;
+static const int kMaxFloatPowerOfTen = 38;
+static const int kMaxExactFloatPowerOfTen = 27;
+
+// CompareBufferWithDiyFp reads the buffer in blocks of this many digits. A
+// block must fit into the 30 bits of Bignum::DivideModuloBignum.
+static const int kCompareDigitBlock = 9;
+static const uint32_t kCompareBlockPowers[] = {
+  1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000, 1000000000
+};
+
 static Vector<const char> TrimLeadingZeros(Vector<const char> buffer) {
   for (int i = 0; i < buffer.length(); i++) {
     if (buffer[i] != '0') {
@@ -290,7 +440,13 @@ static bool DiyFpStrtod(Vector<const char> buffer,
 
   int old_e = input.e();
   input.Normalize();
-  error <<= old_e - input.e();
+  // Normalizing a short input shifts it by up to 63 bits, more than an int
+  // can be shifted. Such an input was read exactly, so there is no error to
+  // scale. Inputs with dropped digits have 19 digits and shift by at most 4.
+  if (error != 0) {
+    ASSERT(old_e - input.e() <= 4);
+    error <<= old_e - input.e();
+  }
 
   ASSERT(exponent <= PowersOfTenCache::kMaxDecimalExponent);
   if (exponent < PowersOfTenCache::kMinDecimalExponent) {
@@ -381,40 +537,194 @@ static bool DiyFpStrtod(Vector<const char> buffer,
 }
 
 
+static bool FloatStrtod(Vector<const char> trimmed,
+                        int exponent,
+                        float* result) {
+#if !defined(DOUBLE_CONVERSION_CORRECT_DOUBLE_OPERATIONS)
+  // See DoubleStrtod: with a wide floating-point stack the float operations
+  // would be rounded twice.
+  return false;
+#endif
+  if (trimmed.length() <= kMaxExactFloatIntegerDecimalDigits) {
+    int read_digits;
+    // The trimmed input and 10^|exponent| are exact floats. IEEE guarantees
+    // that the quotient (resp. product) is the best possible approximation.
+    if (exponent < 0 && -exponent < kExactFloatPowersOfTenSize) {
+      *result = static_cast<float>(ReadUint64(trimmed, &read_digits));
+      ASSERT(read_digits == trimmed.length());
+      *result /= exact_float_powers_of_ten[-exponent];
+      return true;
+    }
+    if (0 <= exponent && exponent < kExactFloatPowersOfTenSize) {
+      *result = static_cast<float>(ReadUint64(trimmed, &read_digits));
+      ASSERT(read_digits == trimmed.length());
+      *result *= exact_float_powers_of_ten[exponent];
+      return true;
+    }
+    int remaining_digits =
+        kMaxExactFloatIntegerDecimalDigits - trimmed.length();
+    if ((0 <= exponent) &&
+        (exponent - remaining_digits < kExactFloatPowersOfTenSize)) {
+      // The trimmed string was short and we can multiply it with
+      // 10^remaining_digits. As a result the remaining exponent now fits
+      // into a float too.
+      *result = static_cast<float>(ReadUint64(trimmed, &read_digits));
+      ASSERT(read_digits == trimmed.length());
+      *result *= exact_float_powers_of_ten[remaining_digits];
+      *result *= exact_float_powers_of_ten[exponent - remaining_digits];
+      return true;
+    }
+  }
+  return false;
+}
+
+
+// The float counterpart of DiyFpStrtod. A single multiplication with an
+// entry of kFloatPowersOfTen gives 64 bits, of which a float only needs 24,
+// so that the result is nearly always decided.
+// If the function returns true then the result is the correct float.
+// Otherwise it is either the correct float or the float that is just below
+// the correct float.
+static bool DiyFpStrtof(Vector<const char> buffer,
+                        int exponent,
+                        float* result) {
+  DiyFp input;
+  int remaining_decimals;
+  ReadDiyFp(buffer, &input, &remaining_decimals);
+  // As in DiyFpStrtod the error is counted in 1/kDenominator ulps.
+  const int kDenominatorLog = 3;
+  const int kDenominator = 1 << kDenominatorLog;
+  exponent += remaining_decimals;
+  int error = (remaining_decimals == 0 ? 0 : kDenominator / 2);
+
+  int old_e = input.e();
+  input.Normalize();
+  // As in DiyFpStrtod, only an input with dropped digits has an error to
+  // scale, and its shift is small.
+  if (error != 0) {
+    ASSERT(old_e - input.e() <= 4);
+    error <<= old_e - input.e();
+  }
+
+  ASSERT(kMinFloatPowerOfTen <= exponent && exponent <= kMaxFloatPowerOfTen);
+  const FloatPowerOfTen& power =
+      kFloatPowersOfTen[exponent - kMinFloatPowerOfTen];
+  input.Multiply(DiyFp(power.significand, power.binary_exponent));
+  // The error of the product equals
+  //   error_a + error_b + error_a*error_b/2^64 + 0.5
+  // where error_b is 0 for the exact powers and 0.5 otherwise.
+  bool exact_power = 0 <= exponent && exponent <= kMaxExactFloatPowerOfTen;
+  int error_b = (exact_power ? 0 : kDenominator / 2);
+  int error_ab = (error == 0 ? 0 : 1);  // We round up to 1.
+  int fixed_error = kDenominator / 2;
+  error += error_b + error_ab + fixed_error;
+
+  old_e = input.e();
+  input.Normalize();
+  error <<= old_e - input.e();
+
+  // See if the float's significand changes if we add/subtract the error.
+  int order_of_magnitude = DiyFp::kSignificandSize + input.e();
+  int effective_significand_size =
+      Single::SignificandSizeForOrderOfMagnitude(order_of_magnitude);
+  int precision_digits_count =
+      DiyFp::kSignificandSize - effective_significand_size;
+  if (precision_digits_count + kDenominatorLog >= DiyFp::kSignificandSize) {
+    // Very small denormals. See DiyFpStrtod.
+    int shift_amount = (precision_digits_count + kDenominatorLog) -
+        DiyFp::kSignificandSize + 1;
+    input.set_f(input.f() >> shift_amount);
+    input.set_e(input.e() + shift_amount);
+    error = (error >> shift_amount) + 1 + kDenominator;
+    precision_digits_count -= shift_amount;
+  }
+  ASSERT(DiyFp::kSignificandSize == 64);
+  ASSERT(precision_digits_count < 64);
+  uint64_t one64 = 1;
+  uint64_t precision_bits_mask = (one64 << precision_digits_count) - 1;
+  uint64_t precision_bits = input.f() & precision_bits_mask;
+  uint64_t half_way = one64 << (precision_digits_count - 1);
+  precision_bits *= kDenominator;
+  half_way *= kDenominator;
+  DiyFp rounded_input(input.f() >> precision_digits_count,
+                      input.e() + precision_digits_count);
+  if (precision_bits >= half_way + error) {
+    rounded_input.set_f(rounded_input.f() + 1);
+  }
+
+  *result = Single(rounded_input).value();
+  if (half_way - error < precision_bits && precision_bits < half_way + error) {
+    // Too imprecise. The result is the correct float or the next-lower one.
+    return false;
+  } else {
+    return true;
+  }
+}
+
+
 // Returns
 //   - -1 if buffer*10^exponent < diy_fp.
 //   -  0 if buffer*10^exponent == diy_fp.
 //   - +1 if buffer*10^exponent > diy_fp.
 // Preconditions:
+//   buffer is trimmed: it neither starts nor ends with '0'.
 //   buffer.length() + exponent <= kMaxDecimalPower + 1
 //   buffer.length() + exponent > kMinDecimalPower
 //   buffer.length() <= kMaxDecimalSignificantDigits
+//
+// With point = buffer.length() + exponent the buffer represents the fraction
+// 0.buffer * 10^point. Instead of converting the whole buffer into a bignum we
+// generate the decimal digits of diy_fp / 10^point, kCompareDigitBlock at a
+// time, and compare them against the buffer. The first block that differs
+// decides the comparison, since the digits following a block are worth less
+// than one unit of it. Unless the input is very close to diy_fp this happens
+// after two or three blocks.
 static int CompareBufferWithDiyFp(Vector<const char> buffer,
                                   int exponent,
                                   DiyFp diy_fp) {
   ASSERT(buffer.length() + exponent <= kMaxDecimalPower + 1);
   ASSERT(buffer.length() + exponent > kMinDecimalPower);
   ASSERT(buffer.length() <= kMaxSignificantDecimalDigits);
+  ASSERT(buffer.length() > 0 && buffer[0] != '0');
   // Make sure that the Bignum will be able to hold all our numbers.
   // Our Bignum implementation has a separate field for exponents. Shifts will
   // consume at most one bigit (< 64 bits).
   // ln(10) == 3.3219...
   ASSERT(((kMaxDecimalPower + 1) * 333 / 100) < Bignum::kMaxSignificantBits);
-  Bignum buffer_bignum;
-  Bignum diy_fp_bignum;
-  buffer_bignum.AssignDecimalString(buffer);
-  diy_fp_bignum.AssignUInt64(diy_fp.f());
-  if (exponent >= 0) {
-    buffer_bignum.MultiplyByPowerOfTen(exponent);
+  int point = buffer.length() + exponent;
+  // diy_fp / 10^point == numerator / denominator.
+  Bignum numerator;
+  Bignum denominator;
+  numerator.AssignUInt64(diy_fp.f());
+  denominator.AssignUInt16(1);
+  if (point >= 0) {
+    denominator.MultiplyByPowerOfTen(point);
   } else {
-    diy_fp_bignum.MultiplyByPowerOfTen(-exponent);
+    numerator.MultiplyByPowerOfTen(-point);
   }
   if (diy_fp.e() > 0) {
-    diy_fp_bignum.ShiftLeft(diy_fp.e());
+    numerator.ShiftLeft(diy_fp.e());
   } else {
-    buffer_bignum.ShiftLeft(-diy_fp.e());
+    denominator.ShiftLeft(-diy_fp.e());
+  }
+  // The buffer represents a fraction below 1.
+  if (Bignum::LessEqual(denominator, numerator)) return -1;
+  int position = 0;
+  while (position < buffer.length()) {
+    int block = Min(buffer.length() - position, kCompareDigitBlock);
+    uint32_t buffer_digits = 0;
+    for (int i = 0; i < block; ++i) {
+      buffer_digits = buffer_digits * 10 + (buffer[position + i] - '0');
+    }
+    numerator.MultiplyByUInt32(kCompareBlockPowers[block]);
+    uint32_t diy_fp_digits = numerator.DivideModuloBignum(denominator);
+    if (buffer_digits != diy_fp_digits) {
+      return buffer_digits < diy_fp_digits ? -1 : 1;
+    }
+    position += block;
   }
-  return Bignum::Compare(buffer_bignum, diy_fp_bignum);
+  // All digits of the buffer match. diy_fp is bigger if it has more digits.
+  return numerator.IsZero() ? 0 : -1;
 }
 
 
@@ -471,6 +781,33 @@ double Strtod(Vector<const char> buffer, int exponent) {
   }
 }
 
+// Returns true if the guess is the correct float.
+// Returns false, when guess is either correct or the next-lower float.
+static bool ComputeFloatGuess(Vector<const char> trimmed, int exponent,
+                              float* guess) {
+  if (trimmed.length() == 0) {
+    *guess = 0.0f;
+    return true;
+  }
+  if (exponent + trimmed.length() - 1 >= kMaxFloatDecimalPower) {
+    *guess = Single::Infinity();
+    return true;
+  }
+  if (exponent + trimmed.length() <= kMinFloatDecimalPower) {
+    *guess = 0.0f;
+    return true;
+  }
+
+  if (FloatStrtod(trimmed, exponent, guess) ||
+      DiyFpStrtof(trimmed, exponent, guess)) {
+    return true;
+  }
+  if (*guess == Single::Infinity()) {
+    return true;
+  }
+  return false;
+}
+
 float Strtof(Vector<const char> buffer, int exponent) {
   char copy_buffer[kMaxSignificantDecimalDigits];
   Vector<const char> trimmed;
@@ -479,76 +816,23 @@ float Strtof(Vector<const char> buffer, int exponent) {
              &trimmed, &updated_exponent);
   exponent = updated_exponent;
 
-  double double_guess;
-  bool is_correct = ComputeGuess(trimmed, exponent, &double_guess);
-
-  float float_guess = static_cast<float>(double_guess);
-  if (float_guess == double_guess) {
-    // This shortcut triggers for integer values.
-    return float_guess;
-  }
-
-  // We must catch double-rounding. Say the double has been rounded up, and is
-  // now a boundary of a float, and rounds up again. This is why we have to
-  // look at previous too.
-  // Example (in decimal numbers):
-  //    input: 12349
-  //    high-precision (4 digits): 1235
-  //    low-precision (3 digits):
-  //       when read from input: 123
-  //       when rounded from high precision: 124.
-  // To do this we simply look at the neigbors of the correct result and see
-  // if they would round to the same float. If the guess is not correct we have
-  // to look at four values (since two different doubles could be the correct
-  // double).
-
-  double double_next = Double(double_guess).NextDouble();
-  double double_previous = Double(double_guess).PreviousDouble();
-
-  float f1 = static_cast<float>(double_previous);
-  float f2 = float_guess;
-  float f3 = static_cast<float>(double_next);
-  float f4;
-  if (is_correct) {
-    f4 = f3;
-  } else {
-    double double_next2 = Double(double_next).NextDouble();
-    f4 = static_cast<float>(double_next2);
-  }
-  (void) f2;  // Mark variable as used.
-  ASSERT(f1 <= f2 && f2 <= f3 && f3 <= f4);
-
-  // If the guess doesn't lie near a single-precision boundary we can simply
-  // return its float-value.
-  if (f1 == f4) {
-    return float_guess;
-  }
-
-  ASSERT((f1 != f2 && f2 == f3 && f3 == f4) ||
-         (f1 == f2 && f2 != f3 && f3 == f4) ||
-         (f1 == f2 && f2 == f3 && f3 != f4));
-
-  // guess and next are the two possible canditates (in the same way that
-  // double_guess was the lower candidate for a double-precision guess).
-  float guess = f1;
-  float next = f4;
-  DiyFp upper_boundary;
-  if (guess == 0.0f) {
-    float min_float = 1e-45f;
-    upper_boundary = Double(static_cast<double>(min_float) / 2).AsDiyFp();
-  } else {
-    upper_boundary = Single(guess).UpperBoundary();
-  }
+  float guess;
+  bool is_correct = ComputeFloatGuess(trimmed, exponent, &guess);
+  if (is_correct) return guess;
+
+  // guess and the next float are the two possible candidates. For guess ==
+  // 0.0f the boundary is half the smallest denormal.
+  DiyFp upper_boundary = Single(guess).UpperBoundary();
   int comparison = CompareBufferWithDiyFp(trimmed, exponent, upper_boundary);
   if (comparison < 0) {
     return guess;
   } else if (comparison > 0) {
-    return next;
+    return Single(guess).NextSingle();
   } else if ((Single(guess).Significand() & 1) == 0) {
     // Round towards even.
     return guess;
   } else {
-    return next;
+    return Single(guess).NextSingle();
   }
 }
 
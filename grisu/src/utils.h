@@ -80,6 +80,23 @@
 #define DOUBLE_CONVERSION_UNUSED
 #endif
 
+// Native 128-bit arithmetic detection. Compilers with an unsigned 128-bit
+// integer type (gcc and clang on 64-bit targets) compute a full 64x64 bit
+// product in a single multiply instruction (mul, or mulx with BMI2), and 64-bit
+// MSVC offers the same through the _umul128 intrinsic. Other targets use the
+// portable 32-bit code. Define DOUBLE_CONVERSION_NO_NATIVE_UINT128 to force the
+// portable code, for instance to test it.
+#if !defined(DOUBLE_CONVERSION_NO_NATIVE_UINT128)
+#if defined(__SIZEOF_INT128__)
+#define DOUBLE_CONVERSION_HAS_UINT128 1
+#elif defined(_MSC_VER) && defined(_M_X64)
+#include <intrin.h>
+#pragma intrinsic(_umul128)
+#pragma intrinsic(_BitScanReverse64)
+#define DOUBLE_CONVERSION_HAS_UMUL128 1
+#endif
+#endif
+
 #if defined(_WIN32) && !defined(__MINGW32__)
 
 typedef signed char int8_t;
@@ -154,6 +171,62 @@ static T Min(T a, T b) {
 }
 
 
+#if defined(DOUBLE_CONVERSION_HAS_UINT128)
+__extension__ typedef unsigned __int128 uint128_t;
+#endif
+
+// Returns the low 64 bits of the 128-bit product a * b and stores the high 64
+// bits in *high.
+inline uint64_t Multiply64(uint64_t a, uint64_t b, uint64_t* high) {
+#if defined(DOUBLE_CONVERSION_HAS_UINT128)
+  uint128_t product = static_cast<uint128_t>(a) * b;
+  *high = static_cast<uint64_t>(product >> 64);
+  return static_cast<uint64_t>(product);
+#elif defined(DOUBLE_CONVERSION_HAS_UMUL128)
+  return _umul128(a, b, high);
+#else
+  const uint64_t kM32 = 0xFFFFFFFFu;
+  uint64_t a_high = a >> 32;
+  uint64_t a_low = a & kM32;
+  uint64_t b_high = b >> 32;
+  uint64_t b_low = b & kM32;
+  uint64_t hh = a_high * b_high;
+  uint64_t hl = a_high * b_low;
+  uint64_t lh = a_low * b_high;
+  uint64_t ll = a_low * b_low;
+  uint64_t middle = (ll >> 32) + (hl & kM32) + (lh & kM32);
+  *high = hh + (hl >> 32) + (lh >> 32) + (middle >> 32);
+  return (middle << 32) | (ll & kM32);
+#endif
+}
+
+
+// Returns the number of leading zero bits of x, which must not be 0.
+inline int CountLeadingZeros64(uint64_t x) {
+  ASSERT(x != 0);
+#if defined(__GNUC__)
+  return __builtin_clzll(x);
+#elif defined(DOUBLE_CONVERSION_HAS_UMUL128)
+  unsigned long index;
+  _BitScanReverse64(&index, x);
+  return 63 - static_cast<int>(index);
+#else
+  int count = 0;
+  const uint64_t k10MSBits = UINT64_2PART_C(0xFFC00000, 00000000);
+  const uint64_t kMSB = UINT64_2PART_C(0x80000000, 00000000);
+  while ((x & k10MSBits) == 0) {
+    x <<= 10;
+    count += 10;
+  }
+  while ((x & kMSB) == 0) {
+    x <<= 1;
+    count++;
+  }
+  return count;
+#endif
+}
+
+
 inline int StrLength(const char* string) {
   size_t length = strlen(string);
   ASSERT(length == static_cast<size_t>(static_cast<int>(length)));
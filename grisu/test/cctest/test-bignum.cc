@@ -1060,6 +1060,54 @@ TEST(DivideModuloIntBignum) {
 }
 
 
+TEST(DivideModuloBignum) {
+  char buffer[kBufferSize];
+  Bignum bignum;
+  Bignum other;
+  Bignum third;
+
+  AssignHexString(&bignum, "12345678");
+  AssignHexString(&other, "3789012");
+  CHECK_EQ(5, bignum.DivideModuloBignum(other));
+  CHECK(bignum.ToHexString(buffer, kBufferSize));
+  CHECK_EQ("D9861E", buffer);
+
+  bignum.AssignUInt16(10);
+  AssignHexString(&other, "1234567890");
+  CHECK_EQ(0, bignum.DivideModuloBignum(other));
+  CHECK(bignum.ToHexString(buffer, kBufferSize));
+  CHECK_EQ("A", buffer);
+
+  // 0x123456789ABCDEF0123 * 999999999 + 12345.
+  AssignHexString(&bignum, "43D11C70A3D709FDDC8904CD16");
+  AssignHexString(&other, "123456789ABCDEF0123");
+  CHECK_EQ(999999999, bignum.DivideModuloBignum(other));
+  CHECK(bignum.ToHexString(buffer, kBufferSize));
+  CHECK_EQ("3039", buffer);
+
+  // An exact multiple, and one less.
+  AssignHexString(&bignum, "48D159E147AE14369CF210FEDD");
+  CHECK_EQ(0x3FFFFFFF, bignum.DivideModuloBignum(other));
+  CHECK(bignum.ToHexString(buffer, kBufferSize));
+  CHECK_EQ("0", buffer);
+
+  AssignHexString(&bignum, "48D159E147AE14369CF210FEDC");
+  CHECK_EQ(0x3FFFFFFE, bignum.DivideModuloBignum(other));
+  CHECK(bignum.ToHexString(buffer, kBufferSize));
+  CHECK_EQ("123456789ABCDEF0122", buffer);
+
+  bignum.AssignUInt16(10);
+  bignum.ShiftLeft(500);
+  other.AssignBignum(bignum);
+  bignum.MultiplyByUInt32(0x2FFFFFFF);
+  third.AssignUInt16(0xFFF);
+  bignum.AddBignum(third);
+  CHECK_EQ(0x2FFFFFFF, bignum.DivideModuloBignum(other));
+  CHECK(bignum.ToHexString(buffer, kBufferSize));
+  CHECK_EQ("FFF", buffer);
+}
+
+
 TEST(Compare) {
   Bignum bignum1;
   Bignum bignum2;
@@ -1718,6 +1718,205 @@ TEST(DoubleToStringJavaScript) {
 }
 
 
+TEST(DoubleToStringStaticFormats) {
+  const int kBufferSize = 128;
+  char buffer[kBufferSize];
+  StringBuilder builder(buffer, kBufferSize);
+  char expected_buffer[kBufferSize];
+  StringBuilder expected(expected_buffer, kBufferSize);
+  const DoubleToStringConverter& dc =
+      DoubleToStringConverter::EcmaScriptConverter();
+
+  const double kValues[] = {
+    0.0, -0.0, 1.0, -1.5, 0.1, 123.456, 1e-6, 1.5e-7, 1e20, 1e21, -1.25e21,
+    5e-324, 1.7976931348623157e308, 0.000001234, 123456789.0, 230.0,
+  };
+  const int kValuesLength = ARRAY_SIZE(kValues);
+  for (int i = 0; i < kValuesLength; ++i) {
+    double value = kValues[i];
+    for (int format = 0; format < 2; ++format) {
+      expected.Reset();
+      CHECK(dc.ToShortest(value, &expected));
+      builder.Reset();
+      if (format == 0) {
+        CHECK(EcmaScriptDoubleToStringConverter::ToShortest(value, &builder));
+      } else {
+        CHECK(JsonDoubleToStringConverter::ToShortest(value, &builder));
+      }
+      CHECK_EQ(expected.Finalize(), builder.Finalize());
+    }
+
+    expected.Reset();
+    CHECK(dc.ToShortestSingle(static_cast<float>(value), &expected));
+    builder.Reset();
+    CHECK(EcmaScriptDoubleToStringConverter::ToShortestSingle(
+        static_cast<float>(value), &builder));
+    CHECK_EQ(expected.Finalize(), builder.Finalize());
+
+    for (int digits = 0; digits < 20; digits += 3) {
+      expected.Reset();
+      builder.Reset();
+      CHECK_EQ(dc.ToFixed(value, digits, &expected),
+               EcmaScriptDoubleToStringConverter::ToFixed(value, digits,
+                                                          &builder));
+      CHECK_EQ(expected.Finalize(), builder.Finalize());
+
+      expected.Reset();
+      builder.Reset();
+      CHECK(dc.ToExponential(value, digits - 1, &expected));
+      CHECK(EcmaScriptDoubleToStringConverter::ToExponential(value, digits - 1,
+                                                             &builder));
+      CHECK_EQ(expected.Finalize(), builder.Finalize());
+
+      expected.Reset();
+      builder.Reset();
+      CHECK(dc.ToPrecision(value, digits + 1, &expected));
+      CHECK(EcmaScriptDoubleToStringConverter::ToPrecision(value, digits + 1,
+                                                           &builder));
+      CHECK_EQ(expected.Finalize(), builder.Finalize());
+    }
+  }
+
+  builder.Reset();
+  CHECK(EcmaScriptDoubleToStringConverter::ToShortest(-Double::Infinity(),
+                                                      &builder));
+  CHECK_EQ("-Infinity", builder.Finalize());
+
+  builder.Reset();
+  CHECK(EcmaScriptDoubleToStringConverter::ToPrecision(Double::NaN(), 3,
+                                                       &builder));
+  CHECK_EQ("NaN", builder.Finalize());
+
+  // JSON has no representation for special values.
+  builder.Reset();
+  CHECK(!JsonDoubleToStringConverter::ToShortest(Double::NaN(), &builder));
+  CHECK(!JsonDoubleToStringConverter::ToShortest(Double::Infinity(),
+                                                 &builder));
+  CHECK(!JsonDoubleToStringConverter::ToFixed(-Double::Infinity(), 2,
+                                              &builder));
+  CHECK_EQ("", builder.Finalize());
+
+  builder.Reset();
+  CHECK(JsonDoubleToStringConverter::ToShortest(1e21, &builder));
+  CHECK_EQ("1e+21", builder.Finalize());
+
+  builder.Reset();
+  CHECK(JsonDoubleToStringConverter::ToShortest(-0.0, &builder));
+  CHECK_EQ("0", builder.Finalize());
+}
+
+
+// Checks that emitting 'prepared' writes exactly the characters of 'expected'
+// and nothing past prepared.length().
+static void CheckEmit(const DoubleToStringConverter& dc,
+                      const DoubleToStringConverter::PreparedNumber& prepared,
+                      const char* expected) {
+  const int kBufferSize = 128;
+  char buffer[kBufferSize];
+  memset(buffer, '#', kBufferSize);
+  CHECK_EQ(static_cast<int>(strlen(expected)), prepared.length());
+  dc.Emit(prepared, buffer);
+  CHECK_EQ('#', buffer[prepared.length()]);
+  buffer[prepared.length()] = '\0';
+  CHECK_EQ(expected, buffer);
+}
+
+
+TEST(DoubleToStringTwoPhase) {
+  const int kBufferSize = 128;
+  char expected_buffer[kBufferSize];
+  StringBuilder expected(expected_buffer, kBufferSize);
+  DoubleToStringConverter::PreparedNumber prepared;
+
+  const int kFlags[] = {
+    DoubleToStringConverter::NO_FLAGS,
+    DoubleToStringConverter::EMIT_POSITIVE_EXPONENT_SIGN |
+        DoubleToStringConverter::UNIQUE_ZERO,
+    DoubleToStringConverter::EMIT_TRAILING_DECIMAL_POINT,
+    DoubleToStringConverter::EMIT_TRAILING_DECIMAL_POINT |
+        DoubleToStringConverter::EMIT_TRAILING_ZERO_AFTER_POINT,
+  };
+  const int kFlagsLength = ARRAY_SIZE(kFlags);
+  const double kValues[] = {
+    0.0, -0.0, 1.0, -1.5, 0.1, 123.456, 1e-6, 1.5e-7, 1e20, 1e21, -1.25e21,
+    5e-324, 1.7976931348623157e308, 0.000001234, 123456789.0, 230.0, 1e100,
+    -1e-100, 0.5, 9.5, 99.5, Double::Infinity(), -Double::Infinity(),
+    Double::NaN(),
+  };
+  const int kValuesLength = ARRAY_SIZE(kValues);
+  for (int f = 0; f < kFlagsLength; ++f) {
+    DoubleToStringConverter dc(kFlags[f], "Infinity", "NaN", 'e',
+                               -6, 21, 6, 0);
+    for (int i = 0; i < kValuesLength; ++i) {
+      double value = kValues[i];
+
+      expected.Reset();
+      CHECK(dc.ToShortest(value, &expected));
+      CHECK(dc.PrepareShortest(value, &prepared));
+      CheckEmit(dc, prepared, expected.Finalize());
+
+      expected.Reset();
+      CHECK(dc.ToShortestSingle(static_cast<float>(value), &expected));
+      CHECK(dc.PrepareShortestSingle(static_cast<float>(value), &prepared));
+      CheckEmit(dc, prepared, expected.Finalize());
+
+      for (int digits = 0; digits < 25; digits += 4) {
+        expected.Reset();
+        bool ok = dc.ToFixed(value, digits, &expected);
+        CHECK_EQ(ok, dc.PrepareFixed(value, digits, &prepared));
+        if (ok) CheckEmit(dc, prepared, expected.Finalize());
+
+        expected.Reset();
+        CHECK(dc.ToExponential(value, digits - 1, &expected));
+        CHECK(dc.PrepareExponential(value, digits - 1, &prepared));
+        CheckEmit(dc, prepared, expected.Finalize());
+
+        expected.Reset();
+        CHECK(dc.ToPrecision(value, digits + 1, &expected));
+        CHECK(dc.PreparePrecision(value, digits + 1, &prepared));
+        CheckEmit(dc, prepared, expected.Finalize());
+      }
+    }
+  }
+
+  // The length is known before any character is written.
+  const DoubleToStringConverter& dc =
+      DoubleToStringConverter::EcmaScriptConverter();
+  CHECK(dc.PrepareShortest(1.5e-7, &prepared));
+  CHECK_EQ(6, prepared.length());
+  CheckEmit(dc, prepared, "1.5e-7");
+
+  CHECK(dc.PrepareFixed(-0.0, 2, &prepared));
+  CheckEmit(dc, prepared, "0.00");
+
+  CHECK(dc.PreparePrecision(-Double::Infinity(), 5, &prepared));
+  CheckEmit(dc, prepared, "-Infinity");
+
+  CHECK(!dc.PrepareFixed(1e60, 2, &prepared));
+  CHECK(!dc.PrepareExponential(1.0, 200, &prepared));
+
+  char buffer[kBufferSize];
+  CHECK(EcmaScriptDoubleToStringConverter::PrepareShortest(1e21, &prepared));
+  CHECK_EQ(5, prepared.length());
+  EcmaScriptDoubleToStringConverter::Emit(prepared, buffer);
+  buffer[prepared.length()] = '\0';
+  CHECK_EQ("1e+21", buffer);
+
+  CHECK(JsonDoubleToStringConverter::PrepareExponential(-123.0, 3,
+                                                        &prepared));
+  CHECK_EQ(9, prepared.length());
+  JsonDoubleToStringConverter::Emit(prepared, buffer);
+  buffer[prepared.length()] = '\0';
+  CHECK_EQ("-1.230e+2", buffer);
+
+  // JSON has no representation for special values.
+  CHECK(!JsonDoubleToStringConverter::PrepareShortest(Double::NaN(),
+                                                      &prepared));
+  CHECK(!JsonDoubleToStringConverter::PreparePrecision(Double::Infinity(), 3,
+                                                       &prepared));
+}
+
+
 static double StrToD16(const uc16* str16, int length, int flags,
                        double empty_string_value,
                        int* processed_characters_count, bool* processed_all) {
@@ -3238,6 +3437,76 @@ TEST(StringToDoubleCommentExamples) {
 }
 
 
+TEST(StringToDoubleLongDigitRuns) {
+  // Runs of more than 16 digits are copied in blocks for 16 bit characters.
+  // StrToD checks that both character types give the same result.
+  int flags;
+  int processed;
+  bool all_used;
+
+  flags = StringToDoubleConverter::NO_FLAGS;
+  CHECK_EQ(123456789012345678901234567890.0,
+           StrToD("123456789012345678901234567890", flags, 0.0,
+                  &processed, &all_used));
+  CHECK(all_used);
+
+  CHECK_EQ(0.123456789012345678901234567890,
+           StrToD("0.123456789012345678901234567890", flags, 0.0,
+                  &processed, &all_used));
+  CHECK(all_used);
+
+  CHECK_EQ(12345678901234567.123456789012345678,
+           StrToD("12345678901234567.123456789012345678", flags, 0.0,
+                  &processed, &all_used));
+  CHECK(all_used);
+
+  CHECK_EQ(1234567890123456.5e10,
+           StrToD("1234567890123456.5e10", flags, 0.0, &processed, &all_used));
+  CHECK(all_used);
+
+  CHECK_EQ(Double::NaN(),
+           StrToD("12345678901234567890x", flags, 0.0, &processed, &all_used));
+  CHECK_EQ(0, processed);
+
+  flags = StringToDoubleConverter::ALLOW_OCTALS;
+  CHECK_EQ(1152921504606846975.0,
+           StrToD("0077777777777777777777", flags, 0.0, &processed, &all_used));
+  CHECK(all_used);
+
+  CHECK_EQ(77777777777777777778.0,
+           StrToD("0077777777777777777778", flags, 0.0, &processed, &all_used));
+  CHECK(all_used);
+
+  CHECK_EQ(77777777877777777777.0,
+           StrToD("0077777777877777777777", flags, 0.0, &processed, &all_used));
+  CHECK(all_used);
+
+  // Characters outside of the ASCII range end a run of digits. The buffer
+  // holds two full blocks, and the character sits in the low and high half
+  // of the first block and inside the second one.
+  const uc16 kNonAscii[] = { 0x0131, 0x3030, 0x8030, 0xFF10 };
+  const int kNonAsciiLength = ARRAY_SIZE(kNonAscii);
+  const int kPositions[] = { 3, 9, 20 };
+  const double kPrefixes[] = { 111.0, 111111111.0, 11111111111111111111.0 };
+  const int kPositionsLength = ARRAY_SIZE(kPositions);
+  for (int i = 0; i < kNonAsciiLength; ++i) {
+    for (int k = 0; k < kPositionsLength; ++k) {
+      uc16 buffer16[32];
+      for (int j = 0; j < 32; ++j) buffer16[j] = '1';
+      buffer16[kPositions[k]] = kNonAscii[i];
+      flags = StringToDoubleConverter::NO_FLAGS;
+      CHECK_EQ(Double::NaN(), StrToD16(buffer16, 32, flags, 0.0,
+                                       &processed, &all_used));
+      CHECK_EQ(0, processed);
+      flags = StringToDoubleConverter::ALLOW_TRAILING_JUNK;
+      CHECK_EQ(kPrefixes[k], StrToD16(buffer16, 32, flags, 0.0,
+                                      &processed, &all_used));
+      CHECK_EQ(kPositions[k], processed);
+    }
+  }
+}
+
+
 static float StrToF16(const uc16* str16, int length, int flags,
                       double empty_string_value,
                       int* processed_characters_count,
@@ -4710,3 +4979,116 @@ TEST(StringToDoubleFloatWhitespace) {
                            &processed, &all_used));
   CHECK(all_used);
 }
+
+
+// Feeds 'str' to a stream in two chunks, split at every possible position, and
+// checks that the result matches the one of StringToDouble.
+static void CheckStreamSplits(const StringToDoubleConverter& converter,
+                              const char* str) {
+  int length = strlen(str);
+  int processed;
+  double expected = converter.StringToDouble(str, length, &processed);
+  StringToDoubleStream stream(converter, ',');
+  for (int split = 0; split <= length; ++split) {
+    double values[1];
+    int values_count;
+    CHECK_EQ(split, stream.Feed(str, split, values, 1, &values_count));
+    CHECK_EQ(0, values_count);
+    CHECK_EQ(length - split, stream.Feed(str + split, length - split,
+                                         values, 1, &values_count));
+    CHECK_EQ(0, values_count);
+    double value;
+    CHECK_EQ(length != 0, stream.Finish(&value));
+    if (length != 0) {
+      CHECK(Double(expected).AsUint64() == Double(value).AsUint64());
+    }
+  }
+}
+
+
+TEST(StringToDoubleStream) {
+  static const char* const kInputs[] = {
+    "", " ", "0", "-0", "00", "0.", ".0", ".", "-", "+ 1", "- 1", " 1", "1 ",
+    "1.5", "-1.5e10", "1e", "1e+", "1e-x", "12e345", "1e-400", "0.000123",
+    "01234", "012349", "01234.5", "01234e5", "0x", "0x1234", "0X1234k",
+    "0x00", "-0x1f ", "0x1fffffffffffffff", "0x20000000000000100",
+    "0x20000000000000101", "infinity", "-infinity ", "infinit", "nan",
+    "+nan x", "1x", "1 x", "0.1234567890123456789012345678901234567890",
+    "123456789012345678901234567890e-10", "7.2057594037927933e16",
+    "2.2250738585072011e-308", "4.9406564584124654e-324",
+  };
+  static const int kFlags[] = {
+    StringToDoubleConverter::NO_FLAGS,
+    StringToDoubleConverter::ALLOW_HEX | StringToDoubleConverter::ALLOW_OCTALS,
+    StringToDoubleConverter::ALLOW_TRAILING_JUNK |
+        StringToDoubleConverter::ALLOW_HEX |
+        StringToDoubleConverter::ALLOW_OCTALS,
+    StringToDoubleConverter::ALLOW_LEADING_SPACES |
+        StringToDoubleConverter::ALLOW_TRAILING_SPACES |
+        StringToDoubleConverter::ALLOW_SPACES_AFTER_SIGN,
+    StringToDoubleConverter::ALLOW_TRAILING_SPACES |
+        StringToDoubleConverter::ALLOW_HEX,
+  };
+  const int kFlagsLength = ARRAY_SIZE(kFlags);
+  const int kInputsLength = ARRAY_SIZE(kInputs);
+  for (int i = 0; i < kFlagsLength; ++i) {
+    StringToDoubleConverter converter(kFlags[i], 1.0, -1.0,
+                                      "infinity", "nan");
+    for (int j = 0; j < kInputsLength; ++j) {
+      CheckStreamSplits(converter, kInputs[j]);
+    }
+  }
+
+  // Numbers with more than kMaxSignificantDigits digits.
+  char long_number[1200];
+  memset(long_number, '0', sizeof(long_number));
+  long_number[0] = '1';
+  long_number[800] = '5';
+  long_number[sizeof(long_number) - 1] = '\0';
+  StringToDoubleConverter plain(StringToDoubleConverter::NO_FLAGS, 1.0, -1.0,
+                                NULL, NULL);
+  CheckStreamSplits(plain, long_number);
+  long_number[1] = '.';
+  CheckStreamSplits(plain, long_number);
+
+  // Several numbers per chunk, emitted while the output is not full.
+  StringToDoubleConverter converter(
+      StringToDoubleConverter::ALLOW_LEADING_SPACES |
+          StringToDoubleConverter::ALLOW_TRAILING_SPACES,
+      0.0, Double::NaN(), NULL, NULL);
+  StringToDoubleStream stream(converter, ',');
+  const char* input = "1.5, 2,,x, -3e2";
+  double values[2];
+  int values_count;
+  CHECK_EQ(7, stream.Feed(input, strlen(input), values, 2, &values_count));
+  CHECK_EQ(2, values_count);
+  CHECK_EQ(1.5, values[0]);
+  CHECK_EQ(2.0, values[1]);
+  CHECK_EQ(3, stream.Feed(input + 7, strlen(input) - 7,
+                          values, 2, &values_count));
+  CHECK_EQ(2, values_count);
+  CHECK_EQ(0.0, values[0]);
+  CHECK(Double(values[1]).IsNan());
+  CHECK_EQ(5, stream.Feed(input + 10, strlen(input) - 10,
+                          values, 2, &values_count));
+  CHECK_EQ(0, values_count);
+  double value;
+  CHECK(stream.Finish(&value));
+  CHECK_EQ(-300.0, value);
+  CHECK(!stream.Finish(&value));
+
+  // 16 bit characters.
+  const uc16 kInput16[] = { 0x2009, '-', '0', 'x', '1', '0', ',', '7' };
+  StringToDoubleConverter converter16(
+      StringToDoubleConverter::ALLOW_LEADING_SPACES |
+          StringToDoubleConverter::ALLOW_HEX,
+      0.0, Double::NaN(), NULL, NULL);
+  const int kInput16Length = ARRAY_SIZE(kInput16);
+  StringToDoubleStream stream16(converter16, ',');
+  CHECK_EQ(kInput16Length,
+           stream16.Feed(kInput16, kInput16Length, values, 2, &values_count));
+  CHECK_EQ(1, values_count);
+  CHECK_EQ(-16.0, values[0]);
+  CHECK(stream16.Finish(&value));
+  CHECK_EQ(7.0, value);
+}
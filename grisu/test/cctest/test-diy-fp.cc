@@ -63,3 +63,27 @@ TEST(Multiply) {
   CHECK(UINT64_2PART_C(0xFFFFFFFF, FFFFFFFe) == product.f());
   CHECK_EQ(11 + 13 + 64, product.e());
 }
+
+
+TEST(Multiply64) {
+  uint64_t high;
+  uint64_t low = Multiply64(3, 2, &high);
+  CHECK(6 == low);  // NOLINT
+  CHECK(0 == high);  // NOLINT
+
+  low = Multiply64(UINT64_2PART_C(0x00000001, 00000000),
+                   UINT64_2PART_C(0x00000001, 00000000), &high);
+  CHECK(0 == low);  // NOLINT
+  CHECK(1 == high);  // NOLINT
+
+  low = Multiply64(UINT64_2PART_C(0xFFFFFFFF, FFFFFFFF),
+                   UINT64_2PART_C(0xFFFFFFFF, FFFFFFFF), &high);
+  CHECK(1 == low);  // NOLINT
+  CHECK(UINT64_2PART_C(0xFFFFFFFF, FFFFFFFE) == high);
+
+  // The carries of the middle partial products must reach the high word.
+  low = Multiply64(UINT64_2PART_C(0x80000000, FFFFFFFF),
+                   UINT64_2PART_C(0xFFFFFFFF, 80000000), &high);
+  CHECK(UINT64_2PART_C(0x80000000, 80000000) == low);
+  CHECK(UINT64_2PART_C(0x80000000, BFFFFFFE) == high);
+}
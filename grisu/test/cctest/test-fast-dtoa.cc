@@ -97,6 +97,57 @@ TEST(FastDtoaShortestVariousDoubles) {
 }
 
 
+// DigitGen emits whole blocks of digits. These numbers stop in the integral
+// part, right after it, and after one or more blocks of fractional digits.
+TEST(FastDtoaShortestDigitBlocks) {
+  char buffer_container[kBufferSize];
+  Vector<char> buffer(buffer_container, kBufferSize);
+  int length;
+  int point;
+  bool status;
+
+  status = FastDtoa(1e21, FAST_DTOA_SHORTEST, 0, buffer, &length, &point);
+  CHECK(status);
+  CHECK_EQ("1", buffer.start());
+  CHECK_EQ(22, point);
+
+  status = FastDtoa(0.1, FAST_DTOA_SHORTEST, 0, buffer, &length, &point);
+  CHECK(status);
+  CHECK_EQ("1", buffer.start());
+  CHECK_EQ(0, point);
+
+  status = FastDtoa(1.0 / 3.0, FAST_DTOA_SHORTEST, 0, buffer, &length, &point);
+  CHECK(status);
+  CHECK_EQ("3333333333333333", buffer.start());
+  CHECK_EQ(0, point);
+
+  status = FastDtoa(123456.789, FAST_DTOA_SHORTEST, 0, buffer, &length, &point);
+  CHECK(status);
+  CHECK_EQ("123456789", buffer.start());
+  CHECK_EQ(6, point);
+
+  status = FastDtoa(98765432.0, FAST_DTOA_SHORTEST, 0, buffer, &length, &point);
+  CHECK(status);
+  CHECK_EQ("98765432", buffer.start());
+  CHECK_EQ(8, point);
+
+  status = FastDtoa(2.5e-10, FAST_DTOA_SHORTEST, 0, buffer, &length, &point);
+  CHECK(status);
+  CHECK_EQ("25", buffer.start());
+  CHECK_EQ(-9, point);
+
+  status = FastDtoa(1.2345678901234568e-5, FAST_DTOA_SHORTEST, 0, buffer, &length, &point);
+  CHECK(status);
+  CHECK_EQ("12345678901234568", buffer.start());
+  CHECK_EQ(-4, point);
+
+  status = FastDtoa(7e15, FAST_DTOA_SHORTEST, 0, buffer, &length, &point);
+  CHECK(status);
+  CHECK_EQ("7", buffer.start());
+  CHECK_EQ(16, point);
+}
+
+
 TEST(FastDtoaShortestVariousFloats) {
   char buffer_container[kBufferSize];
   Vector<char> buffer(buffer_container, kBufferSize);
@@ -574,6 +574,20 @@ TEST(Strtof) {
   CHECK_EQ(2147483648.0f, StrtofChar("214748377599999", -5));
   CHECK_EQ(2147483904.0f, StrtofChar("214748377600001", -5));
 
+  // The exact float fast path: up to 7 digits and powers of ten up to 10^10.
+  CHECK_EQ(1234567e10f, StrtofChar("1234567", 10));
+  CHECK_EQ(1234567e-10f, StrtofChar("1234567", -10));
+  CHECK_EQ(12e15f, StrtofChar("12", 15));
+  CHECK_EQ(12345678e-10f, StrtofChar("12345678", -10));
+  CHECK_EQ(1234567e11f, StrtofChar("1234567", 11));
+
+  // Overflow and underflow limits.
+  CHECK_EQ(3.4028235e38f, StrtofChar("34028235677973366", 22));
+  CHECK_EQ(Single::Infinity(), StrtofChar("34028235677973367", 22));
+  CHECK_EQ(Single::Infinity(), StrtofChar("1", 39));
+  CHECK_EQ(0.0f, StrtofChar("7006492321624085", -61));
+  CHECK_EQ(1e-45f, StrtofChar("7006492321624086", -61));
+  CHECK_EQ(0.0f, StrtofChar("9", -47));
 }
 
 
@@ -684,6 +698,111 @@ TEST(RandomStrtod) {
 }
 
 
+// Writes the decimal digits of (2 * significand + 1) * 5^1075 and returns
+// their count. Times 10^-1075 this is the exact midpoint between the doubles
+// significand * 2^-1074 and (significand + 1) * 2^-1074. Such midpoints have
+// the longest decimal expansions of all doubles.
+static int HalfwayDigits(uint64_t significand, char* buffer) {
+  // Little-endian decimal digits.
+  char digits[kBufferSize];
+  int length = 0;
+  uint64_t value = 2 * significand + 1;
+  while (value != 0) {
+    digits[length++] = static_cast<char>(value % 10);
+    value /= 10;
+  }
+  for (int i = 0; i < 1075; ++i) {
+    int carry = 0;
+    for (int j = 0; j < length; ++j) {
+      int product = digits[j] * 5 + carry;
+      digits[j] = static_cast<char>(product % 10);
+      carry = product / 10;
+    }
+    if (carry != 0) digits[length++] = static_cast<char>(carry);
+  }
+  for (int i = 0; i < length; ++i) {
+    buffer[i] = digits[length - 1 - i] + '0';
+  }
+  buffer[length] = '\0';
+  return length;
+}
+
+
+// Long inputs close to a midpoint are decided by comparing the input with the
+// midpoint block by block.
+TEST(StrtodLongHalfway) {
+  const int kMaxSignificantDigits = 780;
+  const uint64_t kSignificands[] = {
+    // The largest normal and subnormal significands with this exponent, one
+    // of each parity.
+    UINT64_2PART_C(0x001FFFFF, FFFFFFFE), UINT64_2PART_C(0x001FFFFF, FFFFFFFD),
+    UINT64_2PART_C(0x000FFFFF, FFFFFFFE), UINT64_2PART_C(0x000FFFFF, FFFFFFFB),
+    UINT64_2PART_C(0x00123456, 789ABCDE), UINT64_2PART_C(0x00123456, 789ABCDF),
+  };
+  const int kSignificandsLength = ARRAY_SIZE(kSignificands);
+  char buffer[kBufferSize];
+  for (int i = 0; i < kSignificandsLength; ++i) {
+    uint64_t significand = kSignificands[i];
+    double below = Double(significand).value();
+    double above = Double(significand + 1).value();
+    // Ties round to the even significand.
+    double tie = (significand & 1) == 0 ? below : above;
+
+    int length = HalfwayDigits(significand, buffer);
+    CHECK(length > 700);
+    CHECK(length < kMaxSignificantDigits);
+    Vector<const char> halfway(buffer, length);
+    CHECK_EQ(tie, Strtod(halfway, -1075));
+
+    // Decided a few blocks in, long before the end of the buffer.
+    int pos = 20;
+    while (buffer[pos] == '9') pos++;
+    buffer[pos]++;
+    CHECK_EQ(above, Strtod(halfway, -1075));
+    buffer[pos]--;
+    pos = 20;
+    while (buffer[pos] == '0') pos++;
+    buffer[pos]--;
+    CHECK_EQ(below, Strtod(halfway, -1075));
+    buffer[pos]++;
+
+    // Padded to exactly kMaxSignificantDigits, differing only in the last
+    // digit.
+    int padding = kMaxSignificantDigits - length;
+    for (int j = length; j < kMaxSignificantDigits; ++j) {
+      buffer[j] = '0';
+    }
+    Vector<const char> padded(buffer, kMaxSignificantDigits);
+    CHECK_EQ(tie, Strtod(padded, -1075 - padding));
+    buffer[kMaxSignificantDigits - 1] = '1';
+    CHECK_EQ(above, Strtod(padded, -1075 - padding));
+
+    // Longer inputs are cut to kMaxSignificantDigits digits, keeping a
+    // non-zero last digit.
+    buffer[kMaxSignificantDigits - 1] = '0';
+    for (int j = kMaxSignificantDigits; j < kMaxSignificantDigits + 20; ++j) {
+      buffer[j] = '0';
+    }
+    buffer[kMaxSignificantDigits + 19] = '1';
+    Vector<const char> cut(buffer, kMaxSignificantDigits + 20);
+    CHECK_EQ(above, Strtod(cut, -1075 - padding - 20));
+
+    // Just below the midpoint at the full length: the midpoint minus one unit
+    // in the last place, with the last digit lowered once more.
+    HalfwayDigits(significand, buffer);
+    pos = length - 1;
+    while (buffer[pos] == '0') buffer[pos--] = '9';
+    buffer[pos]--;
+    for (int j = length; j < kMaxSignificantDigits; ++j) {
+      buffer[j] = '9';
+    }
+    CHECK_EQ(below, Strtod(padded, -1075 - padding));
+    buffer[kMaxSignificantDigits - 1] = '8';
+    CHECK_EQ(below, Strtod(padded, -1075 - padding));
+  }
+}
+
+
 static bool CheckFloat(Vector<const char> buffer,
                         int exponent,
                         float to_check) {